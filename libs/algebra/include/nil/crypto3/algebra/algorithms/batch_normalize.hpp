@@ -0,0 +1,211 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
+#define CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/detail/forms/edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /*
+                 * values[i] = values[i]^(-1) with one field inversion for the whole vector. Zero values stay zero,
+                 * as with inversed() on a single element.
+                 */
+                template<typename FieldValueType>
+                void batch_invert(std::vector<FieldValueType> &values) {
+                    if (values.empty()) {
+                        return;
+                    }
+
+                    std::vector<FieldValueType> prefix(values.size());
+                    FieldValueType product = FieldValueType::one();
+                    for (std::size_t i = 0; i < values.size(); ++i) {
+                        prefix[i] = product;
+                        if (!values[i].is_zero()) {
+                            product *= values[i];
+                        }
+                    }
+
+                    FieldValueType inverse = product.inversed();
+                    for (std::size_t i = values.size(); i-- > 0;) {
+                        if (values[i].is_zero()) {
+                            continue;
+                        }
+                        const FieldValueType value = values[i];
+                        values[i] = inverse * prefix[i];
+                        inverse *= value;
+                    }
+                }
+
+                template<typename Coordinates, typename... Tags>
+                constexpr static const bool is_one_of = (std::is_same<Coordinates, Tags>::value || ...);
+
+                // x = X / Z^2, y = Y / Z^3
+                template<typename Coordinates>
+                constexpr static const bool has_jacobian_denominator =
+                    is_one_of<Coordinates, curves::coordinates::jacobian, curves::coordinates::jacobian_with_a4_0,
+                              curves::coordinates::jacobian_with_a4_minus_3>;
+
+                // x = X / Z, y = Y / Z
+                template<typename Coordinates>
+                constexpr static const bool has_projective_denominator =
+                    is_one_of<Coordinates, curves::coordinates::projective,
+                              curves::coordinates::projective_with_a4_minus_3,
+                              curves::coordinates::extended_with_a_minus_1>;
+
+                // x = Z / X, y = Z / Y
+                template<typename Coordinates>
+                constexpr static const bool has_inverted_denominators =
+                    is_one_of<Coordinates, curves::coordinates::inverted>;
+            }    // namespace detail
+
+            /*!
+             * @brief Affine forms of all points of the range with a single field inversion.
+             *
+             * Handles Jacobian, projective, extended and inverted coordinates, and copies points that are already
+             * affine. The result matches to_affine() on every point, zeros included.
+             */
+            template<typename InputRange>
+            auto batch_to_affine(const InputRange &points) {
+                typedef std::remove_cvref_t<decltype(*std::begin(points))> value_type;
+                typedef decltype(std::declval<value_type>().to_affine()) affine_value_type;
+                typedef typename value_type::coordinates coordinates;
+                typedef std::remove_cvref_t<decltype(std::declval<value_type>().X)> field_value_type;
+
+                std::vector<affine_value_type> result;
+                result.reserve(std::distance(std::begin(points), std::end(points)));
+
+                if constexpr (std::is_same<coordinates, curves::coordinates::affine>::value) {
+                    result.assign(std::begin(points), std::end(points));
+                } else if constexpr (detail::has_jacobian_denominator<coordinates> ||
+                                     detail::has_projective_denominator<coordinates>) {
+                    std::vector<field_value_type> inverses;
+                    for (const value_type &point : points) {
+                        inverses.emplace_back(point.is_zero() ? field_value_type::zero() : point.Z);
+                    }
+                    detail::batch_invert(inverses);
+
+                    std::size_t i = 0;
+                    for (const value_type &point : points) {
+                        const field_value_type &Zi = inverses[i++];
+                        if (point.is_zero()) {
+                            result.emplace_back(affine_value_type::zero());
+                        } else if constexpr (detail::has_jacobian_denominator<coordinates>) {
+                            const field_value_type Zi2 = Zi.squared();
+                            result.emplace_back(point.X * Zi2, point.Y * Zi2 * Zi);
+                        } else {
+                            result.emplace_back(point.X * Zi, point.Y * Zi);
+                        }
+                    }
+                } else if constexpr (detail::has_inverted_denominators<coordinates>) {
+                    std::vector<field_value_type> inverses;
+                    for (const value_type &point : points) {
+                        inverses.emplace_back(point.is_zero() ? field_value_type::zero() : point.X);
+                        inverses.emplace_back(point.is_zero() ? field_value_type::zero() : point.Y);
+                    }
+                    detail::batch_invert(inverses);
+
+                    std::size_t i = 0;
+                    for (const value_type &point : points) {
+                        if (point.is_zero()) {
+                            result.emplace_back(affine_value_type::zero());
+                        } else {
+                            result.emplace_back(point.Z * inverses[i], point.Z * inverses[i + 1]);
+                        }
+                        i += 2;
+                    }
+                } else {
+                    for (const value_type &point : points) {
+                        result.emplace_back(point.to_affine());
+                    }
+                }
+                return result;
+            }
+
+            /*!
+             * @brief Rewrites every nonzero point of the range with Z = 1, sharing one field inversion.
+             *
+             * Normalized points take the mixed addition formulas and convert to affine without an inversion.
+             * Jacobian points become (X / Z^2 : Y / Z^3 : 1), projective and inverted ones (X / Z : Y / Z : 1), and
+             * extended ones also get T / Z. Affine points are left unchanged.
+             */
+            template<typename InputRange>
+            void batch_normalize(InputRange &points) {
+                typedef std::remove_cvref_t<decltype(*std::begin(points))> value_type;
+                typedef typename value_type::coordinates coordinates;
+
+                static_assert(std::is_same<coordinates, curves::coordinates::affine>::value ||
+                                  detail::has_jacobian_denominator<coordinates> ||
+                                  detail::has_projective_denominator<coordinates> ||
+                                  detail::has_inverted_denominators<coordinates>,
+                              "batch_normalize: no Z = 1 form for these coordinates");
+
+                if constexpr (!std::is_same<coordinates, curves::coordinates::affine>::value) {
+                    typedef std::remove_cvref_t<decltype(std::declval<value_type>().Z)> field_value_type;
+
+                    std::vector<field_value_type> inverses;
+                    for (const value_type &point : points) {
+                        inverses.emplace_back(point.is_zero() ? field_value_type::zero() : point.Z);
+                    }
+                    detail::batch_invert(inverses);
+
+                    std::size_t i = 0;
+                    for (value_type &point : points) {
+                        const field_value_type &Zi = inverses[i++];
+                        // The zero point, and points of the inverted forms with Z = 0, keep their representation.
+                        if (Zi.is_zero()) {
+                            continue;
+                        }
+                        if constexpr (detail::has_jacobian_denominator<coordinates>) {
+                            const field_value_type Zi2 = Zi.squared();
+                            point.X *= Zi2;
+                            point.Y *= Zi2 * Zi;
+                        } else {
+                            point.X *= Zi;
+                            point.Y *= Zi;
+                            if constexpr (requires { point.T; }) {
+                                point.T *= Zi;
+                            }
+                        }
+                        point.Z = field_value_type::one();
+                    }
+                }
+            }
+        }    // namespace algebra
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_NORMALIZE_HPP
@@ -0,0 +1,305 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /*
+                     * The routines below multiply by secret scalars with a schedule of group operations and a memory
+                     * access pattern that do not depend on the scalar. The scalar k is made odd as k | 1 and recoded
+                     * into signed odd digits d_i in [-15, 15] with k | 1 = sum d_i * 16^i, so that no digit is zero.
+                     * The digits are looked up in tables of odd multiples by scanning the whole table, and an even
+                     * scalar is corrected by always subtracting the base and keeping the difference by a mask.
+                     *
+                     * The guarantee covers the scalar multiplication itself; the field arithmetic underneath is
+                     * still the ordinary one.
+                     */
+                    constexpr static const std::size_t constant_time_window_bits = 4;
+                    constexpr static const std::size_t constant_time_table_size = 1u << (constant_time_window_bits - 1);
+
+                    // r = a where mask is all ones, r is kept where mask is zero.
+                    template<typename FieldValueType>
+                    constexpr void conditional_assign_field(FieldValueType &r, const FieldValueType &a,
+                                                            boost::multiprecision::limb_type mask) {
+                        if constexpr (requires { r.data.backend().base_data().limbs(); }) {
+                            using backend_type = std::remove_cvref_t<decltype(r.data.backend().base_data())>;
+                            boost::multiprecision::limb_type *r_limbs = r.data.backend().base_data().limbs();
+                            const boost::multiprecision::limb_type *a_limbs = a.data.backend().base_data().limbs();
+                            for (std::size_t i = 0; i < backend_type::internal_limb_count; ++i) {
+                                r_limbs[i] ^= (r_limbs[i] ^ a_limbs[i]) & mask;
+                            }
+                        } else {
+                            for (std::size_t i = 0; i < r.data.size(); ++i) {
+                                conditional_assign_field(r.data[i], a.data[i], mask);
+                            }
+                        }
+                    }
+
+                    template<typename CurveElementType>
+                    constexpr void conditional_assign(CurveElementType &r, const CurveElementType &a,
+                                                      boost::multiprecision::limb_type mask) {
+                        conditional_assign_field(r.X, a.X, mask);
+                        conditional_assign_field(r.Y, a.Y, mask);
+                        if constexpr (requires { r.Z; }) {
+                            conditional_assign_field(r.Z, a.Z, mask);
+                        }
+                        if constexpr (requires { r.T; }) {
+                            conditional_assign_field(r.T, a.T, mask);
+                        }
+                    }
+
+                    constexpr boost::multiprecision::limb_type mask_if(bool condition) {
+                        return boost::multiprecision::limb_type(0u) - static_cast<boost::multiprecision::limb_type>(condition);
+                    }
+
+                    // The 4 scalar bits starting at the public bit position, zero past the last limb.
+                    template<std::size_t LimbsCount>
+                    constexpr unsigned scalar_window(const std::array<boost::multiprecision::limb_type, LimbsCount> &limbs,
+                                                     std::size_t position) {
+                        constexpr std::size_t limb_bits = sizeof(boost::multiprecision::limb_type) * 8;
+                        const std::size_t index = position / limb_bits;
+                        const std::size_t shift = position % limb_bits;
+                        if (index >= LimbsCount) {
+                            return 0;
+                        }
+                        boost::multiprecision::limb_type window = limbs[index] >> shift;
+                        if (shift + constant_time_window_bits > limb_bits && index + 1 < LimbsCount) {
+                            window |= limbs[index + 1] << (limb_bits - shift);
+                        }
+                        return static_cast<unsigned>(window & ((1u << constant_time_window_bits) - 1));
+                    }
+
+                    /*
+                     * Recodes k | 1 into digit windows. The window value b in [0, 16) stands for the digit
+                     * 2 * b - 15. With n windows, k | 1 < 2^(4 * n), and the top window is biased by 8 to a
+                     * positive digit.
+                     */
+                    template<unsigned Bits>
+                    class constant_time_recoding {
+                    public:
+                        typedef boost::multiprecision::number<boost::multiprecision::backends::cpp_int_modular_backend<Bits>>
+                            integral_type;
+
+                        constexpr static const std::size_t windows_count =
+                            (Bits + constant_time_window_bits - 1) / constant_time_window_bits;
+
+                        explicit constexpr constant_time_recoding(const integral_type &scalar) {
+                            const boost::multiprecision::limb_type *scalar_limbs = scalar.backend().limbs();
+                            for (std::size_t i = 0; i < limbs_count; ++i) {
+                                limbs[i] = scalar_limbs[i];
+                            }
+                            even_mask = mask_if((limbs[0] & 1u) == 0);
+                            limbs[0] |= 1u;
+                        }
+
+                        // Window i for i < windows_count, the top one already biased.
+                        constexpr unsigned window(std::size_t i) const {
+                            const unsigned value = scalar_window(limbs, i * constant_time_window_bits + 1);
+                            return i + 1 == windows_count ? value + (1u << (constant_time_window_bits - 1)) : value;
+                        }
+
+                        // All ones when the scalar was even.
+                        boost::multiprecision::limb_type even_mask;
+
+                    private:
+                        constexpr static const std::size_t limbs_count =
+                            boost::multiprecision::backends::cpp_int_modular_backend<Bits>::internal_limb_count;
+
+                        std::array<boost::multiprecision::limb_type, limbs_count> limbs;
+                    };
+
+                    // Returns (2 * b - 15) * P from the table of P, 3P, ..., 15P, reading every entry.
+                    template<typename CurveElementType>
+                    constexpr CurveElementType
+                        constant_time_lookup(const std::array<CurveElementType, constant_time_table_size> &table,
+                                             unsigned window) {
+                        const unsigned positive = window >> (constant_time_window_bits - 1);
+                        const unsigned index = (window ^ ((positive - 1u) & (constant_time_table_size - 1))) &
+                                               (constant_time_table_size - 1);
+
+                        CurveElementType result = table[0];
+                        for (std::size_t j = 1; j < constant_time_table_size; ++j) {
+                            conditional_assign(result, table[j], mask_if(j == index));
+                        }
+                        const CurveElementType negated = -result;
+                        conditional_assign(result, negated, mask_if(positive == 0));
+                        return result;
+                    }
+
+                    // Table entries with Z = 1 go through the cheaper mixed addition where the form has one.
+                    template<typename CurveElementType>
+                    constexpr CurveElementType normalize(const CurveElementType &point) {
+                        if constexpr (requires { CurveElementType::from_affine(point.to_affine()); }) {
+                            return CurveElementType::from_affine(point.to_affine());
+                        } else {
+                            return point;
+                        }
+                    }
+
+                    template<typename CurveElementType>
+                    constexpr void add_normalized(CurveElementType &point, const CurveElementType &other) {
+                        if constexpr (requires { CurveElementType::from_affine(other.to_affine()); }) {
+                            point.mixed_add(other);
+                        } else {
+                            point += other;
+                        }
+                    }
+
+                    template<typename CurveElementType>
+                    std::array<CurveElementType, constant_time_table_size> odd_multiples(const CurveElementType &base) {
+                        std::array<CurveElementType, constant_time_table_size> table;
+                        CurveElementType dbl = base;
+                        dbl.double_inplace();
+                        table[0] = base;
+                        for (std::size_t j = 1; j < constant_time_table_size; ++j) {
+                            table[j] = table[j - 1] + dbl;
+                        }
+                        return table;
+                    }
+
+                    /*!
+                     * @brief base = scalar * base with a fixed 4-bit window, for secret scalars.
+                     *
+                     * Takes 4 doublings and one addition per window, against the fewer additions of the wNAF in
+                     * scalar_mul_inplace, in exchange for a schedule independent of the scalar.
+                     */
+                    template<typename CurveElementType, unsigned Bits>
+                    void scalar_mul_constant_time_inplace(
+                        CurveElementType &base,
+                        boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<Bits>> const &scalar) {
+                        typedef constant_time_recoding<Bits> recoding_type;
+
+                        const recoding_type recoding(scalar);
+                        const std::array<CurveElementType, constant_time_table_size> table = odd_multiples(base);
+
+                        CurveElementType result =
+                            constant_time_lookup(table, recoding.window(recoding_type::windows_count - 1));
+                        for (std::size_t i = recoding_type::windows_count - 1; i-- > 0;) {
+                            for (std::size_t j = 0; j < constant_time_window_bits; ++j) {
+                                result.double_inplace();
+                            }
+                            result += constant_time_lookup(table, recoding.window(i));
+                        }
+
+                        const CurveElementType corrected = result - base;
+                        conditional_assign(result, corrected, recoding.even_mask);
+                        base = result;
+                    }
+
+                    /*!
+                     * @brief Precomputed multiples of a fixed base, for secret scalars.
+                     *
+                     * Window i holds the odd multiples (2 * j + 1) * 16^i * base, j < 8, so a multiplication is
+                     * one table lookup and one mixed addition per 4 scalar bits and no doublings. The table of the
+                     * group generator is built once, on first use.
+                     */
+                    template<typename CurveElementType>
+                    class fixed_base_comb {
+                    public:
+                        typedef typename CurveElementType::group_type::curve_type::scalar_field_type scalar_field_type;
+                        typedef typename scalar_field_type::value_type scalar_value_type;
+                        typedef typename scalar_field_type::integral_type integral_type;
+
+                        explicit fixed_base_comb(const CurveElementType &base) : negated_base(normalize(-base)) {
+                            CurveElementType window_base = base;
+                            for (std::size_t i = 0; i < windows_count; ++i) {
+                                table[i] = odd_multiples(window_base);
+                                for (std::size_t j = 0; j < constant_time_table_size; ++j) {
+                                    table[i][j] = normalize(table[i][j]);
+                                }
+                                for (std::size_t j = 0; j < constant_time_window_bits; ++j) {
+                                    window_base.double_inplace();
+                                }
+                            }
+                        }
+
+                        static const fixed_base_comb &generator() {
+                            static const fixed_base_comb comb(CurveElementType::one());
+                            return comb;
+                        }
+
+                        CurveElementType operator()(const integral_type &scalar) const {
+                            const recoding_type recoding(scalar);
+
+                            // Below the top window a partial sum is smaller in magnitude than the next term and
+                            // cannot meet it modulo the group order, so only the last addition needs the general
+                            // formula.
+                            CurveElementType result = constant_time_lookup(table[0], recoding.window(0));
+                            for (std::size_t i = 1; i + 1 < windows_count; ++i) {
+                                add_normalized(result, constant_time_lookup(table[i], recoding.window(i)));
+                            }
+                            result += constant_time_lookup(table[windows_count - 1], recoding.window(windows_count - 1));
+
+                            CurveElementType corrected = result;
+                            corrected += negated_base;
+                            conditional_assign(result, corrected, recoding.even_mask);
+                            return result;
+                        }
+
+                        CurveElementType operator()(const scalar_value_type &scalar) const {
+                            return (*this)(static_cast<integral_type>(scalar.to_integral()));
+                        }
+
+                    private:
+                        typedef constant_time_recoding<scalar_field_type::modulus_bits> recoding_type;
+
+                        constexpr static const std::size_t windows_count = recoding_type::windows_count;
+
+                        std::array<std::array<CurveElementType, constant_time_table_size>, windows_count> table;
+                        CurveElementType negated_base;
+                    };
+
+                    /*!
+                     * @brief scalar * generator through the generator's fixed_base_comb.
+                     *
+                     * Signers pass secret scalars here (nonces, private keys), so the table lookups and the
+                     * recoding do not branch on the scalar bits.
+                     */
+                    template<typename CurveElementType>
+                    CurveElementType fixed_base_mul(
+                        const typename CurveElementType::group_type::curve_type::scalar_field_type::value_type
+                            &scalar) {
+                        return fixed_base_comb<CurveElementType>::generator()(scalar);
+                    }
+                }    // namespace detail
+            }    // namespace curves
+        }    // namespace algebra
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_CONSTANT_TIME_SCALAR_MUL_HPP
@@ -213,6 +213,11 @@ namespace nil {
                                 return result_type::zero();
                             }
 
+                            // Points left by batch_normalize need no inversion.
+                            if (Z.is_one()) {
+                                return result_type(X, Y);
+                            }
+
                             auto Zi = Z.inversed();
                             return result_type(X * Zi * Zi, Y * Zi * Zi * Zi);    //  x=X/Z^2, y=Y/Z^3
                         }
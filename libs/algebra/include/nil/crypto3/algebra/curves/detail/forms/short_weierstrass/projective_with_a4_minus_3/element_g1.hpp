@@ -194,6 +194,11 @@ namespace nil {
                                 return result_type::zero();
                             }
 
+                            // Points left by batch_normalize need no inversion.
+                            if (Z.is_one()) {
+                                return result_type(X, Y);
+                            }
+
                             return result_type(X * Z.inversed(), Y * Z.inversed());    //  x=X/Z, y=Y/Z
                         }
 
@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_BATCH_OPERATIONS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_BATCH_OPERATIONS_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <nil/crypto3/multiprecision/modular/montgomery_ifma.hpp>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    template<typename Backend,
+                             bool Trivial = boost::multiprecision::backends::is_trivial_cpp_int_modular<Backend>::value>
+                    struct batch_limbs_count {
+                        constexpr static const std::size_t value = 0;
+                    };
+
+                    template<typename Backend>
+                    struct batch_limbs_count<Backend, false> {
+                        constexpr static const std::size_t value = Backend::internal_limb_count;
+                    };
+
+                    /*!
+                     * @brief Tells whether arrays of ValueType can go through the vectorized Montgomery kernels,
+                     * and gives them the limbs of the elements.
+                     */
+                    template<typename ValueType>
+                    struct batch_kernel_traits {
+                        constexpr static const bool value = false;
+                    };
+
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                    template<typename FieldParams>
+                    struct batch_kernel_traits<element_fp<FieldParams>> {
+                        typedef element_fp<FieldParams> value_type;
+                        typedef boost::multiprecision::limb_type limb_type;
+                        typedef boost::multiprecision::backends::montgomery_ifma_impl kernel_type;
+
+                        constexpr static const std::size_t limbs_count =
+                            batch_limbs_count<typename value_type::modular_backend>::value;
+                        constexpr static const bool value = sizeof(limb_type) == 8 &&
+                                                            sizeof(value_type) % sizeof(limb_type) == 0 &&
+                                                            kernel_type::has_kernel<limbs_count>();
+
+                        typedef typename kernel_type::template params<limbs_count> params_type;
+
+                        // Distance between consecutive elements in limbs.
+                        constexpr static const std::size_t stride = sizeof(value_type) / sizeof(limb_type);
+
+                        static bool is_supported() {
+                            return kernel_type::is_supported() && boost::multiprecision::bit_test(value_type::modulus, 0);
+                        }
+
+                        static const params_type &params() {
+                            static const params_type p(value_type::modulus.backend().limbs());
+                            return p;
+                        }
+
+                        static limb_type *limbs(value_type *x) {
+                            return x->data.backend().base_data().limbs();
+                        }
+
+                        static const limb_type *limbs(const value_type *x) {
+                            return x->data.backend().base_data().limbs();
+                        }
+                    };
+#endif
+
+                    // Shorter batches are cheaper element by element.
+                    constexpr static const std::size_t batch_kernel_threshold = 8;
+                }    // namespace detail
+
+                /*!
+                 * @brief r[i] = a[i] * b[i] for i < n.
+                 *
+                 * The batch functions below multiply prime field elements 8 at a time with AVX-512 IFMA when the
+                 * CPU has it and the field takes 4 to 6 limbs, and fall back to the element operators otherwise.
+                 * Results may alias the operands element by element.
+                 */
+                template<typename ValueType>
+                void mul_n(ValueType *r, const ValueType *a, const ValueType *b, std::size_t n) {
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                    typedef detail::batch_kernel_traits<ValueType> traits;
+                    if constexpr (traits::value) {
+                        if (n >= detail::batch_kernel_threshold && traits::is_supported()) {
+                            traits::kernel_type::template mul_n<traits::limbs_count>(
+                                traits::limbs(r), traits::stride, traits::limbs(a), traits::stride, traits::limbs(b),
+                                traits::stride, n, traits::params());
+                            return;
+                        }
+                    }
+#endif
+                    for (std::size_t i = 0; i < n; ++i) {
+                        r[i] = a[i] * b[i];
+                    }
+                }
+
+                /*!
+                 * @brief r[i] = a[i] * c for i < n.
+                 */
+                template<typename ValueType>
+                void mul_n(ValueType *r, const ValueType *a, const ValueType &c, std::size_t n) {
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                    typedef detail::batch_kernel_traits<ValueType> traits;
+                    if constexpr (traits::value) {
+                        if (n >= detail::batch_kernel_threshold && traits::is_supported()) {
+                            traits::kernel_type::template mul_n<traits::limbs_count>(
+                                traits::limbs(r), traits::stride, traits::limbs(a), traits::stride, traits::limbs(&c),
+                                0, n, traits::params());
+                            return;
+                        }
+                    }
+#endif
+                    for (std::size_t i = 0; i < n; ++i) {
+                        r[i] = a[i] * c;
+                    }
+                }
+
+                /*!
+                 * @brief r[i] += a[i] * b[i] for i < n.
+                 */
+                template<typename ValueType>
+                void fma_n(ValueType *r, const ValueType *a, const ValueType *b, std::size_t n) {
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                    typedef detail::batch_kernel_traits<ValueType> traits;
+                    if constexpr (traits::value) {
+                        if (n >= detail::batch_kernel_threshold && traits::is_supported()) {
+                            traits::kernel_type::template fma_n<traits::limbs_count>(
+                                traits::limbs(r), traits::stride, traits::limbs(a), traits::stride, traits::limbs(b),
+                                traits::stride, n, traits::params());
+                            return;
+                        }
+                    }
+#endif
+                    for (std::size_t i = 0; i < n; ++i) {
+                        r[i] += a[i] * b[i];
+                    }
+                }
+
+                /*!
+                 * @brief Radix-2 butterflies (u[i], v[i]) = (u[i] + v[i] * w, u[i] - v[i] * w) for i < n, with
+                 * the twiddle w = w[i * w_stride].
+                 */
+                template<typename ValueType>
+                void butterfly_n(ValueType *u, ValueType *v, const ValueType *w, std::size_t w_stride,
+                                 std::size_t n) {
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                    typedef detail::batch_kernel_traits<ValueType> traits;
+                    if constexpr (traits::value) {
+                        if (n >= detail::batch_kernel_threshold && traits::is_supported()) {
+                            traits::kernel_type::template butterfly_n<traits::limbs_count>(
+                                traits::limbs(u), traits::stride, traits::limbs(v), traits::stride, traits::limbs(w),
+                                w_stride * traits::stride, n, traits::params());
+                            return;
+                        }
+                    }
+#endif
+                    for (std::size_t i = 0; i < n; ++i) {
+                        ValueType t = v[i];
+                        t *= w[i * w_stride];
+                        v[i] = u[i];
+                        v[i] -= t;
+                        u[i] += t;
+                    }
+                }
+            }    // namespace fields
+        }    // namespace algebra
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_BATCH_OPERATIONS_HPP
@@ -29,6 +29,7 @@
 #include <iostream>
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
+#include <nil/crypto3/algebra/fields/detail/sqrt_tables.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
 
 #include <nil/crypto3/multiprecision/ressol.hpp>
@@ -241,7 +242,12 @@ namespace nil {
                         constexpr element_fp sqrt() const {
                             if (this->is_zero())
                                 return zero();
-                            element_fp result = ressol(data);
+                            element_fp result;
+                            if (std::is_constant_evaluated()) {
+                                result = ressol(data);
+                            } else {
+                                result = sqrt_tables<element_fp>::instance().sqrt(*this);
+                            }
                             assert(!result.is_zero());
                             return result;
                         }
@@ -255,17 +261,20 @@ namespace nil {
                         }
 
                         constexpr element_fp squared() const {
-                            return element_fp(data * data);    // maybe can be done more effective
+                            element_fp result = *this;
+                            result.square_inplace();
+                            return result;
                         }
 
                         constexpr element_fp &square_inplace() {
-                            data *= data;
+                            eval_square(data.backend());
                             return *this;
                         }
 
+                        // The Legendre symbol by the binary Jacobi algorithm, much cheaper than the Euler criterion
+                        // exponentiation.
                         constexpr bool is_square() const {
-                            element_fp tmp = this->pow(policy_type::group_order_minus_one_half);
-                            return (tmp.is_one() || tmp.is_zero());
+                            return boost::multiprecision::jacobi(to_integral(), modulus) != -1;
                         }
 
                         template<typename PowerType,
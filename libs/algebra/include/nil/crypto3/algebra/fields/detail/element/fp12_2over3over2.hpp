@@ -27,6 +27,9 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP12_2OVER3OVER2_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
 
@@ -276,6 +279,164 @@ namespace nil {
                             return element_fp12_2over3over2(underlying_type(z0, z4, z3), underlying_type(z2, z1, z5));
                         }
 
+                        /** @brief Karabina's squaring of a cyclotomic element in compressed form
+                         *
+                         * Reads and computes only data[0].data[1], data[0].data[2], data[1].data[0] and
+                         * data[1].data[2], with six Fp2 squarings. The remaining two coordinates are left zero
+                         * and are recovered by batch_decompress_karabina. Policies with an fp12_fast backend
+                         * compute the same formulas on lazily reduced Fp2 products.
+                         * https://eprint.iacr.org/2010/542.pdf
+                         */
+                        element_fp12_2over3over2 cyclotomic_squared_compressed() const {
+                            if constexpr (requires { policy_type::cyclotomic_squared_compressed(*this); }) {
+                                return policy_type::cyclotomic_squared_compressed(*this);
+                            }
+
+                            using fp2_type = typename underlying_type::underlying_type;
+
+                            const fp2_type &g1 = data[0].data[1];
+                            const fp2_type &g2 = data[0].data[2];
+                            const fp2_type &g3 = data[1].data[0];
+                            const fp2_type &g5 = data[1].data[2];
+
+                            const fp2_type g1_squared = g1.squared();
+                            const fp2_type g2_squared = g2.squared();
+                            const fp2_type g3_squared = g3.squared();
+                            const fp2_type g5_squared = g5.squared();
+
+                            // 2 * g1 * g5 and 2 * g2 * g3
+                            const fp2_type g1_g5 = (g1 + g5).squared() - g1_squared - g5_squared;
+                            const fp2_type g2_g3 = (g2 + g3).squared() - g2_squared - g3_squared;
+
+                            fp2_type tmp;
+                            element_fp12_2over3over2 result = zero();
+
+                            // h1 = 3 * (g3^2 + xi * g2^2) - 2 * g1
+                            tmp = g3_squared + underlying_type::non_residue * g2_squared;
+                            result.data[0].data[1] = tmp - g1;
+                            result.data[0].data[1] = result.data[0].data[1] + result.data[0].data[1] + tmp;
+
+                            // h2 = 3 * (g1^2 + xi * g5^2) - 2 * g2
+                            tmp = g1_squared + underlying_type::non_residue * g5_squared;
+                            result.data[0].data[2] = tmp - g2;
+                            result.data[0].data[2] = result.data[0].data[2] + result.data[0].data[2] + tmp;
+
+                            // h3 = 3 * xi * 2 * g1 * g5 + 2 * g3
+                            tmp = underlying_type::non_residue * g1_g5;
+                            result.data[1].data[0] = tmp + g3;
+                            result.data[1].data[0] = result.data[1].data[0] + result.data[1].data[0] + tmp;
+
+                            // h5 = 3 * 2 * g2 * g3 + 2 * g5
+                            result.data[1].data[2] = g2_g3 + g5;
+                            result.data[1].data[2] = result.data[1].data[2] + result.data[1].data[2] + g2_g3;
+
+                            return result;
+                        }
+
+                        /** @brief Recovers the coordinates dropped by cyclotomic_squared_compressed
+                         *
+                         * g4 = (xi * g5^2 + 3 * g1^2 - 2 * g2) / (4 * g3), or 2 * g1 * g5 / g2 when g3 = 0, with
+                         * the divisions of all elements sharing one inversion, and then
+                         * g0 = xi * (2 * g4^2 + g3 * g5 - 3 * g1 * g2) + 1.
+                         */
+                        static void batch_decompress_karabina(std::vector<element_fp12_2over3over2> &elements) {
+                            using fp2_type = typename underlying_type::underlying_type;
+
+                            if (elements.empty()) {
+                                return;
+                            }
+
+                            std::vector<fp2_type> numerators(elements.size());
+                            std::vector<fp2_type> denominators(elements.size());
+                            for (std::size_t i = 0; i < elements.size(); ++i) {
+                                const fp2_type &g1 = elements[i].data[0].data[1];
+                                const fp2_type &g2 = elements[i].data[0].data[2];
+                                const fp2_type &g3 = elements[i].data[1].data[0];
+                                const fp2_type &g5 = elements[i].data[1].data[2];
+
+                                if (!g3.is_zero()) {
+                                    const fp2_type g1_squared = g1.squared();
+                                    fp2_type tmp = g1_squared - g2;
+                                    numerators[i] = underlying_type::non_residue * g5.squared() + tmp + tmp +
+                                                    g1_squared;
+                                    denominators[i] = g3 + g3;
+                                    denominators[i] = denominators[i] + denominators[i];
+                                } else if (!g2.is_zero()) {
+                                    numerators[i] = g1 * g5;
+                                    numerators[i] = numerators[i] + numerators[i];
+                                    denominators[i] = g2;
+                                } else {
+                                    // g2 = g3 = 0 only for the identity.
+                                    numerators[i] = fp2_type::zero();
+                                    denominators[i] = fp2_type::one();
+                                }
+                            }
+
+                            // Montgomery's trick: one inversion for all denominators.
+                            std::vector<fp2_type> prefix(elements.size());
+                            prefix[0] = denominators[0];
+                            for (std::size_t i = 1; i < elements.size(); ++i) {
+                                prefix[i] = prefix[i - 1] * denominators[i];
+                            }
+                            fp2_type inverse = prefix.back().inversed();
+                            for (std::size_t i = elements.size() - 1; i > 0; --i) {
+                                const fp2_type denominator_inverse = inverse * prefix[i - 1];
+                                inverse = inverse * denominators[i];
+                                denominators[i] = denominator_inverse;
+                            }
+                            denominators[0] = inverse;
+
+                            for (std::size_t i = 0; i < elements.size(); ++i) {
+                                element_fp12_2over3over2 &element = elements[i];
+                                const fp2_type &g1 = element.data[0].data[1];
+                                const fp2_type &g2 = element.data[0].data[2];
+                                const fp2_type &g3 = element.data[1].data[0];
+                                const fp2_type &g5 = element.data[1].data[2];
+
+                                if (g2.is_zero() && g3.is_zero()) {
+                                    element = one();
+                                    continue;
+                                }
+
+                                const fp2_type g4 = numerators[i] * denominators[i];
+                                const fp2_type g1_g2 = g1 * g2;
+                                fp2_type tmp = g4.squared() - g1_g2;
+                                tmp = tmp + tmp - g1_g2 + g3 * g5;
+
+                                element.data[1].data[1] = g4;
+                                element.data[0].data[0] = underlying_type::non_residue * tmp + fp2_type::one();
+                            }
+                        }
+
+                        /** @brief Cyclotomic exponentiation with Karabina's compressed squarings
+                         *
+                         * The powers this^(2^i) for the set bits of the exponent are decompressed together before
+                         * they are multiplied, which suits the sparse exponents of the final exponentiation.
+                         */
+                        template<typename PowerType>
+                        element_fp12_2over3over2 cyclotomic_exp_compressed(const PowerType &exponent) const {
+                            if (exponent == 0) {
+                                return one();
+                            }
+
+                            std::vector<element_fp12_2over3over2> powers;
+                            element_fp12_2over3over2 power = *this;
+                            for (std::size_t i = 1, bits = msb(exponent); i <= bits; ++i) {
+                                power = power.cyclotomic_squared_compressed();
+                                if (bit_test(exponent, i)) {
+                                    powers.push_back(power);
+                                }
+                            }
+                            batch_decompress_karabina(powers);
+
+                            element_fp12_2over3over2 res = bit_test(exponent, 0) ? *this : one();
+                            for (const element_fp12_2over3over2 &p : powers) {
+                                res *= p;
+                            }
+
+                            return res;
+                        }
+
                         /** @brief Square-and-multiply exponentiation, with cyclotomic_square */
                         template<typename PowerType>
                         element_fp12_2over3over2 cyclotomic_exp(const PowerType &exponent) const {
@@ -274,5 +274,59 @@ namespace nil::crypto3::algebra::fields::detail::fp12_fast {
 
             return ret;
         }
+
+        template<typename Fp12Value>
+        static Fp12Value cyclotomic_squared_compressed(const Fp12Value &x) {
+            // Karabina's compressed squaring, see element_fp12_2over3over2::cyclotomic_squared_compressed.
+            // With g1 = x.data[0].data[1], g2 = x.data[0].data[2], g3 = x.data[1].data[0] and
+            // g5 = x.data[1].data[2]:
+            //   h1 = 3 * (g3^2 + xi * g2^2) - 2 * g1
+            //   h2 = 3 * (g1^2 + xi * g5^2) - 2 * g2
+            //   h3 = 3 * xi * 2 * g1 * g5 + 2 * g3
+            //   h5 = 3 * 2 * g2 * g3 + 2 * g5
+            //
+            // The six Fp2 products and the xi folds stay in the lazy doubled representation, so each of
+            // the four bracketed terms takes one reduction per coefficient.
+            using non_residue_type = typename Params::non_residue_type;
+
+            const non_residue_type &g1 = x.data[0].data[1];
+            const non_residue_type &g2 = x.data[0].data[2];
+            const non_residue_type &g3 = x.data[1].data[0];
+            const non_residue_type &g5 = x.data[1].data[2];
+
+            const fp2_base g1_base(g1), g2_base(g2), g3_base(g3), g5_base(g5);
+            fp2_dbl g1_squared, g2_squared, g3_squared, g5_squared, g1_g5, g2_g3;
+            fp2_dbl::mul_pre(g1_squared, g1_base, g1_base);
+            fp2_dbl::mul_pre(g2_squared, g2_base, g2_base);
+            fp2_dbl::mul_pre(g3_squared, g3_base, g3_base);
+            fp2_dbl::mul_pre(g5_squared, g5_base, g5_base);
+            fp2_dbl::mul_pre(g1_g5, g1_base, g5_base);
+            fp2_dbl::mul_pre(g2_g3, g2_base, g3_base);
+            g1_g5 += g1_g5;
+            g2_g3 += g2_g3;
+
+            // g2_squared = g3^2 + xi * g2^2, g5_squared = g1^2 + xi * g5^2, g1_g5 = xi * 2 * g1 * g5
+            fp2_dbl::mul_xi_add(g2_squared, g2_squared, g3_squared);
+            fp2_dbl::mul_xi_add(g5_squared, g5_squared, g1_squared);
+            fp2_dbl::mul_xi_add(g1_g5, g1_g5, fp2_dbl());
+
+            non_residue_type t1, t2, t3, t5;
+            g2_squared.to_non_residue(t1);
+            g5_squared.to_non_residue(t2);
+            g1_g5.to_non_residue(t3);
+            g2_g3.to_non_residue(t5);
+
+            Fp12Value ret = Fp12Value::zero();
+            ret.data[0].data[1] = t1 - g1;
+            ret.data[0].data[1] = ret.data[0].data[1] + ret.data[0].data[1] + t1;
+            ret.data[0].data[2] = t2 - g2;
+            ret.data[0].data[2] = ret.data[0].data[2] + ret.data[0].data[2] + t2;
+            ret.data[1].data[0] = t3 + g3;
+            ret.data[1].data[0] = ret.data[1].data[0] + ret.data[1].data[0] + t3;
+            ret.data[1].data[2] = t5 + g5;
+            ret.data[1].data[2] = ret.data[1].data[2] + ret.data[1].data[2] + t5;
+
+            return ret;
+        }
     };
 }    // namespace nil::crypto3::algebra::fields::detail::fp12_fast
@@ -292,9 +292,14 @@ namespace nil {
                             data[1] = AB + AB;
                         }
 
+                        // An element is a square iff its norm is a square in the underlying field.
                         constexpr bool is_square() const {
-                            element_fp2 tmp = this->pow(field_type::extension_policy::group_order_minus_one_half);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            return norm().is_square();
+                        }
+
+                        // N(A0 + A1 * u) = A0^2 - non_residue * A1^2
+                        constexpr underlying_type norm() const {
+                            return data[0].squared() - non_residue * data[1].squared();
                         }
 
                         template<typename PowerType>
@@ -236,9 +236,19 @@ namespace nil {
                             (*this) *= (*this);
                         }
 
+                        // An element is a square iff its norm is a square in the underlying field.
                         constexpr bool is_square() const {
-                            element_fp3 tmp = this->pow(field_type::extension_policy::group_order_minus_one_half);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            return norm().is_square();
+                        }
+
+                        // The determinant of multiplication by the element, the same value inversed() divides by.
+                        constexpr underlying_type norm() const {
+                            const underlying_type &A0 = data[0], &A1 = data[1], &A2 = data[2];
+
+                            const underlying_type c0 = A0.squared() - non_residue * (A1 * A2);
+                            const underlying_type c1 = non_residue * A2.squared() - A0 * A1;
+                            const underlying_type c2 = A1.squared() - A0 * A2;
+                            return A0 * c0 + non_residue * (A2 * c1 + A1 * c2);
                         }
 
                         template<typename PowerType>
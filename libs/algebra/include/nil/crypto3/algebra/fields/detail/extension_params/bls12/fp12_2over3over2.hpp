@@ -112,6 +112,12 @@ namespace nil::crypto3::algebra::fields::detail {
         static Fp12Value multiply(const Fp12Value &x, const Fp12Value &y) {
             return fp12_fast::fp12_fast<fast_params>::multiply(x, y);
         }
+
+        // Karabina's compressed cyclotomic squaring over the same lazy Fp2 kernels
+        template<typename Fp12Value>
+        static Fp12Value cyclotomic_squared_compressed(const Fp12Value &x) {
+            return fp12_fast::fp12_fast<fast_params>::cyclotomic_squared_compressed(x);
+        }
     };
 
     /************************* BLS12-377 ***********************************/
@@ -184,6 +190,12 @@ namespace nil::crypto3::algebra::fields::detail {
         static Fp12Value multiply(const Fp12Value &x, const Fp12Value &y) {
             return fp12_fast::fp12_fast<fast_params>::multiply(x, y);
         }
+
+        // Karabina's compressed cyclotomic squaring over the same lazy Fp2 kernels
+        template<typename Fp12Value>
+        static Fp12Value cyclotomic_squared_compressed(const Fp12Value &x) {
+            return fp12_fast::fp12_fast<fast_params>::cyclotomic_squared_compressed(x);
+        }
     };
 
     constexpr typename fp12_2over3over2_extension_params<bls12_base_field<381>>::non_residue_type const
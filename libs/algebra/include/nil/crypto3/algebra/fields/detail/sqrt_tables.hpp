@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_SQRT_TABLES_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_SQRT_TABLES_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/ressol.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /*!
+                     * @brief Per-field data for square roots in a prime field, built on first use.
+                     *
+                     * With p - 1 = t * 2^s, p = 3 mod 4 and p = 5 mod 8 take a single exponentiation. Otherwise the
+                     * root is found by the table-driven Tonelli-Shanks of Sarkar ("Computing square roots faster
+                     * than the Tonelli-Shanks/Bernstein algorithm", https://eprint.iacr.org/2020/1407): after one
+                     * exponentiation the discrete logarithm of a^t to the base g = z^t is recovered window_bits bits
+                     * at a time by table lookups, instead of the s^2 / 2 squarings of the plain algorithm.
+                     *
+                     * Every path returns the root ressol() picks, so square roots do not depend on whether they are
+                     * constant evaluated: a^((t + 1) / 2) * g^m with m < 2^(s - 1).
+                     */
+                    template<typename FieldValueType>
+                    class sqrt_tables {
+                        typedef FieldValueType value_type;
+                        typedef typename value_type::integral_type integral_type;
+
+                    public:
+                        constexpr static const std::size_t window_bits = 8;
+                        // The discrete logarithms of the Tonelli-Shanks path are kept in 64 bits.
+                        constexpr static const std::size_t max_two_adicity = 63;
+                        constexpr static const std::size_t max_windows_count =
+                            (max_two_adicity + window_bits - 1) / window_bits;
+
+                        static const sqrt_tables &instance() {
+                            static const sqrt_tables tables;
+                            return tables;
+                        }
+
+                        /*!
+                         * @brief Square root of a non-zero element, the same one ressol() returns. Returns zero if
+                         * a is not a square.
+                         */
+                        value_type sqrt(const value_type &a) const {
+                            value_type result;
+                            switch (method) {
+                                case method_type::three_mod_four:
+                                    result = a.pow(exponent);
+                                    break;
+                                case method_type::five_mod_eight: {
+                                    // s = 2, so a^t = +-1 and a single Tonelli-Shanks step fixes the sign.
+                                    const value_type x = a.pow(exponent);
+                                    result = a * x;
+                                    if (result * x != value_type::one()) {
+                                        result *= g;
+                                    }
+                                    break;
+                                }
+                                case method_type::tonelli_shanks:
+                                    result = tonelli_shanks(a);
+                                    break;
+                                case method_type::generic:
+                                    result = value_type(ressol(a.data));
+                                    break;
+                            }
+                            return result.squared() == a ? result : value_type::zero();
+                        }
+
+                    private:
+                        enum class method_type { three_mod_four, five_mod_eight, tonelli_shanks, generic };
+
+                        sqrt_tables() {
+                            const integral_type &p = value_type::modulus;
+                            s = boost::multiprecision::lsb(integral_type(p - 1u));
+                            if (s == 1) {
+                                // (p + 1) / 4
+                                method = method_type::three_mod_four;
+                                exponent = (p >> 2) + 1u;
+                                return;
+                            }
+                            if (s > max_two_adicity) {
+                                method = method_type::generic;
+                                return;
+                            }
+
+                            // (t - 1) / 2
+                            exponent = p >> (s + 1);
+                            // g = z^t for the smallest non-square z, as in ressol().
+                            value_type z = value_type(2u);
+                            while (z.is_square()) {
+                                z += value_type::one();
+                            }
+                            g = z.pow(integral_type(p >> s));
+
+                            if (s == 2) {
+                                method = method_type::five_mod_eight;
+                            } else {
+                                method = method_type::tonelli_shanks;
+                                init_tonelli_shanks();
+                            }
+                        }
+
+                        void init_tonelli_shanks() {
+
+                            window = std::min<std::size_t>(s, window_bits);
+                            windows_count = (s + window - 1) / window;
+                            first_window = s - (windows_count - 1) * window;
+
+                            // g_powers[k][j] = g^(j * 2^(k * window))
+                            value_type g_k = g;
+                            g_powers.resize(windows_count);
+                            for (std::size_t k = 0; k < windows_count; ++k) {
+                                g_powers[k].resize(std::size_t(1) << window);
+                                g_powers[k][0] = value_type::one();
+                                for (std::size_t j = 1; j < g_powers[k].size(); ++j) {
+                                    g_powers[k][j] = g_powers[k][j - 1] * g_k;
+                                }
+                                for (std::size_t i = 0; i < window; ++i) {
+                                    g_k = g_k.squared();
+                                }
+                            }
+
+                            // h = g^(2^(s - window)) generates the 2^window-th roots of unity, h_powers[j] = h^j is
+                            // looked up through its lowest limb.
+                            value_type h = g;
+                            for (std::size_t i = 0; i < s - window; ++i) {
+                                h = h.squared();
+                            }
+                            h_powers.resize(std::size_t(1) << window);
+                            h_powers[0] = value_type::one();
+                            for (std::size_t j = 1; j < h_powers.size(); ++j) {
+                                h_powers[j] = h_powers[j - 1] * h;
+                            }
+                            for (std::size_t j = 0; j < h_powers.size(); ++j) {
+                                h_lookup.emplace_back(lookup_key(h_powers[j]), j);
+                            }
+                            std::sort(h_lookup.begin(), h_lookup.end());
+                        }
+
+                        static std::uint64_t lookup_key(const value_type &x) {
+                            return static_cast<std::uint64_t>(x.data.backend().base_data().limbs()[0]);
+                        }
+
+                        // j with x = h^j, or h_powers.size() if x is not a 2^window-th root of unity.
+                        std::size_t discrete_log_h(const value_type &x) const {
+                            const std::uint64_t key = lookup_key(x);
+                            auto it = std::lower_bound(h_lookup.begin(), h_lookup.end(),
+                                                       std::make_pair(key, std::size_t(0)));
+                            for (; it != h_lookup.end() && it->first == key; ++it) {
+                                if (h_powers[it->second] == x) {
+                                    return it->second;
+                                }
+                            }
+                            return h_powers.size();
+                        }
+
+                        // g^(-e mod 2^bits), bits <= s.
+                        value_type g_pow_negated(std::uint64_t e, std::size_t bits) const {
+                            const std::uint64_t mask = (std::uint64_t(1) << bits) - 1;
+                            e = (mask + 1 - (e & mask)) & mask;
+
+                            value_type result = value_type::one();
+                            const std::uint64_t digit_mask = (std::uint64_t(1) << window) - 1;
+                            for (std::size_t k = 0; k < windows_count; ++k) {
+                                const std::uint64_t digit = (e >> (k * window)) & digit_mask;
+                                if (digit != 0) {
+                                    result *= g_powers[k][digit];
+                                }
+                            }
+                            return result;
+                        }
+
+                        value_type tonelli_shanks(const value_type &a) const {
+                            const value_type x = a.pow(exponent);
+                            // r = a^((t + 1) / 2), c = a^t = g^e for some e < 2^s, and a is a square iff e is even.
+                            const value_type r = a * x;
+                            const value_type c = r * x;
+
+                            // c_powers[k] = c^(2^((windows_count - 1 - k) * window))
+                            std::array<value_type, max_windows_count> c_powers;
+                            c_powers[windows_count - 1] = c;
+                            for (std::size_t k = windows_count - 1; k > 0; --k) {
+                                c_powers[k - 1] = c_powers[k];
+                                for (std::size_t i = 0; i < window; ++i) {
+                                    c_powers[k - 1].square_inplace();
+                                }
+                            }
+
+                            // Window k holds the bits of e from position first_window + (k - 1) * window, the
+                            // lowest window is first_window bits wide. Raising c * g^(-known bits of e) to the
+                            // power 2^(s - position - width) leaves h^(bits of window k).
+                            std::uint64_t e = 0;
+                            for (std::size_t k = 0; k < windows_count; ++k) {
+                                value_type v = c_powers[k];
+                                if (e != 0) {
+                                    v *= g_pow_negated(e << ((windows_count - 1 - k) * window), s);
+                                }
+                                std::size_t digit = discrete_log_h(v);
+                                if (digit == h_powers.size()) {
+                                    return value_type::zero();
+                                }
+                                if (k == 0) {
+                                    digit >>= window - first_window;
+                                    e = digit;
+                                } else {
+                                    e |= std::uint64_t(digit) << (first_window + (k - 1) * window);
+                                }
+                            }
+
+                            if (e & 1u) {
+                                return value_type::zero();
+                            }
+                            // Both g^(-e / 2) and g^(2^(s - 1) - e / 2) = -g^(-e / 2) square to g^(-e), ressol()
+                            // ends up with the exponent below 2^(s - 1).
+                            return r * g_pow_negated(e >> 1, s - 1);
+                        }
+
+                        method_type method;
+                        integral_type exponent;
+                        value_type g;
+
+                        std::size_t s = 0;
+                        std::size_t window = 0;
+                        std::size_t windows_count = 0;
+                        std::size_t first_window = 0;
+                        std::vector<std::vector<value_type>> g_powers;
+                        std::vector<value_type> h_powers;
+                        std::vector<std::pair<std::uint64_t, std::size_t>> h_lookup;
+                    };
+                }    // namespace detail
+            }    // namespace fields
+        }    // namespace algebra
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_SQRT_TABLES_HPP
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_UNREDUCED_ACCUMULATOR_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_UNREDUCED_ACCUMULATOR_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                /*!
+                 * @brief Linear combination of field elements with a single final reduction.
+                 *
+                 * For prime field elements on a multi-limb Montgomery backend the products are accumulated at
+                 * double width and reduced once in reduce(), instead of once per product. Other element types,
+                 * extension fields and single-limb fields among them, fall back to eager arithmetic.
+                 */
+                template<typename ValueType, typename = void>
+                class unreduced_accumulator {
+                public:
+                    typedef ValueType value_type;
+
+                    constexpr unreduced_accumulator() : sum(value_type::zero()) {
+                    }
+
+                    // sum += a * b.
+                    constexpr void mul_add(const value_type &a, const value_type &b) {
+                        sum += a * b;
+                    }
+
+                    // sum += a.
+                    constexpr void add(const value_type &a) {
+                        sum += a;
+                    }
+
+                    constexpr value_type reduce() const {
+                        return sum;
+                    }
+
+                private:
+                    value_type sum;
+                };
+
+                template<typename FieldParams>
+                class unreduced_accumulator<
+                    detail::element_fp<FieldParams>,
+                    std::enable_if_t<!boost::multiprecision::backends::is_trivial_cpp_int_modular<
+                        typename detail::element_fp<FieldParams>::modular_backend>::value>> {
+                public:
+                    typedef detail::element_fp<FieldParams> value_type;
+
+                    constexpr void mul_add(const value_type &a, const value_type &b) {
+                        value_type::modulus_params.get_mod_obj().montgomery_accumulate(
+                            accumulator, a.data.backend().base_data(), b.data.backend().base_data());
+                    }
+
+                    constexpr void add(const value_type &a) {
+                        value_type::modulus_params.get_mod_obj().montgomery_accumulate(accumulator,
+                                                                                       a.data.backend().base_data());
+                    }
+
+                    constexpr value_type reduce() const {
+                        value_type result;
+                        value_type::modulus_params.get_mod_obj().montgomery_reduce_accumulator(
+                            result.data.backend().base_data(), accumulator);
+                        return result;
+                    }
+
+                private:
+                    typedef std::remove_cvref_t<decltype(value_type::modulus_params.get_mod_obj())> mod_obj_type;
+
+                    typename mod_obj_type::montgomery_accumulator_type accumulator;
+                };
+            }    // namespace fields
+        }    // namespace algebra
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_UNREDUCED_ACCUMULATOR_HPP
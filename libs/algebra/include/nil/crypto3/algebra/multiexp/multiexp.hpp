@@ -32,6 +32,7 @@
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
 
@@ -232,29 +233,16 @@ namespace nil {
                 return res;
             }
 
+            // Special form is Z = 1, see batch_normalize. Pairs of points such as knowledge commitments bring
+            // their own batch_to_special_all_non_zeros.
             template<typename GroupType, typename InputRange>
             typename std::enable_if<
                 std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
                 batch_to_special(InputRange &vec) {
-
-                std::vector<typename GroupType::value_type> non_zero_vec;
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        non_zero_vec.emplace_back(vec[i]);
-                    }
-                }
-
-                GroupType::batch_to_special_all_non_zeros(non_zero_vec);
-                typename std::vector<typename GroupType::value_type>::const_iterator it = non_zero_vec.begin();
-                typename GroupType::value_type zero_special = GroupType::value_type::zero().to_projective();
-
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        vec[i] = *it;
-                        ++it;
-                    } else {
-                        vec[i] = zero_special;
-                    }
+                if constexpr (requires { GroupType::batch_to_special_all_non_zeros(vec); }) {
+                    GroupType::batch_to_special_all_non_zeros(vec);
+                } else {
+                    batch_normalize(vec);
                 }
             }
         }    // namespace algebra
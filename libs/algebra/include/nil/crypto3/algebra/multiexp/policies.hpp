@@ -32,6 +32,7 @@
 #include <boost/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/wnaf.hpp>
 
 namespace nil {
@@ -94,7 +95,7 @@ namespace nil {
                  * (https://eprint.iacr.org/2012/549.pdf)
                  * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
                  * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
-                 * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * .mixed_add() and a Z = 1 form for batch_normalize()).
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -167,7 +168,7 @@ namespace nil {
                             }
 
 #ifdef USE_MIXED_ADDITION
-                            batch_to_special(buckets);
+                            batch_normalize(buckets);
 #endif
 
                             base_value_type running_sum;
@@ -71,7 +71,7 @@ namespace nil {
 
                     static typename gt_type::value_type exp_by_z(const typename gt_type::value_type &elt) {
 
-                        typename gt_type::value_type result = elt.cyclotomic_exp(params_type::final_exponent_z);
+                        typename gt_type::value_type result = elt.cyclotomic_exp_compressed(params_type::final_exponent_z);
                         if (params_type::final_exponent_is_z_neg) {
                             result = result.unitary_inversed();
                         }
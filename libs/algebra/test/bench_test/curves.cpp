@@ -41,6 +41,7 @@
 #include <nil/crypto3/algebra/curves/babyjubjub.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/detail/constant_time_scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/ed25519.hpp>
 #include <nil/crypto3/algebra/curves/jubjub.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
@@ -97,6 +98,18 @@ void benchmark_curve_operations(std::string const& curve_name) {
     run_benchmark<g1_type, scalar_field>(
         bench_name("G1 scalar multiplication"),
         [](typename g1_type::value_type& A, typename scalar_field::value_type const& B) { return A *= B; });
+    run_benchmark<g1_type, scalar_field>(
+        bench_name("G1 constant-time mul"),
+        [](typename g1_type::value_type& A, typename scalar_field::value_type const& B) {
+            curves::detail::scalar_mul_constant_time_inplace(
+                A, static_cast<typename scalar_field::integral_type>(B.to_integral()));
+            return A;
+        });
+    run_benchmark<g1_type, scalar_field>(
+        bench_name("G1 generator comb mul"),
+        [](typename g1_type::value_type& A, typename scalar_field::value_type const& B) {
+            return A = curves::detail::fixed_base_mul<typename g1_type::value_type>(B);
+        });
 
     if constexpr (has_type_g2_type<curve_type>::value) {
         using g2_type = typename curve_type::template g2_type<>;
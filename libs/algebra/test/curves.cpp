@@ -39,6 +39,7 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/edwards.hpp>
@@ -50,12 +51,14 @@
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
 #include <nil/crypto3/algebra/curves/ed25519.hpp>
 #include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/detail/constant_time_scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
@@ -674,4 +677,103 @@ BOOST_AUTO_TEST_CASE(twisted_edwards_extended_order_test) {
     BOOST_CHECK_EQUAL(check, g1_type::value_type::zero());
 }
 
+template<typename CurveGroup>
+struct batch_normalize_runner {
+    bool static run() {
+        using value_type = typename CurveGroup::value_type;
+
+        // Projective points with distinct Z, and the zero point in the middle.
+        std::vector<value_type> points;
+        value_type point = value_type::one();
+        for (std::size_t i = 0; i < 9; ++i) {
+            points.push_back(point);
+            point.double_inplace();
+            point += value_type::one();
+        }
+        points.insert(points.begin() + 4, value_type::zero());
+
+        const auto affine_points = batch_to_affine(points);
+        BOOST_CHECK_EQUAL(affine_points.size(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            BOOST_CHECK(affine_points[i] == points[i].to_affine());
+        }
+
+        std::vector<value_type> normalized = points;
+        batch_normalize(normalized);
+        value_type sum = value_type::zero(), mixed_sum = value_type::zero();
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            BOOST_CHECK_EQUAL(normalized[i], points[i]);
+            BOOST_CHECK(normalized[i].to_affine() == points[i].to_affine());
+            if (!points[i].is_zero()) {
+                BOOST_CHECK(normalized[i].Z == decltype(normalized[i].Z)::one());
+            }
+
+            // The mixed addition formulas take the normalized point as the Z = 1 operand.
+            sum += points[i];
+            mixed_sum.mixed_add(normalized[i]);
+            BOOST_CHECK_EQUAL(mixed_sum, sum);
+        }
+        return true;
+    }
+};
+
+using batch_normalize_runners = boost::mpl::list<
+    batch_normalize_runner<curves::secp_k1<256>::g1_type<>>,
+    batch_normalize_runner<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3,
+                                                         curves::forms::short_weierstrass>>,
+    batch_normalize_runner<curves::bls12_381::g1_type<curves::coordinates::projective>>,
+    batch_normalize_runner<curves::bls12_377::g1_type<curves::coordinates::jacobian>>,
+    batch_normalize_runner<curves::bls12_381::g2_type<>>,
+    batch_normalize_runner<curves::ed25519::g1_type<>>,
+    batch_normalize_runner<curves::edwards<183>::g1_type<curves::coordinates::inverted>>>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(batch_normalize_test, runner, batch_normalize_runners) {
+    BOOST_CHECK(runner::run());
+}
+
+template<typename CurveGroup>
+struct constant_time_scalar_mul_runner {
+    bool static run() {
+        using value_type = typename CurveGroup::value_type;
+        using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+        using scalar_value_type = typename scalar_field_type::value_type;
+        using integral_type = typename scalar_field_type::integral_type;
+
+        // Small scalars hit the digit boundaries of the 4-bit windows, r - 1 and r - 2 the top window.
+        std::vector<scalar_value_type> scalars = {0u, 1u, 2u, 15u, 16u, -scalar_value_type::one(),
+                                                  -scalar_value_type(2u)};
+        for (std::size_t i = 0; i < 8; ++i) {
+            scalars.push_back(random_element<scalar_field_type>());
+        }
+
+        const value_type base = value_type::one() * random_element<scalar_field_type>();
+        const curves::detail::fixed_base_comb<value_type> comb(base);
+
+        for (const scalar_value_type &k : scalars) {
+            const integral_type k_integral = static_cast<integral_type>(k.to_integral());
+
+            value_type point = base;
+            curves::detail::scalar_mul_constant_time_inplace(point, k_integral);
+            BOOST_CHECK_EQUAL(point, base * k);
+
+            BOOST_CHECK_EQUAL(comb(k), base * k);
+            BOOST_CHECK_EQUAL(comb(k_integral), base * k);
+            BOOST_CHECK_EQUAL(curves::detail::fixed_base_mul<value_type>(k), value_type::one() * k);
+        }
+        return true;
+    }
+};
+
+using constant_time_scalar_mul_runners = boost::mpl::list<
+    constant_time_scalar_mul_runner<curves::secp_k1<256>::g1_type<curves::coordinates::jacobian_with_a4_0>>,
+    constant_time_scalar_mul_runner<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3,
+                                                                   curves::forms::short_weierstrass>>,
+    constant_time_scalar_mul_runner<curves::bls12_381::g1_type<curves::coordinates::projective>>,
+    constant_time_scalar_mul_runner<curves::ed25519::g1_type<curves::coordinates::extended_with_a_minus_1,
+                                                             curves::forms::twisted_edwards>>>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(constant_time_scalar_mul_test, runner, constant_time_scalar_mul_runners) {
+    BOOST_CHECK(runner::run());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -35,6 +35,7 @@
 
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
+#include <boost/random/mersenne_twister.hpp>
 
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
@@ -72,6 +73,7 @@
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/secp_k1.hpp>
 #include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 using namespace nil::crypto3::algebra;
 
@@ -384,6 +386,25 @@ void field_not_square_test(const TestSet &test_set) {
     }
 }
 
+template<typename FieldType>
+void field_sqrt_random_test() {
+    using value_type = typename FieldType::value_type;
+
+    boost::random::mt19937 rng(0x5157);
+    for (std::size_t i = 0; i < 256; ++i) {
+        value_type x = nil::crypto3::algebra::random_element<FieldType>(rng);
+        value_type square = x.squared();
+        value_type sqrt = square.sqrt();
+        BOOST_CHECK(sqrt == x || (sqrt + x).is_zero());
+        // The same root as constant evaluation, which goes through ressol.
+        BOOST_CHECK_EQUAL(sqrt, value_type(ressol(square.data)));
+
+        if (x.is_square() && !x.is_zero()) {
+            BOOST_CHECK_EQUAL(x.sqrt().squared(), x);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(fields_manual_tests)
 
 BOOST_DATA_TEST_CASE(field_operation_test_goldilocks, string_data("field_operation_test_goldilocks"), data_set) {
@@ -729,4 +750,22 @@ BOOST_AUTO_TEST_CASE(field_not_square_test_secp_r1) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(field_sqrt_test) {
+    // p = 1 mod 8, tables for the Tonelli-Shanks windows.
+    field_sqrt_random_test<fields::bls12_fr<381>>();
+    field_sqrt_random_test<fields::pallas_scalar_field>();
+    field_sqrt_random_test<fields::goldilocks>();
+    field_sqrt_random_test<fields::babybear>();
+    // p = 3 mod 4.
+    field_sqrt_random_test<fields::bls12_fq<381>>();
+    field_sqrt_random_test<typename curves::secp_k1<256>::base_field_type>();
+    // p = 5 mod 8.
+    field_sqrt_random_test<fields::curve25519_base_field>();
+
+    // sqrt(-486664) scales between the twisted Edwards and Montgomery forms of curve25519.
+    using curve25519_value_type = typename fields::curve25519_base_field::value_type;
+    const curve25519_value_type minus_a_plus_2 = -curve25519_value_type(486664u);
+    BOOST_CHECK_EQUAL(minus_a_plus_2.sqrt(), curve25519_value_type(ressol(minus_a_plus_2.data)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -263,4 +263,35 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(inverse_is_multiplicative_identity, Fp12Field, fp1
     }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(compressed_cyclotomic_exp_matches_cyclotomic_exp, Fp12Field, fp12_field_types) {
+    using fp12_value_type = typename Fp12Field::value_type;
+    using integral_type = typename Fp12Field::integral_type;
+    boost::random::mt19937 rng(0x2543c);
+
+    const std::array<integral_type, 5> exponents = {
+        integral_type(1), integral_type(2), integral_type(0x2b), integral_type(0xd201000000010000ULL),
+        integral_type(0x44e992b44a6909f1ULL)};
+
+    BOOST_TEST_CONTEXT(fp12_field_name<Fp12Field>::value) {
+        for (std::size_t i = 0; i < random_samples / 4; ++i) {
+            fp12_value_type x = random_fp12<Fp12Field>(rng);
+            if (x.is_zero()) {
+                x = fp12_value_type::one();
+            }
+
+            // The easy part of the final exponentiation maps x into the cyclotomic subgroup.
+            const fp12_value_type y = x.unitary_inversed() * x.inversed();
+            const fp12_value_type cyclotomic = y.Frobenius_map(2) * y;
+
+            BOOST_CHECK_EQUAL(cyclotomic.cyclotomic_exp_compressed(integral_type(0)), fp12_value_type::one());
+            BOOST_CHECK_EQUAL(fp12_value_type::one().cyclotomic_exp_compressed(exponents[3]),
+                              fp12_value_type::one());
+            for (const integral_type &exponent : exponents) {
+                BOOST_CHECK_EQUAL(cyclotomic.cyclotomic_exp_compressed(exponent),
+                                  cyclotomic.cyclotomic_exp(exponent));
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
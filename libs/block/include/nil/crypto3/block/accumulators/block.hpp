@@ -25,6 +25,9 @@
 #ifndef CRYPTO3_ACCUMULATORS_BLOCK_HPP
 #define CRYPTO3_ACCUMULATORS_BLOCK_HPP
 
+#include <algorithm>
+#include <array>
+
 #include <boost/container/static_vector.hpp>
 
 #include <boost/parameter/value_type.hpp>
@@ -44,6 +47,7 @@
 #include <nil/crypto3/block/accumulators/parameters/bits.hpp>
 #include <boost/accumulators/framework/parameters/sample.hpp>
 #include <nil/crypto3/block/detail/cipher_modes.hpp>
+#include <nil/crypto3/block/detail/block_batch.hpp>
 
 #include <nil/crypto3/block/cipher.hpp>
 
@@ -72,6 +76,8 @@ namespace nil {
 
                     constexpr static const std::size_t block_bytes = block_bits / CHAR_BIT;
 
+                    constexpr static const std::size_t batch_blocks = 64;
+
                     typedef ::nil::crypto3::detail::injector<endian_type, endian_type, value_bits, block_values>
                         injector_type;
 
@@ -113,6 +119,10 @@ namespace nil {
                         process(value, bits == 0 ? word_bits : bits);
                     }
 
+                    inline void resolve_type(const block::detail::block_batch<block_type> &batch, std::size_t) {
+                        process(batch.blocks, batch.size);
+                    }
+
                     inline void process_block() {
                         using namespace ::nil::crypto3::detail;
 
@@ -123,7 +133,7 @@ namespace nil {
                             processed_block = mode.process_block(cache, total_seen);
                         }
 
-                        dgst = ::nil::crypto3::resize<block_bits>(dgst, dgst.size() + block_values);
+                        dgst.resize(dgst.size() + block_values);
 
                         pack<endian_type, endian_type, value_bits, octet_bits>(
                             processed_block.begin(), processed_block.end(), dgst.end() - block_values);
@@ -131,6 +141,63 @@ namespace nil {
                         filled = false;
                     }
 
+                    /*!
+                     * Whole blocks arriving while the cache is block-aligned are handed to the mode together with the
+                     * pending block. As in process(block), the last block stays pending for result() to finish the
+                     * message with end_message.
+                     */
+                    inline void process(const block_type *blocks, std::size_t size) {
+                        using namespace ::nil::crypto3::detail;
+
+                        if constexpr (block::detail::has_process_blocks<mode_type>()) {
+                            if (total_seen % block_bits == 0) {
+                                if (dgst.empty() && !filled && size != 0) {
+                                    // The first block of the message goes through begin_message
+                                    process(*blocks++, block_bits);
+                                    --size;
+                                }
+
+                                while (size != 0) {
+                                    std::array<block_type, batch_blocks> work;
+                                    std::size_t count = 0;
+                                    if (filled) {
+                                        work[count++] = cache;
+                                        filled = false;
+                                    }
+
+                                    const std::size_t taken = std::min(size - 1, batch_blocks - count);
+                                    std::copy(blocks, blocks + taken, work.begin() + count);
+                                    count += taken;
+                                    blocks += taken;
+                                    size -= taken;
+                                    total_seen += taken * block_bits;
+
+                                    if (count != 0) {
+                                        mode.process_blocks(work.data(), work.data(), count, total_seen);
+
+                                        const std::size_t offset = dgst.size();
+                                        dgst.resize(offset + count * block_values);
+                                        for (std::size_t i = 0; i != count; ++i) {
+                                            pack<endian_type, endian_type, value_bits, octet_bits>(
+                                                work[i].begin(), work[i].end(),
+                                                dgst.begin() + offset + i * block_values);
+                                        }
+                                    }
+
+                                    if (size == 1) {
+                                        process(*blocks++, block_bits);
+                                        --size;
+                                    }
+                                }
+                                return;
+                            }
+                        }
+
+                        for (std::size_t i = 0; i != size; ++i) {
+                            process(blocks[i], block_bits);
+                        }
+                    }
+
                     inline void process(const block_type &value, std::size_t value_seen) {
                         using namespace ::nil::crypto3::detail;
 
@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_BLOCK_DETAIL_BLOCK_BATCH_HPP
+#define CRYPTO3_BLOCK_DETAIL_BLOCK_BATCH_HPP
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            namespace detail {
+                /*!
+                 * @brief A run of whole blocks fed to the block accumulator as one sample, so modes providing
+                 * process_blocks receive all of them in a single call.
+                 */
+                template<typename BlockType>
+                struct block_batch {
+                    const BlockType *blocks;
+                    std::size_t size;
+                };
+
+                template<typename Mode>
+                constexpr bool has_process_blocks() {
+                    return requires(Mode &mode, const typename Mode::block_type *in, typename Mode::block_type *out) {
+                        mode.process_blocks(in, out, std::size_t(), std::size_t());
+                    };
+                }
+            }    // namespace detail
+        }    // namespace block
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_BLOCK_DETAIL_BLOCK_BATCH_HPP
@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_BLOCK_BLOCK_STATE_PREPROCESSOR_HPP
 #define CRYPTO3_BLOCK_BLOCK_STATE_PREPROCESSOR_HPP
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 #include <climits>
@@ -36,6 +37,8 @@
 #include <nil/crypto3/block/accumulators/bits_count.hpp>
 #include <nil/crypto3/block/accumulators/parameters/bits.hpp>
 
+#include <nil/crypto3/block/detail/block_batch.hpp>
+
 #include <boost/integer.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/static_assert.hpp>
@@ -85,6 +88,8 @@ namespace nil {
 
                 BOOST_STATIC_ASSERT(!length_bits || value_bits <= length_bits);
 
+                constexpr static const std::size_t batch_blocks = 64;
+
                 inline void process_block(std::size_t block_seen = block_bits) {
                     using namespace nil::crypto3::detail;
                     // Convert the input into words
@@ -94,6 +99,19 @@ namespace nil {
                     acc(block, accumulators::bits = block_seen);
                 }
 
+                template<typename InputIterator>
+                inline void process_batch(InputIterator &p, std::size_t blocks) {
+                    using namespace nil::crypto3::detail;
+
+                    std::array<block_type, batch_blocks> batch;
+                    for (std::size_t i = 0; i != blocks; ++i) {
+                        pack_to<endian_type, value_bits, actual_bits>(p, p + block_values, batch[i].begin());
+                        p += block_values;
+                    }
+                    acc(detail::block_batch<block_type> {batch.data(), blocks},
+                        accumulators::bits = blocks * block_bits);
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -107,6 +125,17 @@ namespace nil {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
+                    if constexpr (detail::has_process_blocks<mode_type>()) {
+                        for (; n && cache_seen; --n) {
+                            update_one(*p++);
+                        }
+                        // Whole blocks are packed in batches so the mode can keep several of them in flight
+                        while (n >= block_values) {
+                            const std::size_t blocks = std::min(batch_blocks, n / block_values);
+                            process_batch(p, blocks);
+                            n -= blocks * block_values;
+                        }
+                    }
                     for (; n; --n) {
                         update_one(*p++);
                     }
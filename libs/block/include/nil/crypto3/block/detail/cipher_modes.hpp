@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_CIPHER_MODES_HPP
 #define CRYPTO3_CIPHER_MODES_HPP
 
+#include <cstddef>
+
 #include <nil/crypto3/detail/stream_endian.hpp>
 
 namespace nil {
@@ -63,6 +65,17 @@ namespace nil {
                     inline static block_type end_message(const cipher_type &cipher, const block_type &plaintext) {
                         return cipher.encrypt(plaintext);
                     }
+
+                    inline static void process_blocks(const cipher_type &cipher, const block_type *plaintext,
+                                                      block_type *ciphertext, std::size_t blocks) {
+                        if constexpr (requires { cipher.encrypt_blocks(plaintext, ciphertext, blocks); }) {
+                            cipher.encrypt_blocks(plaintext, ciphertext, blocks);
+                        } else {
+                            for (std::size_t i = 0; i != blocks; ++i) {
+                                ciphertext[i] = cipher.encrypt(plaintext[i]);
+                            }
+                        }
+                    }
                 };
 
                 template<typename Cipher, typename Padding>
@@ -81,6 +94,17 @@ namespace nil {
                     inline static block_type end_message(const cipher_type &cipher, const block_type &ciphertext) {
                         return cipher.decrypt(ciphertext);
                     }
+
+                    inline static void process_blocks(const cipher_type &cipher, const block_type *ciphertext,
+                                                      block_type *plaintext, std::size_t blocks) {
+                        if constexpr (requires { cipher.decrypt_blocks(ciphertext, plaintext, blocks); }) {
+                            cipher.decrypt_blocks(ciphertext, plaintext, blocks);
+                        } else {
+                            for (std::size_t i = 0; i != blocks; ++i) {
+                                plaintext[i] = cipher.decrypt(ciphertext[i]);
+                            }
+                        }
+                    }
                 };
 
                 template<typename PolicyType>
@@ -119,6 +143,15 @@ namespace nil {
                         return policy_type::end_message(cipher, plaintext);
                     }
 
+                    /*!
+                     * @brief Processes independent whole blocks in one call, letting the cipher keep several of them
+                     * in flight. Isomorphic modes treat every block alike, so this matches repeated process_block.
+                     */
+                    void process_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                        [[maybe_unused]] std::size_t total_seen) {
+                        policy_type::process_blocks(cipher, in, out, blocks);
+                    }
+
                 protected:
                     cipher_type cipher;
                 };
@@ -26,9 +26,15 @@
 #define CRYPTO3_RIJNDAEL_NI_IMPL_HPP
 
 #include <cstddef>
+#include <cstdint>
 
 #include <wmmintrin.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <nil/crypto3/block/detail/rijndael/rijndael_vaes_impl.hpp>
+#define CRYPTO3_RIJNDAEL_VAES_SELECTED
+#endif
+
 #include <nil/crypto3/detail/make_uint_t.hpp>
 #include <nil/crypto3/detail/pack.hpp>
 #include <nil/crypto3/detail/config.hpp>
@@ -90,6 +96,87 @@ namespace nil {
                     return _mm_xor_si128(key, key_with_rcon);
                 }
 
+                template<bool Encrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline __m128i aes_ni_round(__m128i block, __m128i round_key) {
+                    return Encrypt ? _mm_aesenc_si128(block, round_key) : _mm_aesdec_si128(block, round_key);
+                }
+
+                template<bool Encrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                inline __m128i aes_ni_last_round(__m128i block, __m128i round_key) {
+                    return Encrypt ? _mm_aesenclast_si128(block, round_key) : _mm_aesdeclast_si128(block, round_key);
+                }
+
+                /*
+                 * Processes independent blocks eight at a time. AESENC has a latency of several cycles but a
+                 * throughput of one or two per cycle, so interleaving the rounds of eight blocks keeps the AES units
+                 * busy where the single-block path waits on each round. On CPUs with VAES the bulk goes through 256-
+                 * or 512-bit registers first. Decryption expects the equivalent inverse cipher schedule produced by
+                 * schedule_key.
+                 */
+                template<std::size_t Rounds, bool Encrypt>
+                BOOST_ATTRIBUTE_TARGET("ssse3,aes")
+                void aes_ni_crypt_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t blocks,
+                                         const std::uint8_t *round_keys) {
+#if defined(CRYPTO3_RIJNDAEL_VAES_SELECTED)
+                    if (rijndael_vaes_impl::is_supported()) {
+                        const std::size_t wide =
+                            rijndael_vaes_impl::crypt_blocks<Rounds, Encrypt>(in, out, blocks, round_keys);
+                        in += wide * 16;
+                        out += wide * 16;
+                        blocks -= wide;
+                    }
+#endif
+
+                    __m128i K[Rounds + 1];
+                    for (std::size_t r = 0; r <= Rounds; ++r) {
+                        K[r] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(round_keys) + r);
+                    }
+
+                    const __m128i *in_mm = reinterpret_cast<const __m128i *>(in);
+                    __m128i *out_mm = reinterpret_cast<__m128i *>(out);
+
+                    for (; blocks >= 8; blocks -= 8, in_mm += 8, out_mm += 8) {
+                        __m128i B0 = _mm_xor_si128(_mm_loadu_si128(in_mm), K[0]);
+                        __m128i B1 = _mm_xor_si128(_mm_loadu_si128(in_mm + 1), K[0]);
+                        __m128i B2 = _mm_xor_si128(_mm_loadu_si128(in_mm + 2), K[0]);
+                        __m128i B3 = _mm_xor_si128(_mm_loadu_si128(in_mm + 3), K[0]);
+                        __m128i B4 = _mm_xor_si128(_mm_loadu_si128(in_mm + 4), K[0]);
+                        __m128i B5 = _mm_xor_si128(_mm_loadu_si128(in_mm + 5), K[0]);
+                        __m128i B6 = _mm_xor_si128(_mm_loadu_si128(in_mm + 6), K[0]);
+                        __m128i B7 = _mm_xor_si128(_mm_loadu_si128(in_mm + 7), K[0]);
+
+                        for (std::size_t r = 1; r < Rounds; ++r) {
+                            B0 = aes_ni_round<Encrypt>(B0, K[r]);
+                            B1 = aes_ni_round<Encrypt>(B1, K[r]);
+                            B2 = aes_ni_round<Encrypt>(B2, K[r]);
+                            B3 = aes_ni_round<Encrypt>(B3, K[r]);
+                            B4 = aes_ni_round<Encrypt>(B4, K[r]);
+                            B5 = aes_ni_round<Encrypt>(B5, K[r]);
+                            B6 = aes_ni_round<Encrypt>(B6, K[r]);
+                            B7 = aes_ni_round<Encrypt>(B7, K[r]);
+                        }
+
+                        _mm_storeu_si128(out_mm, aes_ni_last_round<Encrypt>(B0, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 1, aes_ni_last_round<Encrypt>(B1, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 2, aes_ni_last_round<Encrypt>(B2, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 3, aes_ni_last_round<Encrypt>(B3, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 4, aes_ni_last_round<Encrypt>(B4, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 5, aes_ni_last_round<Encrypt>(B5, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 6, aes_ni_last_round<Encrypt>(B6, K[Rounds]));
+                        _mm_storeu_si128(out_mm + 7, aes_ni_last_round<Encrypt>(B7, K[Rounds]));
+                    }
+
+                    for (; blocks != 0; --blocks, ++in_mm, ++out_mm) {
+                        __m128i B = _mm_xor_si128(_mm_loadu_si128(in_mm), K[0]);
+                        for (std::size_t r = 1; r < Rounds; ++r) {
+                            B = aes_ni_round<Encrypt>(B, K[r]);
+                        }
+                        _mm_storeu_si128(out_mm, aes_ni_last_round<Encrypt>(B, K[Rounds]));
+                    }
+                }
+
                 template<std::size_t KeyBitsImpl, std::size_t BlockBitsImpl>
                 class rijndael_ni_impl {
                     typedef rijndael_policy<KeyBitsImpl, BlockBitsImpl> policy_type;
@@ -148,6 +235,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, true>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, false>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -295,6 +396,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, true>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, false>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -473,6 +588,20 @@ namespace nil {
                         return out;
                     }
 
+                    static void encrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &encryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, true>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(encryption_key.data()));
+                    }
+
+                    static void decrypt_blocks(const block_type *in, block_type *out, std::size_t blocks,
+                                               const key_schedule_type &decryption_key) {
+                        aes_ni_crypt_blocks<policy_type::rounds, false>(
+                            in->data(), out->data(), blocks,
+                            reinterpret_cast<const std::uint8_t *>(decryption_key.data()));
+                    }
+
                     BOOST_ATTRIBUTE_TARGET("ssse3,aes")
                     static block_type decrypt_block(const block_type &plaintext,
                                                     const key_schedule_type &decryption_key) {
@@ -593,4 +722,6 @@ namespace nil {
     }    // namespace crypto3
 }    // namespace nil
 
+#undef CRYPTO3_RIJNDAEL_VAES_SELECTED
+
 #endif    // CRYPTO3_RIJNDAEL_NI_IMPL_HPP
@@ -0,0 +1,218 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
+#define CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace block {
+            /*!
+             * @cond DETAIL_IMPL
+             */
+            namespace detail {
+                /*!
+                 * @brief Bulk AES rounds on VAES, several blocks per instruction. VAES and AVX2 are only enabled
+                 * for the functions below, so callers have to check is_supported() before using them.
+                 */
+                struct rijndael_vaes_impl {
+                    static bool is_supported() {
+#if defined(__VAES__) && defined(__AVX2__)
+                        return true;
+#else
+                        static const bool supported = detect();
+                        return supported;
+#endif
+                    }
+
+                    /*!
+                     * @brief Returns how many blocks were processed, the remaining ones (fewer than one group) are
+                     * left to the 128-bit AES-NI path.
+                     */
+                    template<std::size_t Rounds, bool Encrypt>
+                    static std::size_t crypt_blocks(const std::uint8_t *in, std::uint8_t *out, std::size_t blocks,
+                                                    const std::uint8_t *round_keys) {
+#if defined(__VAES__) && defined(__AVX512F__)
+                        return crypt_blocks_512<Rounds, Encrypt>(in, out, blocks, round_keys);
+#else
+                        return crypt_blocks_256<Rounds, Encrypt>(in, out, blocks, round_keys);
+#endif
+                    }
+
+                private:
+                    static bool detect() {
+                        unsigned int eax, ebx, ecx, edx;
+                        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_OSXSAVE) == 0) {
+                            return false;
+                        }
+                        // The OS has to save the SSE and AVX register states.
+                        std::uint32_t xcr0_low, xcr0_high;
+                        __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+                        if ((xcr0_low & 0x6) != 0x6) {
+                            return false;
+                        }
+                        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                            return false;
+                        }
+                        return (ebx & bit_AVX2) != 0 && (ecx & bit_VAES) != 0;
+                    }
+
+#if defined(__VAES__) && defined(__AVX512F__)
+                    /*
+                     * VAES on 512-bit registers: four blocks per instruction, four registers in flight. Only built when
+                     * the compiler already targets AVX-512F and VAES, so no runtime check is needed on this path.
+                     */
+                    template<std::size_t Rounds, bool Encrypt>
+                    static std::size_t crypt_blocks_512(const std::uint8_t *in, std::uint8_t *out, std::size_t blocks,
+                                                        const std::uint8_t *round_keys) {
+                        constexpr std::size_t lanes = 4;
+                        constexpr std::size_t group = 4 * lanes;
+
+                        __m512i K[Rounds + 1];
+                        for (std::size_t r = 0; r <= Rounds; ++r) {
+                            K[r] = _mm512_broadcast_i32x4(
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(round_keys) + r));
+                        }
+
+                        std::size_t processed = 0;
+                        for (; blocks - processed >= group; processed += group) {
+                            const std::uint8_t *src = in + processed * 16;
+                            __m512i B0 = _mm512_xor_si512(_mm512_loadu_si512(src), K[0]);
+                            __m512i B1 = _mm512_xor_si512(_mm512_loadu_si512(src + 64), K[0]);
+                            __m512i B2 = _mm512_xor_si512(_mm512_loadu_si512(src + 128), K[0]);
+                            __m512i B3 = _mm512_xor_si512(_mm512_loadu_si512(src + 192), K[0]);
+
+                            for (std::size_t r = 1; r < Rounds; ++r) {
+                                if constexpr (Encrypt) {
+                                    B0 = _mm512_aesenc_epi128(B0, K[r]);
+                                    B1 = _mm512_aesenc_epi128(B1, K[r]);
+                                    B2 = _mm512_aesenc_epi128(B2, K[r]);
+                                    B3 = _mm512_aesenc_epi128(B3, K[r]);
+                                } else {
+                                    B0 = _mm512_aesdec_epi128(B0, K[r]);
+                                    B1 = _mm512_aesdec_epi128(B1, K[r]);
+                                    B2 = _mm512_aesdec_epi128(B2, K[r]);
+                                    B3 = _mm512_aesdec_epi128(B3, K[r]);
+                                }
+                            }
+
+                            if constexpr (Encrypt) {
+                                B0 = _mm512_aesenclast_epi128(B0, K[Rounds]);
+                                B1 = _mm512_aesenclast_epi128(B1, K[Rounds]);
+                                B2 = _mm512_aesenclast_epi128(B2, K[Rounds]);
+                                B3 = _mm512_aesenclast_epi128(B3, K[Rounds]);
+                            } else {
+                                B0 = _mm512_aesdeclast_epi128(B0, K[Rounds]);
+                                B1 = _mm512_aesdeclast_epi128(B1, K[Rounds]);
+                                B2 = _mm512_aesdeclast_epi128(B2, K[Rounds]);
+                                B3 = _mm512_aesdeclast_epi128(B3, K[Rounds]);
+                            }
+
+                            std::uint8_t *dst = out + processed * 16;
+                            _mm512_storeu_si512(dst, B0);
+                            _mm512_storeu_si512(dst + 64, B1);
+                            _mm512_storeu_si512(dst + 128, B2);
+                            _mm512_storeu_si512(dst + 192, B3);
+                        }
+                        return processed;
+                    }
+#endif
+
+                    /*
+                     * VAES on 256-bit registers: two blocks per instruction, four registers in flight.
+                     */
+                    template<std::size_t Rounds, bool Encrypt>
+                    static BOOST_ATTRIBUTE_TARGET("vaes,avx2") std::size_t
+                        crypt_blocks_256(const std::uint8_t *in, std::uint8_t *out, std::size_t blocks,
+                                         const std::uint8_t *round_keys) {
+                        constexpr std::size_t lanes = 2;
+                        constexpr std::size_t group = 4 * lanes;
+
+                        __m256i K[Rounds + 1];
+                        for (std::size_t r = 0; r <= Rounds; ++r) {
+                            K[r] = _mm256_broadcastsi128_si256(
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(round_keys) + r));
+                        }
+
+                        std::size_t processed = 0;
+                        for (; blocks - processed >= group; processed += group) {
+                            const __m256i *src = reinterpret_cast<const __m256i *>(in + processed * 16);
+                            __m256i B0 = _mm256_xor_si256(_mm256_loadu_si256(src), K[0]);
+                            __m256i B1 = _mm256_xor_si256(_mm256_loadu_si256(src + 1), K[0]);
+                            __m256i B2 = _mm256_xor_si256(_mm256_loadu_si256(src + 2), K[0]);
+                            __m256i B3 = _mm256_xor_si256(_mm256_loadu_si256(src + 3), K[0]);
+
+                            for (std::size_t r = 1; r < Rounds; ++r) {
+                                if constexpr (Encrypt) {
+                                    B0 = _mm256_aesenc_epi128(B0, K[r]);
+                                    B1 = _mm256_aesenc_epi128(B1, K[r]);
+                                    B2 = _mm256_aesenc_epi128(B2, K[r]);
+                                    B3 = _mm256_aesenc_epi128(B3, K[r]);
+                                } else {
+                                    B0 = _mm256_aesdec_epi128(B0, K[r]);
+                                    B1 = _mm256_aesdec_epi128(B1, K[r]);
+                                    B2 = _mm256_aesdec_epi128(B2, K[r]);
+                                    B3 = _mm256_aesdec_epi128(B3, K[r]);
+                                }
+                            }
+
+                            if constexpr (Encrypt) {
+                                B0 = _mm256_aesenclast_epi128(B0, K[Rounds]);
+                                B1 = _mm256_aesenclast_epi128(B1, K[Rounds]);
+                                B2 = _mm256_aesenclast_epi128(B2, K[Rounds]);
+                                B3 = _mm256_aesenclast_epi128(B3, K[Rounds]);
+                            } else {
+                                B0 = _mm256_aesdeclast_epi128(B0, K[Rounds]);
+                                B1 = _mm256_aesdeclast_epi128(B1, K[Rounds]);
+                                B2 = _mm256_aesdeclast_epi128(B2, K[Rounds]);
+                                B3 = _mm256_aesdeclast_epi128(B3, K[Rounds]);
+                            }
+
+                            __m256i *dst = reinterpret_cast<__m256i *>(out + processed * 16);
+                            _mm256_storeu_si256(dst, B0);
+                            _mm256_storeu_si256(dst + 1, B1);
+                            _mm256_storeu_si256(dst + 2, B2);
+                            _mm256_storeu_si256(dst + 3, B3);
+                        }
+                        return processed;
+                    }
+                };
+            }    // namespace detail
+            /*!
+             * @endcond
+             */
+        }    // namespace block
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_RIJNDAEL_VAES_IMPL_HPP
@@ -184,6 +184,34 @@ namespace nil {
                     return impl_type::decrypt_block(ciphertext, decryption_key);
                 }
 
+                /*!
+                 * @brief Encrypts `blocks` independent blocks. Implementations able to keep several blocks in flight
+                 * process them interleaved, the others fall back to one block at a time. `in` and `out` may be the
+                 * same array.
+                 */
+                inline void encrypt_blocks(const block_type *in, block_type *out, std::size_t blocks) const {
+                    if constexpr (requires { impl_type::encrypt_blocks(in, out, blocks, encryption_key); }) {
+                        impl_type::encrypt_blocks(in, out, blocks, encryption_key);
+                    } else {
+                        for (std::size_t i = 0; i != blocks; ++i) {
+                            out[i] = impl_type::encrypt_block(in[i], encryption_key);
+                        }
+                    }
+                }
+
+                /*!
+                 * @brief Decrypts `blocks` independent blocks, see encrypt_blocks.
+                 */
+                inline void decrypt_blocks(const block_type *in, block_type *out, std::size_t blocks) const {
+                    if constexpr (requires { impl_type::decrypt_blocks(in, out, blocks, decryption_key); }) {
+                        impl_type::decrypt_blocks(in, out, blocks, decryption_key);
+                    } else {
+                        for (std::size_t i = 0; i != blocks; ++i) {
+                            out[i] = impl_type::decrypt_block(in[i], decryption_key);
+                        }
+                    }
+                }
+
             protected:
                 key_schedule_type encryption_key, decryption_key;
             };
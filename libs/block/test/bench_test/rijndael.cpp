@@ -0,0 +1,128 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE block_rijndael_bench_test
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/block/aes.hpp>
+#include <nil/crypto3/block/algorithm/encrypt.hpp>
+
+#include <nil/crypto3/bench/benchmark.hpp>
+
+using namespace nil::crypto3;
+
+template<typename Cipher>
+void run_rijndael_bench(std::string const &name, std::size_t message_size) {
+    typename Cipher::key_type key;
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+    const Cipher cipher(key);
+
+    const std::size_t blocks = message_size / 16;
+    std::vector<typename Cipher::block_type> in(blocks), out(blocks);
+    for (std::size_t i = 0; i < blocks; ++i) {
+        for (std::size_t j = 0; j < 16; ++j) {
+            in[i][j] = static_cast<std::uint8_t>(i * 131 + j * 7);
+        }
+    }
+
+    bench::detail::run_benchmark_impl(
+        std::format("{:12} encrypt           {:8} bytes:", name, message_size),
+        [](std::size_t) { return std::make_tuple(std::uint8_t(0)); },
+        [&](std::size_t batch_size, std::uint8_t &sink) {
+            for (std::size_t b = 0; b < batch_size; ++b) {
+                in[0][0] = sink;
+                for (std::size_t i = 0; i < blocks; ++i) {
+                    out[i] = cipher.encrypt(in[i]);
+                }
+                sink ^= out[blocks - 1][0];
+            }
+            return sink;
+        });
+
+    bench::detail::run_benchmark_impl(
+        std::format("{:12} encrypt_blocks    {:8} bytes:", name, message_size),
+        [](std::size_t) { return std::make_tuple(std::uint8_t(0)); },
+        [&](std::size_t batch_size, std::uint8_t &sink) {
+            for (std::size_t b = 0; b < batch_size; ++b) {
+                in[0][0] = sink;
+                cipher.encrypt_blocks(in.data(), out.data(), blocks);
+                sink ^= out[blocks - 1][0];
+            }
+            return sink;
+        });
+
+    bench::detail::run_benchmark_impl(
+        std::format("{:12} decrypt_blocks    {:8} bytes:", name, message_size),
+        [](std::size_t) { return std::make_tuple(std::uint8_t(0)); },
+        [&](std::size_t batch_size, std::uint8_t &sink) {
+            for (std::size_t b = 0; b < batch_size; ++b) {
+                in[0][0] = sink;
+                cipher.decrypt_blocks(in.data(), out.data(), blocks);
+                sink ^= out[blocks - 1][0];
+            }
+            return sink;
+        });
+
+    std::vector<std::uint8_t> message(message_size), ciphertext;
+    for (std::size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+    ciphertext.reserve(message_size);
+
+    bench::detail::run_benchmark_impl(
+        std::format("{:12} block::encrypt    {:8} bytes:", name, message_size),
+        [](std::size_t) { return std::make_tuple(std::uint8_t(0)); },
+        [&](std::size_t batch_size, std::uint8_t &sink) {
+            for (std::size_t b = 0; b < batch_size; ++b) {
+                message[0] = sink;
+                ciphertext.clear();
+                encrypt<Cipher>(message, key, std::back_inserter(ciphertext));
+                sink ^= ciphertext.back();
+            }
+            return sink;
+        });
+}
+
+BOOST_AUTO_TEST_SUITE(rijndael_bench_test_suite)
+
+BOOST_AUTO_TEST_CASE(rijndael_bench) {
+    for (std::size_t message_size : {128, 1024, 16384, 1 << 20}) {
+        run_rijndael_bench<block::aes<128>>("aes<128>", message_size);
+        run_rijndael_bench<block::aes<256>>("aes<256>", message_size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -448,3 +448,87 @@ BOOST_AUTO_TEST_CASE(aes_128_with_array_8) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()*/
+
+BOOST_AUTO_TEST_SUITE(rijndael_multi_block_test_suite)
+
+template<typename Cipher>
+std::vector<typename Cipher::block_type> patterned_blocks(std::size_t count) {
+    std::vector<typename Cipher::block_type> blocks(count);
+    for (std::size_t i = 0; i != count; ++i) {
+        for (std::size_t j = 0; j != blocks[i].size(); ++j) {
+            blocks[i][j] = static_cast<std::uint8_t>(i * 31 + j * 7 + 1);
+        }
+    }
+    return blocks;
+}
+
+template<typename Cipher>
+void check_multi_block(const typename Cipher::key_type &key) {
+    const Cipher cipher(key);
+
+    // Counts around the 8-block interleave and the 16-block VAES group, including their tails
+    for (std::size_t count : {0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 70}) {
+        const std::vector<typename Cipher::block_type> plaintext = patterned_blocks<Cipher>(count);
+        std::vector<typename Cipher::block_type> ciphertext(count), decrypted(count);
+
+        cipher.encrypt_blocks(plaintext.data(), ciphertext.data(), count);
+        cipher.decrypt_blocks(ciphertext.data(), decrypted.data(), count);
+
+        for (std::size_t i = 0; i != count; ++i) {
+            BOOST_CHECK(ciphertext[i] == cipher.encrypt(plaintext[i]));
+        }
+        BOOST_CHECK(decrypted == plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(aes_encrypt_blocks_matches_single_block) {
+    std::array<std::uint8_t, 32> key;
+    for (std::size_t i = 0; i != key.size(); ++i) {
+        key[i] = static_cast<std::uint8_t>(i);
+    }
+
+    typename aes<128>::key_type key_128;
+    std::copy(key.begin(), key.begin() + key_128.size(), key_128.begin());
+    check_multi_block<aes<128>>(key_128);
+
+    typename aes<192>::key_type key_192;
+    std::copy(key.begin(), key.begin() + key_192.size(), key_192.begin());
+    check_multi_block<aes<192>>(key_192);
+
+    typename aes<256>::key_type key_256;
+    std::copy(key.begin(), key.begin() + key_256.size(), key_256.begin());
+    check_multi_block<aes<256>>(key_256);
+}
+
+BOOST_AUTO_TEST_CASE(aes_range_encrypt_is_batched_ecb) {
+    const std::vector<std::uint8_t> key = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                           0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+    typename aes<128>::key_type cipher_key;
+    std::copy(key.begin(), key.end(), cipher_key.begin());
+    const aes<128> cipher(cipher_key);
+
+    // Long enough for several batches and a partial last batch
+    const std::size_t blocks = 200;
+    std::vector<std::uint8_t> input(blocks * 16);
+    for (std::size_t i = 0; i != input.size(); ++i) {
+        input[i] = static_cast<std::uint8_t>(i * 13 + 5);
+    }
+
+    std::vector<std::uint8_t> expected;
+    for (std::size_t i = 0; i != blocks; ++i) {
+        typename aes<128>::block_type block;
+        std::copy(input.begin() + i * 16, input.begin() + (i + 1) * 16, block.begin());
+        block = cipher.encrypt(block);
+        expected.insert(expected.end(), block.begin(), block.end());
+    }
+
+    std::vector<std::uint8_t> out;
+    encrypt<aes<128>>(input, key, std::back_inserter(out));
+    BOOST_CHECK(out == expected);
+
+    std::vector<std::uint8_t> decrypted;
+    decrypt<aes<128>>(out, key, std::back_inserter(decrypted));
+    BOOST_CHECK(decrypted == input);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MERKLE_MULTIPROOF_HPP
+#define CRYPTO3_MERKLE_MULTIPROOF_HPP
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/hash/type_traits.hpp>
+#include <nil/crypto3/container/merkle/tree.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace containers {
+            namespace detail {
+                /*!
+                 * @brief Merkle proof for a set of leaves at once.
+                 *
+                 * Instead of one authentication path per leaf, the proof holds every sibling that the verifier
+                 * cannot derive from the opened leaves themselves, once. Nodes are stored level by level from the
+                 * leaves up and, within a level, in increasing index order. Verification walks the same order and
+                 * hashes every internal node on the union of the paths exactly once.
+                 *
+                 * The root, the number of leaves and the opened indices are not a part of the proof, the verifier
+                 * knows them already. Neither are the default digests completing the last node of a row, see
+                 * merkle_tree_impl.
+                 */
+                template<typename NodeType, std::size_t Arity = 2>
+                class merkle_multiproof_impl {
+                public:
+                    typedef NodeType node_type;
+                    typedef typename node_type::hash_type hash_type;
+
+                    constexpr static const std::size_t arity = Arity;
+
+                    constexpr static const std::size_t value_bits = node_type::value_bits;
+                    typedef typename node_type::value_type value_type;
+
+                    merkle_multiproof_impl() = default;
+
+                    explicit merkle_multiproof_impl(std::vector<value_type> nodes) : _nodes(std::move(nodes)) {
+                    }
+
+                    /*!
+                     * @param leaf_indices Leaves to prove. The order does not matter and repetitions are allowed,
+                     * the proof covers the sorted set of distinct indices.
+                     */
+                    merkle_multiproof_impl(const merkle_tree_impl<NodeType, Arity> &tree,
+                                           std::vector<std::size_t> leaf_indices) {
+                        BOOST_ASSERT_MSG(tree.pruned_rows() == 0, "Merkle multiproofs need all the tree rows.");
+                        std::sort(leaf_indices.begin(), leaf_indices.end());
+                        leaf_indices.erase(std::unique(leaf_indices.begin(), leaf_indices.end()), leaf_indices.end());
+                        BOOST_ASSERT_MSG(leaf_indices.empty() || leaf_indices.back() < tree.leaves(),
+                                         "Leaf index is out of the tree.");
+
+                        std::vector<std::size_t> known = std::move(leaf_indices);
+                        std::vector<std::size_t> parents;
+                        std::size_t row_begin = 0;
+                        for (std::size_t row_len = tree.leaves(); row_len > 1;
+                             row_len = merkle_tree_next_row_length(row_len, Arity)) {
+                            parents.clear();
+                            for (std::size_t i = 0; i < known.size();) {
+                                const std::size_t group = known[i] / Arity;
+                                const std::size_t group_end = std::min((group + 1) * Arity, row_len);
+                                for (std::size_t child = group * Arity; child < group_end; ++child) {
+                                    if (i < known.size() && known[i] == child) {
+                                        ++i;
+                                    } else {
+                                        _nodes.push_back(tree[row_begin + child]);
+                                    }
+                                }
+                                parents.push_back(group);
+                            }
+                            known.swap(parents);
+                            row_begin += row_len;
+                        }
+                    }
+
+                    /*!
+                     * @brief Checks leaves given in any order, possibly with repeated indices, against the root of a
+                     * tree with leaves_number leaves. A repeated index must come with the same leaf each time.
+                     */
+                    template<typename Hashable>
+                    bool validate(const value_type &root, std::size_t leaves_number,
+                                  const std::vector<std::size_t> &indices, const std::vector<Hashable> &leaves) const {
+                        if (indices.size() != leaves.size()) {
+                            return false;
+                        }
+                        std::vector<value_type> leaf_hashes;
+                        leaf_hashes.reserve(leaves.size());
+                        for (const auto &leaf : leaves) {
+                            leaf_hashes.push_back(static_cast<value_type>(crypto3::hash<hash_type>(leaf)));
+                        }
+                        return validate_leaf_hashes(root, leaves_number, indices, leaf_hashes);
+                    }
+
+                    /*!
+                     * @brief Same as validate(), with the leaves already hashed.
+                     */
+                    bool validate_leaf_hashes(const value_type &root, std::size_t leaves_number,
+                                              const std::vector<std::size_t> &indices,
+                                              const std::vector<value_type> &leaf_hashes) const {
+                        if (indices.size() != leaf_hashes.size() || indices.empty()) {
+                            return false;
+                        }
+
+                        std::vector<std::size_t> order(indices.size());
+                        std::iota(order.begin(), order.end(), 0);
+                        std::sort(order.begin(), order.end(),
+                                  [&indices](std::size_t i, std::size_t j) { return indices[i] < indices[j]; });
+                        if (indices[order.back()] >= leaves_number) {
+                            return false;
+                        }
+
+                        std::vector<std::size_t> known;
+                        std::vector<value_type> level_hashes;
+                        known.reserve(indices.size());
+                        level_hashes.reserve(indices.size());
+                        for (std::size_t i : order) {
+                            if (!known.empty() && known.back() == indices[i]) {
+                                if (level_hashes.back() != leaf_hashes[i]) {
+                                    return false;
+                                }
+                                continue;
+                            }
+                            known.push_back(indices[i]);
+                            level_hashes.push_back(leaf_hashes[i]);
+                        }
+
+                        typename std::vector<value_type>::const_iterator node_itr = _nodes.cbegin();
+                        std::vector<std::size_t> parents;
+                        std::vector<value_type> parent_hashes;
+                        for (std::size_t row_len = leaves_number; row_len > 1;
+                             row_len = merkle_tree_next_row_length(row_len, Arity)) {
+                            parents.clear();
+                            parent_hashes.clear();
+                            for (std::size_t i = 0; i < known.size();) {
+                                const std::size_t group = known[i] / Arity;
+                                std::array<value_type, Arity> children;
+                                for (std::size_t child = 0; child < Arity; ++child) {
+                                    if (i < known.size() && known[i] == group * Arity + child) {
+                                        children[child] = level_hashes[i++];
+                                    } else if (group * Arity + child >= row_len) {
+                                        children[child] = value_type();
+                                    } else if (node_itr != _nodes.cend()) {
+                                        children[child] = *node_itr++;
+                                    } else {
+                                        return false;
+                                    }
+                                }
+                                parents.push_back(group);
+                                parent_hashes.push_back(
+                                    merkle_node_compressor<hash_type, Arity>::compress(children.begin(), children.end()));
+                            }
+                            known.swap(parents);
+                            level_hashes.swap(parent_hashes);
+                        }
+                        return node_itr == _nodes.cend() && known.size() == 1 && known[0] == 0 &&
+                               level_hashes[0] == root;
+                    }
+
+                    const std::vector<value_type> &nodes() const {
+                        return _nodes;
+                    }
+
+                    bool operator==(const merkle_multiproof_impl &rhs) const {
+                        return _nodes == rhs._nodes;
+                    }
+                    bool operator!=(const merkle_multiproof_impl &rhs) const {
+                        return !(rhs == *this);
+                    }
+
+                private:
+                    std::vector<value_type> _nodes;
+                };
+            }    // namespace detail
+
+            template<typename T, std::size_t Arity>
+            using merkle_multiproof =
+                typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                          detail::merkle_multiproof_impl<detail::merkle_tree_node<T>, Arity>,
+                                          detail::merkle_multiproof_impl<T, Arity>>::type;
+
+        }    // namespace containers
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MERKLE_MULTIPROOF_HPP
@@ -29,6 +29,8 @@
 #define CRYPTO3_MERKLE_PROOF_HPP
 
 #include <algorithm>
+#include <array>
+#include <numeric>
 #include <vector>
 #include <stack>
 
@@ -101,51 +103,70 @@ namespace nil {
                         _li(li), _root(root), _path(path) { };
 
                     merkle_proof_impl(const merkle_tree<hash_type, arity> &tree, const std::size_t leaf_idx) {
-                        _root = tree.root();
-                        _path.resize(tree.row_count() - 1);
-                        _li = leaf_idx;
+                        BOOST_ASSERT_MSG(tree.pruned_rows() == 0, "Use the constructor recomputing pruned rows");
+                        fill_path(tree, leaf_idx, 0, std::vector<value_type>());
+                    }
 
-                        typename std::vector<layer_type>::iterator v_itr = _path.begin();
-                        std::size_t cur_leaf = leaf_idx;
-                        std::size_t row_len = tree.leaves();
-                        std::size_t row_begin_idx = 0;
-                        while (cur_leaf != tree.size() - 1) {    // while it's not _root
-                            std::size_t cur_leaf_pos = cur_leaf % arity;
-                            std::size_t cur_leaf_arity_pos = (cur_leaf - row_begin_idx) / arity;
-                            std::size_t begin_this_arity = cur_leaf - cur_leaf_pos;
-                            typename layer_type::iterator a_itr = v_itr->begin();
-                            for (size_t i = 0; i < cur_leaf_pos; ++i, ++begin_this_arity, ++a_itr) {
-                                *a_itr = path_element_type(tree[begin_this_arity], i);
-                            }
-                            for (size_t i = cur_leaf_pos + 1; i < arity; ++i, ++begin_this_arity, ++a_itr) {
-                                *a_itr = path_element_type(tree[begin_this_arity + 1], i);
-                            }
-                            v_itr++;
-                            cur_leaf = row_len + row_begin_idx + cur_leaf_arity_pos;
-                            row_begin_idx += row_len;
-                            row_len /= arity;
-                        }
+                    /*!
+                     * @brief Proof of a leaf up to the Merkle cap of height cap_height, see merkle_tree_impl::cap.
+                     * The path is cap_height layers shorter and root() is the cap node above the leaf.
+                     */
+                    merkle_proof_impl(const merkle_tree<hash_type, arity> &tree, const std::size_t leaf_idx,
+                                      const std::size_t cap_height) {
+                        BOOST_ASSERT_MSG(tree.pruned_rows() == 0, "Use the constructor recomputing pruned rows");
+                        fill_path(tree, leaf_idx, cap_height, std::vector<value_type>());
+                    }
+
+                    /*!
+                     * @brief Proof of a leaf of a tree with pruned rows. The dropped nodes of the subtree holding
+                     * the leaf are recomputed from its leaves, which produce_leaves gives with the same contract as
+                     * for make_merkle_tree_streamed.
+                     */
+                    template<typename LeafProducer>
+                    merkle_proof_impl(const merkle_tree<hash_type, arity> &tree, const std::size_t leaf_idx,
+                                      const std::size_t cap_height, LeafProducer produce_leaves) {
+                        const std::size_t subtree_leaves = merkle_subtree_leaves(tree.pruned_rows(), arity);
+                        const std::size_t first = leaf_idx - leaf_idx % subtree_leaves;
+                        std::vector<value_type> subtree = make_merkle_subtree_rows<NodeType, Arity>(
+                            first, std::min(first + subtree_leaves, tree.leaves()), tree.pruned_rows(),
+                            produce_leaves);
+                        BOOST_ASSERT_MSG(subtree.back() == tree[tree.row_begin(tree.pruned_rows()) +
+                                                                leaf_idx / subtree_leaves],
+                                         "Produced leaves do not match the tree");
+                        fill_path(tree, leaf_idx, cap_height, subtree);
                     }
 
                     template<typename Hashable, typename HashType = typename NodeType::hash_type>
                     bool validate(const Hashable &a) const {
                         using hash_type = typename NodeType::hash_type;
                         value_type d = crypto3::hash<hash_type>(a);
+                        std::array<value_type, arity> children;
                         for (auto &it : _path) {
-                            accumulator_set<hash_type> acc;
                             size_t i = 0;
                             for (; (i < arity - 1) && i == it[i]._position; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                                children[i] = it[i]._hash;
                             }
-                            crypto3::hash<hash_type>(d, acc);
+                            children[i] = d;
                             for (; i < arity - 1; ++i) {
-                                crypto3::hash<hash_type>(it[i]._hash, acc);
+                                children[i + 1] = it[i]._hash;
                             }
-                            d = accumulators::extract::hash<hash_type>(acc);
+                            d = merkle_node_compressor<hash_type, arity>::compress(children.begin(), children.end());
                         }
                         return (d == _root);
                     }
 
+                    /*!
+                     * @brief Checks the leaf against a Merkle cap, a cap of the root alone checks a complete proof.
+                     */
+                    template<typename Hashable>
+                    bool validate(const Hashable &a, const std::vector<value_type> &cap) const {
+                        std::size_t cap_index = _li;
+                        for (std::size_t i = 0; i < _path.size(); ++i) {
+                            cap_index /= arity;
+                        }
+                        return cap_index < cap.size() && cap[cap_index] == _root && validate(a);
+                    }
+
                     static std::vector<merkle_proof_impl>
                         generate_compressed_proofs(const containers::merkle_tree<NodeType, Arity> &tree,
                                                    std::vector<std::size_t>
@@ -157,8 +178,7 @@ namespace nil {
                             return leaf_idxs[i] < leaf_idxs[j];
                         });
                         std::vector<merkle_proof_impl> result_proofs(leaf_idxs.size());
-                        std::size_t row_len = tree.leaves();
-                        std::vector<bool> known(2 * row_len, false);
+                        std::vector<bool> known(tree.complete_size(), false);
                         std::size_t prev_leaf_idx = leaf_idxs[sorted_idx[0]] + 1;
                         for (auto idx : sorted_idx) {
                             auto leaf_idx = leaf_idxs[idx];
@@ -169,40 +189,37 @@ namespace nil {
                             }
                             path_type path(tree.row_count() - 1);
                             typename path_type::iterator path_itr = path.begin();
-                            std::size_t cur_leaf = leaf_idx;
+                            std::size_t cur = leaf_idx;
                             std::size_t row_len = tree.leaves();
                             std::size_t row_begin_idx = 0;
                             bool finish_path = false;
-                            while (cur_leaf != tree.size() - 1) {
-                                std::size_t cur_leaf_pos = cur_leaf % Arity;
-                                std::size_t cur_leaf_arity_pos = (cur_leaf - row_begin_idx) / Arity;
-                                std::size_t begin_this_arity = cur_leaf - cur_leaf_pos;
+                            while (row_len > 1) {    // while it's not _root
+                                const std::size_t cur_pos = cur % Arity;
+                                const std::size_t group_begin = cur - cur_pos;
                                 typename layer_type::iterator layer_itr = path_itr->begin();
-                                for (size_t i = 0; i < cur_leaf_pos; ++i, ++begin_this_arity) {
-                                    if (!known[begin_this_arity]) {
-                                        known[begin_this_arity] = true;
-                                    } else {
-                                        finish_path = true;
+                                for (std::size_t i = 0; i < Arity; ++i) {
+                                    if (i == cur_pos) {
+                                        continue;
                                     }
-                                    *layer_itr = path_element_type(tree[begin_this_arity], i);
-                                    ++layer_itr;
-                                }
-                                for (size_t i = cur_leaf_pos + 1; i < Arity; ++i, ++begin_this_arity) {
-                                    if (!known[begin_this_arity + 1]) {
-                                        known[begin_this_arity + 1] = true;
+                                    if (group_begin + i >= row_len) {
+                                        *layer_itr++ = path_element_type(value_type(), i);
+                                        continue;
+                                    }
+                                    const std::size_t node = row_begin_idx + group_begin + i;
+                                    if (!known[node]) {
+                                        known[node] = true;
                                     } else {
                                         finish_path = true;
                                     }
-                                    *layer_itr = path_element_type(tree[begin_this_arity + 1], i);
-                                    ++layer_itr;
+                                    *layer_itr++ = path_element_type(tree[node], i);
                                 }
                                 path_itr++;
                                 if (finish_path) {
                                     break;
                                 }
-                                cur_leaf = row_len + row_begin_idx + cur_leaf_arity_pos;
+                                cur /= Arity;
                                 row_begin_idx += row_len;
-                                row_len /= Arity;
+                                row_len = merkle_tree_next_row_length(row_len, Arity);
                             }
                             path.resize(path_itr - path.begin());
                             result_proofs[idx] = merkle_proof_impl(leaf_idx, tree.root(), path);
@@ -218,8 +235,12 @@ namespace nil {
                         assert(proofs.size() > 0);
                         std::vector<std::size_t> sorted_idx(proofs.size());
                         std::iota(sorted_idx.begin(), sorted_idx.end(), 0);
+                        // Leaves from the last one down. A repeated leaf has an empty path, it goes before its
+                        // complete proof, which then checks it.
                         std::sort(sorted_idx.begin(), sorted_idx.end(), [&proofs](std::size_t i, std::size_t j) {
-                            return proofs[i].leaf_index() >= proofs[j].leaf_index();
+                            return proofs[i].leaf_index() > proofs[j].leaf_index() ||
+                                   (proofs[i].leaf_index() == proofs[j].leaf_index() &&
+                                    proofs[i].path().size() < proofs[j].path().size());
                         });
                         std::stack<std::pair<value_type, std::size_t>> st;
                         auto root = proofs[sorted_idx.back()].root();
@@ -281,6 +302,51 @@ namespace nil {
                     }
 
                 private:
+                    // Fills the path from the leaf up to the cap row. The nodes of the pruned rows of the tree are
+                    // taken from subtree, the rows of the subtree holding the leaf as make_merkle_subtree_rows
+                    // returns them.
+                    void fill_path(const merkle_tree<hash_type, arity> &tree, const std::size_t leaf_idx,
+                                   const std::size_t cap_height, const std::vector<value_type> &subtree) {
+                        BOOST_ASSERT_MSG(cap_height < tree.row_count(), "Merkle cap is higher than the tree");
+                        const std::size_t rows = tree.row_count() - 1 - cap_height;
+                        _li = leaf_idx;
+                        _path.resize(rows);
+
+                        // Node indices are local to their row. The nodes of the subtree start at subtree_first in
+                        // every pruned row and there are subtree_row_len of them.
+                        const std::size_t subtree_leaves = merkle_subtree_leaves(tree.pruned_rows(), arity);
+                        std::size_t cur = leaf_idx;
+                        std::size_t row_len = tree.leaves();
+                        std::size_t subtree_first = leaf_idx - leaf_idx % subtree_leaves;
+                        std::size_t subtree_row_begin = 0;
+                        std::size_t subtree_row_len = std::min(tree.leaves() - subtree_first, subtree_leaves);
+                        for (std::size_t row = 0; row < rows; ++row) {
+                            const std::size_t cur_pos = cur % arity;
+                            const std::size_t group_begin = cur - cur_pos;
+                            typename layer_type::iterator a_itr = _path[row].begin();
+                            for (std::size_t i = 0; i < arity; ++i) {
+                                if (i == cur_pos) {
+                                    continue;
+                                }
+                                if (group_begin + i >= row_len) {
+                                    *a_itr++ = path_element_type(value_type(), i);
+                                } else if (row < tree.pruned_rows()) {
+                                    *a_itr++ = path_element_type(
+                                        subtree[subtree_row_begin + group_begin + i - subtree_first], i);
+                                } else {
+                                    *a_itr++ = path_element_type(tree[tree.row_begin(row) + group_begin + i], i);
+                                }
+                            }
+                            subtree_row_begin += subtree_row_len;
+                            subtree_row_len = merkle_tree_next_row_length(subtree_row_len, arity);
+                            subtree_first /= arity;
+                            row_len = merkle_tree_next_row_length(row_len, arity);
+                            cur /= arity;
+                        }
+                        _root = rows < tree.pruned_rows() ? subtree[subtree_row_begin + cur - subtree_first]
+                                                          : tree[tree.row_begin(rows) + cur];
+                    }
+
                     std::size_t _li;
                     value_type _root;
                     path_type _path;
@@ -28,9 +28,19 @@
 #define CRYPTO3_MERKLE_TREE_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/algebra/curves/pallas.hpp>
 
 #include <nil/crypto3/detail/static_digest.hpp>
@@ -38,6 +48,7 @@
 
 #include <nil/crypto3/hash/type_traits.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/sha2_multi_buffer.hpp>
 #include <nil/crypto3/container/merkle/node.hpp>
 
 namespace nil {
@@ -55,54 +66,67 @@ namespace nil {
                     return next_pow2(n);
                 }
 
+                // Number of nodes in the row above a row of row_len nodes. A row which is not a multiple of
+                // the branches ends with a node having fewer children, see merkle_tree_impl.
+                inline size_t merkle_tree_next_row_length(size_t row_len, size_t branches) {
+                    return (row_len + branches - 1) / branches;
+                }
+
+                // Number of nodes in the given row of a tree of 'leafs' leaves, row 0 being the leaves.
+                inline size_t merkle_tree_row_length(size_t leafs, size_t branches, size_t row) {
+                    for (; row != 0; --row) {
+                        leafs = merkle_tree_next_row_length(leafs, branches);
+                    }
+                    return leafs;
+                }
+
                 // Row_Count calculation given the number of _leaves in the tree and the branches.
                 inline size_t merkle_tree_row_count(size_t leafs, size_t branches) {
-                    // Optimization
-                    if (branches == 2) {
-                        return std::log2(leafs) + 1;
-                    } else {
-                        return round(std::log(leafs) / std::log(branches)) + 1;
+                    size_t row_count = 1;
+                    for (size_t cur = leafs; cur > 1; cur = merkle_tree_next_row_length(cur, branches)) {
+                        ++row_count;
                     }
+                    return row_count;
                 }
 
                 // Tree length calculation given the number of _leaves in the tree and the branches.
                 inline size_t merkle_tree_length(size_t leafs, size_t branches) {
-                    // Optimization
                     size_t len = leafs;
-                    if (branches == 2) {
-                        len = 2 * leafs - 1;
-                    } else {
-                        size_t cur = leafs;
-                        while (cur != 0) {
-                            cur /= branches;
-                            len += cur;
-                        }
+                    for (size_t cur = leafs; cur > 1;) {
+                        cur = merkle_tree_next_row_length(cur, branches);
+                        len += cur;
                     }
                     return len;
                 }
 
                 // This method returns the number of '_leaves' given a merkle tree
-                // length of 'len', where _leaves must be a power of 2, respecting the
-                // number of branches.
+                // length of 'len', respecting the number of branches.
                 inline size_t merkle_tree_leaves(size_t tree_s, size_t branches) {
-                    // Optimization
-                    size_t len = tree_s;
-                    if (branches == 2) {
-                        len = (tree_s + 1) >> 1;
-                    } else {
-                        size_t cur = 1;
-                        while (cur < len) {
-                            len -= cur;
-                            cur *= branches;
+                    // The tree length grows strictly with the number of leaves.
+                    size_t low = 1, high = tree_s;
+                    while (low < high) {
+                        size_t mid = low + (high - low) / 2;
+                        if (merkle_tree_length(mid, branches) < tree_s) {
+                            low = mid + 1;
+                        } else {
+                            high = mid;
                         }
                     }
-                    return len;
+                    return low;
+                }
+
+                // Number of leaves under one node the given number of rows above the leaves.
+                inline size_t merkle_subtree_leaves(size_t rows, size_t branches) {
+                    size_t leafs = 1;
+                    for (; rows != 0; --rows) {
+                        leafs *= branches;
+                    }
+                    return leafs;
                 }
 
                 // Tree length calculation given the number of _leaves in the tree, the
                 // rows_to_discard, and the branches.
                 inline size_t merkle_tree_cache_size(size_t leafs, size_t branches, size_t rows_to_discard) {
-                    size_t shift = log2_pow2(branches);
                     size_t len = merkle_tree_length(leafs, branches);
                     size_t row_count = merkle_tree_row_count(leafs, branches);
 
@@ -115,7 +139,7 @@ namespace nil {
 
                     while (row_count > cache_base) {
                         cache_size -= cur_leafs;
-                        cur_leafs >>= shift;    // cur /= branches
+                        cur_leafs = merkle_tree_next_row_length(cur_leafs, branches);
                         row_count -= 1;
                     }
 
@@ -168,6 +192,15 @@ namespace nil {
                 // ```
                 //
                 // Merkle root is always the top element.
+                //
+                // The number of leaves does not have to be a power of Arity. Every row is ceil(n / Arity) nodes
+                // long for a row of n nodes below it, and the last node of a row gets default digests,
+                // value_type(), in place of its missing children. Proofs carry these digests as the siblings of
+                // that node, so their layers keep Arity - 1 elements.
+                //
+                // The bottom rows of a large tree can be pruned to save memory, see prune_rows(). Indices passed to
+                // operator[] and at() are always the ones of the complete tree, only the nodes of the rows still
+                // stored can be accessed, and iterators run over the stored nodes.
                 template<typename NodeType, size_t Arity = 2>
                 struct merkle_tree_impl {
                     typedef NodeType node_type;
@@ -192,26 +225,28 @@ namespace nil {
                     typedef typename container_type::reverse_iterator reverse_iterator;
                     typedef typename container_type::const_reverse_iterator const_reverse_iterator;
 
-                    merkle_tree_impl() : _size(0), _leaves(0), _rc(0) { };
+                    merkle_tree_impl() : _size(0), _leaves(0), _rc(0), _pruned_rows(0), _pruned_size(0) { };
 
                     ~merkle_tree_impl() = default;
 
                     merkle_tree_impl(size_t n) :
                         _size(detail::merkle_tree_length(n, Arity)), _leaves(n),
-                        _rc(detail::merkle_tree_row_count(n, Arity)) {
-                        BOOST_ASSERT_MSG(pow(Arity, round(std::log(n) / std::log(Arity))) == n,
-                                         "Wrong leaves number, it must be a power of Arity.");
+                        _rc(detail::merkle_tree_row_count(n, Arity)), _pruned_rows(0), _pruned_size(0) {
+                        BOOST_ASSERT_MSG(n != 0, "Merkle tree needs at least one leaf.");
                     }
 
                     merkle_tree_impl(const merkle_tree_impl &x) :
-                        _hashes(x._hashes), _size(x._size), _leaves(x._leaves), _rc(x._rc) {
+                        _hashes(x._hashes), _size(x._size), _leaves(x._leaves), _rc(x._rc),
+                        _pruned_rows(x._pruned_rows), _pruned_size(x._pruned_size) {
                     }
 
                     merkle_tree_impl(const merkle_tree_impl &x, const allocator_type &a) :
-                        _hashes(x.hashes(), a), _size(x._size), _leaves(x._leaves), _rc(x._rc) {
+                        _hashes(x.hashes(), a), _size(x._size), _leaves(x._leaves), _rc(x._rc),
+                        _pruned_rows(x._pruned_rows), _pruned_size(x._pruned_size) {
                     }
 
-                    merkle_tree_impl(const std::initializer_list<value_type> &il) : _hashes(il) {
+                    merkle_tree_impl(const std::initializer_list<value_type> &il) :
+                        _hashes(il), _pruned_rows(0), _pruned_size(0) {
                         set_leaves(detail::merkle_tree_leaves(std::distance(il.begin(), il.end()), Arity));
                         set_row_count(detail::merkle_tree_row_count(_leaves, Arity));
                         set_complete_size(detail::merkle_tree_length(_leaves, Arity));
@@ -220,14 +255,15 @@ namespace nil {
                     template<typename Iterator,
                              typename std::enable_if<std::is_same<typename Iterator::value_type, value_type>::value,
                                                      bool>::type = true>
-                    merkle_tree_impl(Iterator first, Iterator last) : _hashes(first, last) {
+                    merkle_tree_impl(Iterator first, Iterator last) :
+                        _hashes(first, last), _pruned_rows(0), _pruned_size(0) {
                         set_leaves(detail::merkle_tree_leaves(std::distance(first, last), Arity));
                         set_row_count(detail::merkle_tree_row_count(_leaves, Arity));
                         set_complete_size(detail::merkle_tree_length(_leaves, Arity));
                     }
 
                     merkle_tree_impl(const std::initializer_list<value_type> &il, const allocator_type &a) :
-                        _hashes(il, a) {
+                        _hashes(il, a), _pruned_rows(0), _pruned_size(0) {
                         set_leaves(detail::merkle_tree_leaves(std::distance(il.begin(), il.end()), Arity));
                         set_row_count(detail::merkle_tree_row_count(_leaves, Arity));
                         set_complete_size(detail::merkle_tree_length(_leaves, Arity));
@@ -235,15 +271,19 @@ namespace nil {
 
                     merkle_tree_impl(merkle_tree_impl &&x)
                         BOOST_NOEXCEPT(std::is_nothrow_move_constructible<allocator_type>::value) :
-                        _hashes(x._hashes), _size(x._size), _leaves(x._leaves), _rc(x._rc) {
+                        _hashes(x._hashes), _size(x._size), _leaves(x._leaves), _rc(x._rc),
+                        _pruned_rows(x._pruned_rows), _pruned_size(x._pruned_size) {
                     }
 
                     merkle_tree_impl(merkle_tree_impl &&x, const allocator_type &a) :
-                        _hashes(x.hashes(), a), _size(x._size), _leaves(x._leaves), _rc(x._rc) {
+                        _hashes(x.hashes(), a), _size(x._size), _leaves(x._leaves), _rc(x._rc),
+                        _pruned_rows(x._pruned_rows), _pruned_size(x._pruned_size) {
                     }
 
                     merkle_tree_impl &operator=(const merkle_tree_impl &x) {
                         _hashes = x.hashes();
+                        _pruned_rows = x._pruned_rows;
+                        _pruned_size = x._pruned_size;
                         return *this;
                     }
 
@@ -252,11 +292,13 @@ namespace nil {
                         _size = x._size;
                         _leaves = x._leaves;
                         _rc = x._rc;
+                        _pruned_rows = x._pruned_rows;
+                        _pruned_size = x._pruned_size;
                         return *this;
                     }
 
                     bool operator==(const merkle_tree_impl &rhs) const {
-                        return _hashes == rhs._hashes;
+                        return _pruned_rows == rhs._pruned_rows && _hashes == rhs._hashes;
                     }
 
                     bool operator!=(const merkle_tree_impl &rhs) const {
@@ -344,19 +386,27 @@ namespace nil {
                     }
 
                     reference operator[](size_type _n) BOOST_NOEXCEPT {
-                        return _hashes[_n];
+                        BOOST_ASSERT_MSG(_n >= _pruned_size, "Merkle tree node is pruned");
+                        return _hashes[_n - _pruned_size];
                     }
 
                     const_reference operator[](size_type _n) const BOOST_NOEXCEPT {
-                        return _hashes[_n];
+                        BOOST_ASSERT_MSG(_n >= _pruned_size, "Merkle tree node is pruned");
+                        return _hashes[_n - _pruned_size];
                     }
 
                     reference at(size_type _n) {
-                        return _hashes.at(_n);
+                        if (_n < _pruned_size) {
+                            throw std::out_of_range("Merkle tree node is pruned");
+                        }
+                        return _hashes.at(_n - _pruned_size);
                     }
 
                     const_reference at(size_type _n) const {
-                        return _hashes.at(_n);
+                        if (_n < _pruned_size) {
+                            throw std::out_of_range("Merkle tree node is pruned");
+                        }
+                        return _hashes.at(_n - _pruned_size);
                     }
 
                     reference front() BOOST_NOEXCEPT {
@@ -428,13 +478,73 @@ namespace nil {
                     }
 
                     value_type root() const BOOST_NOEXCEPT {
-                        BOOST_ASSERT_MSG(_size == _hashes.size(), "MerkleTree not fulfilled");
-                        return _hashes[_size - 1];
+                        BOOST_ASSERT_MSG(_size == _pruned_size + _hashes.size(), "MerkleTree not fulfilled");
+                        return _hashes[_size - _pruned_size - 1];
                     }
 
                     value_type root() BOOST_NOEXCEPT {
-                        BOOST_ASSERT_MSG(_size == _hashes.size(), "MerkleTree not fulfilled");
-                        return _hashes[_size - 1];
+                        BOOST_ASSERT_MSG(_size == _pruned_size + _hashes.size(), "MerkleTree not fulfilled");
+                        return _hashes[_size - _pruned_size - 1];
+                    }
+
+                    // Number of nodes in the given row, row 0 being the leaves.
+                    size_t row_length(size_t row) const {
+                        size_t row_len = _leaves;
+                        for (; row != 0; --row) {
+                            row_len = merkle_tree_next_row_length(row_len, Arity);
+                        }
+                        return row_len;
+                    }
+
+                    // Index of the first node of the given row in the complete tree.
+                    size_t row_begin(size_t row) const {
+                        size_t begin = 0;
+                        for (size_t row_len = _leaves; row != 0;
+                             --row, row_len = merkle_tree_next_row_length(row_len, Arity)) {
+                            begin += row_len;
+                        }
+                        return begin;
+                    }
+
+                    // Returns the Merkle cap of the given height: the at most Arity^cap_height nodes cap_height
+                    // rows below the root. Committing to the cap instead of the root shortens every proof by
+                    // cap_height layers, a height of 0 gives the root alone.
+                    container_type cap(size_t cap_height) const {
+                        BOOST_ASSERT_MSG(cap_height < _rc, "Merkle cap is higher than the tree");
+                        const size_t row = _rc - 1 - cap_height;
+                        BOOST_ASSERT_MSG(row >= _pruned_rows, "Merkle cap row is pruned");
+                        const size_t begin = row_begin(row) - _pruned_size;
+                        return container_type(_hashes.begin() + begin, _hashes.begin() + begin + row_length(row));
+                    }
+
+                    // Drops the bottom rows of a built tree, the leaf hashes first. Proofs for a pruned tree
+                    // recompute the dropped nodes of the needed subtree from the leaves, see merkle_proof_impl.
+                    void prune_rows(size_t rows) {
+                        BOOST_ASSERT_MSG(rows < _rc, "The root row can not be pruned");
+                        BOOST_ASSERT_MSG(rows >= _pruned_rows, "Pruned rows can not be restored");
+                        const size_t pruned_size = row_begin(rows);
+                        _hashes.erase(_hashes.begin(),
+                                      _hashes.begin() + std::min(pruned_size - _pruned_size, _hashes.size()));
+                        _hashes.shrink_to_fit();
+                        _pruned_rows = rows;
+                        _pruned_size = pruned_size;
+                    }
+
+                    // Marks the bottom rows of a tree that is not filled yet as pruned, so that only the upper
+                    // complete_size() - pruned_size() nodes get stored.
+                    void set_pruned_rows(size_t rows) {
+                        BOOST_ASSERT_MSG(_hashes.empty(), "Tree is already filled, use prune_rows");
+                        BOOST_ASSERT_MSG(rows < _rc, "The root row can not be pruned");
+                        _pruned_rows = rows;
+                        _pruned_size = row_begin(rows);
+                    }
+
+                    size_t pruned_rows() const {
+                        return _pruned_rows;
+                    }
+
+                    size_t pruned_size() const {
+                        return _pruned_size;
                     }
 
                     size_t row_count() const {
@@ -470,6 +580,9 @@ namespace nil {
                     //
                     // Internally, this code considers only the _rc.
                     size_t _rc;
+                    // Number of bottom rows, and of the nodes in them, which are not stored.
+                    size_t _pruned_rows;
+                    size_t _pruned_size;
                 };
 
                 template<typename T, typename LeafIterator>
@@ -481,6 +594,128 @@ namespace nil {
                     return accumulators::extract::hash<T>(acc);
                 }
 
+                // Compresses the Arity children of a node into the node value, by default by hashing them one after
+                // another, see generate_hash.
+                template<typename HashType, std::size_t Arity, typename Enable = void>
+                struct merkle_node_compressor {
+                    template<typename NodeIterator>
+                    static typename HashType::digest_type compress(NodeIterator first, NodeIterator last) {
+                        return generate_hash<HashType>(first, last);
+                    }
+                };
+
+                // Algebraic sponges, such as Poseidon, whose rate fits all the children of a node: the children are
+                // written into one block and compressed with a single permutation. The result is the same as with
+                // generate_hash, which also runs the squeeze permutation and goes through the accumulator buffers.
+                template<typename HashType, std::size_t Arity>
+                    requires requires(const typename HashType::construction::type::block_type &block) {
+                        {
+                            HashType::construction::type::hash_single_block(block, Arity)
+                        } -> std::same_as<typename HashType::digest_type>;
+                    } && std::is_same_v<typename HashType::digest_type, typename HashType::word_type> &&
+                             (Arity <= HashType::construction::type::block_words)
+                struct merkle_node_compressor<HashType, Arity> {
+                    using construction_type = typename HashType::construction::type;
+
+                    template<typename NodeIterator>
+                    static typename HashType::digest_type compress(NodeIterator first, NodeIterator last) {
+                        typename construction_type::block_type block;
+                        std::copy(first, last, block.begin());
+                        return construction_type::hash_single_block(block, Arity);
+                    }
+                };
+
+                // Compresses the children of the node 'index' of the row above the row_len nodes starting at
+                // row. Children past the end of the row are default digests.
+                template<typename HashType, std::size_t Arity, typename NodeIterator>
+                typename HashType::digest_type compress_merkle_node(NodeIterator row, std::size_t row_len,
+                                                                    std::size_t index) {
+                    if ((index + 1) * Arity <= row_len) {
+                        return merkle_node_compressor<HashType, Arity>::compress(row + index * Arity,
+                                                                                 row + (index + 1) * Arity);
+                    }
+                    std::array<typename std::iterator_traits<NodeIterator>::value_type, Arity> children {};
+                    std::copy(row + index * Arity, row + row_len, children.begin());
+                    return merkle_node_compressor<HashType, Arity>::compress(children.begin(), children.end());
+                }
+
+                // Compresses the nodes first, ..., last - 1 of the row above the row_len nodes starting at row
+                // into out, one node at a time.
+                template<typename HashType, std::size_t Arity, typename Enable = void>
+                struct merkle_row_compressor {
+                    template<typename NodeIterator, typename OutputIterator>
+                    static void compress(NodeIterator row, std::size_t row_len, std::size_t first, std::size_t last,
+                                         OutputIterator out) {
+                        for (std::size_t index = first; index < last; ++index) {
+                            *out++ = compress_merkle_node<HashType, Arity>(row, row_len, index);
+                        }
+                    }
+                };
+
+                // SHA-224/SHA-256 nodes hash the bytes of their children, which lie back to back in a stored row,
+                // so the nodes with all their children in the row go through sha2_multi_buffer together.
+                template<std::size_t Version, std::size_t Arity>
+                struct merkle_row_compressor<hashes::sha2<Version>, Arity,
+                                             std::enable_if_t<Version == 224 || Version == 256>> {
+                    typedef hashes::sha2<Version> hash_type;
+                    typedef typename hash_type::digest_type digest_type;
+
+                    template<typename NodeIterator, typename OutputIterator>
+                    static void compress(NodeIterator row, std::size_t row_len, std::size_t first, std::size_t last,
+                                         OutputIterator out) {
+                        if constexpr (std::contiguous_iterator<NodeIterator> &&
+                                      std::is_same_v<std::iter_value_t<NodeIterator>, digest_type>) {
+                            const std::size_t full = std::max(first, std::min(last, row_len / Arity));
+                            std::array<const std::uint8_t *, 64> messages;
+                            std::array<digest_type, 64> digests;
+                            for (std::size_t index = first; index < full;) {
+                                const std::size_t count = std::min(messages.size(), full - index);
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    messages[i] = std::to_address(row + (index + i) * Arity)->data();
+                                }
+                                hashes::sha2_multi_buffer<Version>::hash(messages.data(), Arity * sizeof(digest_type),
+                                                                         digests.data(), count);
+                                out = std::copy(digests.begin(), digests.begin() + count, out);
+                                index += count;
+                            }
+                            first = full;
+                        }
+                        // The last node of the row, whose missing children are default digests.
+                        for (std::size_t index = first; index < last; ++index) {
+                            *out++ = compress_merkle_node<hash_type, Arity>(row, row_len, index);
+                        }
+                    }
+                };
+
+                // Hashes the inner rows of a tree whose first stored row is already in place: the leaf hashes, or
+                // the lowest row kept of a pruned tree.
+                template<typename T, std::size_t Arity>
+                void build_merkle_tree_rows(merkle_tree_impl<T, Arity> &tree) {
+                    typedef typename T::hash_type hash_type;
+
+                    std::size_t prev_row_size = tree.row_length(tree.pruned_rows());
+                    typename merkle_tree_impl<T, Arity>::iterator it = tree.begin();
+
+                    std::size_t next_row_start_index = tree.row_begin(tree.pruned_rows() + 1);
+
+                    for (size_t row_number = tree.pruned_rows() + 1; row_number < tree.row_count(); ++row_number) {
+                        const std::size_t row_size = merkle_tree_next_row_length(prev_row_size, Arity);
+                        // Nodes are compressed in batches, so that multi-buffer hashes get whole groups of them.
+                        constexpr std::size_t batch_size = 64;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t batch = 0; batch < row_size; batch += batch_size) {
+                            merkle_row_compressor<hash_type, Arity>::compress(
+                                it, prev_row_size, batch, std::min(batch + batch_size, row_size),
+                                tree.begin() + next_row_start_index + batch);
+                        }
+                        next_row_start_index += row_size;
+                        it += prev_row_size;
+                        prev_row_size = row_size;
+                    }
+                }
+
                 template<typename T, std::size_t Arity, typename LeafIterator>
                 merkle_tree_impl<T, Arity> make_merkle_tree(LeafIterator first, LeafIterator last) {
                     typedef T node_type;
@@ -495,21 +730,133 @@ namespace nil {
                         return static_cast<value_type>(crypto3::hash<hash_type>(leaf));
                     });
 
-                    std::size_t row_idx = ret.leaves(), row_size = row_idx / Arity;
-                    typename merkle_tree_impl<T, Arity>::iterator it = ret.begin();
+                    build_merkle_tree_rows(ret);
+                    return ret;
+                }
 
-                    std::size_t next_row_start_index = std::distance(first, last);
+                // Builds a tree without materializing its leaves. The leaves are split into contiguous ranges,
+                // one per thread, and produce_leaves(first, last, consume) must call consume(leaf) for the leaves
+                // first, ..., last - 1 in order. A leaf only has to stay alive until consume returns, so the
+                // producer can reuse one buffer for its whole range.
+                template<typename T, std::size_t Arity, typename LeafProducer>
+                merkle_tree_impl<T, Arity> make_merkle_tree_streamed(std::size_t leaves_number,
+                                                                     LeafProducer produce_leaves) {
+                    typedef T node_type;
+                    typedef typename node_type::hash_type hash_type;
+                    typedef typename node_type::value_type value_type;
 
-                    for (size_t row_number = 1; row_number < ret.row_count(); ++row_number, row_size /= Arity) {
-                        for (std::size_t index = 0; index < row_size; ++index) {
-                            ret[next_row_start_index + index] =
-                                generate_hash<hash_type>(it + index * Arity, it + (index + 1) * Arity);
+                    merkle_tree_impl<T, Arity> ret(leaves_number);
+                    ret.resize(ret.complete_size());
+
+#ifdef MULTICORE
+                    const std::size_t chunks =
+                        std::max<std::size_t>(1, std::min<std::size_t>(omp_get_max_threads(), leaves_number));
+#else
+                    const std::size_t chunks = 1;
+#endif
+                    const std::size_t chunk_size = (leaves_number + chunks - 1) / chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                        const std::size_t first = std::min(chunk * chunk_size, leaves_number);
+                        const std::size_t last = std::min(first + chunk_size, leaves_number);
+                        auto out = ret.begin() + first;
+                        produce_leaves(first, last, [&out](const auto &leaf) {
+                            *out++ = static_cast<value_type>(crypto3::hash<hash_type>(leaf));
+                        });
+                    }
+
+                    build_merkle_tree_rows(ret);
+                    return ret;
+                }
+
+                // Hashes the leaves first, ..., last - 1, at most Arity^rows of them, and the rows above them up
+                // to a single node, all laid out row after row as in a tree. These are the nodes a tree with
+                // 'rows' pruned rows does not store under one node of its lowest stored row, which is the last
+                // element returned. produce_leaves has the same contract as for make_merkle_tree_streamed.
+                template<typename T, std::size_t Arity, typename LeafProducer>
+                std::vector<typename T::value_type> make_merkle_subtree_rows(std::size_t first, std::size_t last,
+                                                                            std::size_t rows,
+                                                                            LeafProducer &produce_leaves) {
+                    typedef T node_type;
+                    typedef typename node_type::hash_type hash_type;
+                    typedef typename node_type::value_type value_type;
+
+                    BOOST_ASSERT_MSG(first < last && last - first <= merkle_subtree_leaves(rows, Arity),
+                                     "Leaves do not fit the subtree");
+
+                    std::vector<value_type> nodes;
+                    // Reserved upfront, the rows are hashed from iterators into the vector itself.
+                    nodes.reserve(merkle_tree_length(last - first, Arity) + rows);
+                    produce_leaves(first, last, [&nodes](const auto &leaf) {
+                        nodes.push_back(static_cast<value_type>(crypto3::hash<hash_type>(leaf)));
+                    });
+
+                    // A short subtree at the end of the tree can reach a single node early, its remaining rows
+                    // still compress that node with default siblings as the tree does.
+                    std::size_t row_begin = 0;
+                    std::size_t row_len = last - first;
+                    for (std::size_t row = 0; row < rows; ++row) {
+                        const std::size_t next_row_len = merkle_tree_next_row_length(row_len, Arity);
+                        for (std::size_t index = 0; index < next_row_len; ++index) {
+                            nodes.push_back(
+                                compress_merkle_node<hash_type, Arity>(nodes.begin() + row_begin, row_len, index));
                         }
-                        next_row_start_index += row_size;
-                        it += row_size * Arity;
+                        row_begin += row_len;
+                        row_len = next_row_len;
                     }
+                    return nodes;
+                }
+
+                // Same as make_merkle_tree_streamed, but the bottom pruned_rows rows of the tree are never stored,
+                // so that the memory taken is about Arity^-pruned_rows of the complete tree. The leaves are
+                // produced one subtree of the pruned rows at a time.
+                template<typename T, std::size_t Arity, typename LeafProducer>
+                merkle_tree_impl<T, Arity> make_pruned_merkle_tree_streamed(std::size_t leaves_number,
+                                                                            std::size_t pruned_rows,
+                                                                            LeafProducer produce_leaves) {
+                    merkle_tree_impl<T, Arity> ret(leaves_number);
+                    ret.set_pruned_rows(pruned_rows);
+                    ret.resize(ret.complete_size() - ret.pruned_size());
+
+                    const std::size_t subtrees = ret.row_length(pruned_rows);
+                    const std::size_t subtree_leaves = merkle_subtree_leaves(pruned_rows, Arity);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t subtree = 0; subtree < subtrees; ++subtree) {
+                        const std::size_t first = subtree * subtree_leaves;
+                        ret.begin()[subtree] =
+                            make_merkle_subtree_rows<T, Arity>(
+                                first, std::min(first + subtree_leaves, leaves_number), pruned_rows, produce_leaves)
+                                .back();
+                    }
+
+                    build_merkle_tree_rows(ret);
                     return ret;
                 }
+
+                // Hashes a Merkle cap, see merkle_tree_impl::cap, up to the root of its tree. Only a cap of the
+                // length of its tree row gives that root back, the caller checks the length.
+                template<typename T, std::size_t Arity, typename NodeContainer>
+                typename T::value_type merkle_cap_root(const NodeContainer &cap) {
+                    typedef typename T::hash_type hash_type;
+                    typedef typename T::value_type value_type;
+
+                    BOOST_ASSERT_MSG(!cap.empty(), "Merkle cap is empty");
+
+                    std::vector<value_type> row(cap.begin(), cap.end());
+                    while (row.size() > 1) {
+                        std::vector<value_type> next_row(merkle_tree_next_row_length(row.size(), Arity));
+                        for (std::size_t index = 0; index < next_row.size(); ++index) {
+                            next_row[index] = compress_merkle_node<hash_type, Arity>(row.begin(), row.size(), index);
+                        }
+                        row = std::move(next_row);
+                    }
+                    return row.front();
+                }
             }    // namespace detail
 
             template<typename T, std::size_t Arity>
@@ -525,6 +872,31 @@ namespace nil {
                                                 Arity>(first, last);
             }
 
+            template<typename T, std::size_t Arity, typename LeafProducer>
+            merkle_tree<T, Arity> make_merkle_tree_streamed(std::size_t leaves_number, LeafProducer produce_leaves) {
+                return detail::make_merkle_tree_streamed<
+                    typename std::conditional<nil::crypto3::detail::is_hash<T>::value, detail::merkle_tree_node<T>,
+                                              T>::type,
+                    Arity>(leaves_number, produce_leaves);
+            }
+
+            template<typename T, std::size_t Arity, typename LeafProducer>
+            merkle_tree<T, Arity> make_pruned_merkle_tree_streamed(std::size_t leaves_number, std::size_t pruned_rows,
+                                                                  LeafProducer produce_leaves) {
+                return detail::make_pruned_merkle_tree_streamed<
+                    typename std::conditional<nil::crypto3::detail::is_hash<T>::value, detail::merkle_tree_node<T>,
+                                              T>::type,
+                    Arity>(leaves_number, pruned_rows, produce_leaves);
+            }
+
+            template<typename T, std::size_t Arity, typename NodeContainer>
+            typename merkle_tree<T, Arity>::value_type merkle_cap_root(const NodeContainer &cap) {
+                return detail::merkle_cap_root<typename std::conditional<nil::crypto3::detail::is_hash<T>::value,
+                                                                         detail::merkle_tree_node<T>,
+                                                                         T>::type,
+                                               Arity>(cap);
+            }
+
         }    // namespace containers
     }    // namespace crypto3
 }    // namespace nil
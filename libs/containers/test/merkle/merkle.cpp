@@ -37,6 +37,7 @@
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
+#include <nil/crypto3/container/merkle/multiproof.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -279,6 +280,114 @@ void testing_hash_template(std::vector<Element> data, std::string result) {
     BOOST_CHECK(result == std::to_string(tree.root()));
 }
 
+template<typename Hash, size_t Arity, typename ValueType, std::size_t N>
+void testing_validate_template_random_data_multiproof(std::size_t leaf_number, std::size_t query_number) {
+    std::array<ValueType, N> data_not_in_tree = {0};
+    auto data = generate_random_data<ValueType, N>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+
+    std::vector<std::size_t> indices;
+    std::vector<std::array<ValueType, N>> leaves;
+    for (std::size_t i = 0; i < query_number; ++i) {
+        indices.push_back((i * 7919) % leaf_number);
+        leaves.push_back(data[indices.back()]);
+    }
+    // Repeated queries must be accepted as well.
+    indices.push_back(indices.front());
+    leaves.push_back(leaves.front());
+
+    merkle_multiproof<Hash, Arity> multiproof(tree, indices);
+    BOOST_CHECK(multiproof.validate(tree.root(), tree.leaves(), indices, leaves));
+
+    std::vector<std::size_t> distinct_indices = indices;
+    std::sort(distinct_indices.begin(), distinct_indices.end());
+    distinct_indices.erase(std::unique(distinct_indices.begin(), distinct_indices.end()), distinct_indices.end());
+    std::size_t proofs_size = 0;
+    for (std::size_t idx : distinct_indices) {
+        merkle_proof<Hash, Arity> proof(tree, idx);
+        proofs_size += proof.path().size() * (Arity - 1);
+    }
+    BOOST_CHECK(multiproof.nodes().size() <= proofs_size);
+
+    // Only the nodes are kept, so a copy made from them validates the same way.
+    merkle_multiproof<Hash, Arity> restored(multiproof.nodes());
+    BOOST_CHECK(restored == multiproof);
+    BOOST_CHECK(restored.validate(tree.root(), tree.leaves(), indices, leaves));
+
+    auto wrong_leaves = leaves;
+    wrong_leaves[1] = data_not_in_tree;
+    BOOST_CHECK(!multiproof.validate(tree.root(), tree.leaves(), indices, wrong_leaves));
+
+    auto wrong_indices = indices;
+    wrong_indices[1] = (wrong_indices[1] + 1) % leaf_number;
+    BOOST_CHECK(!multiproof.validate(tree.root(), tree.leaves(), wrong_indices, leaves));
+
+    auto out_of_tree_indices = indices;
+    out_of_tree_indices[1] = leaf_number;
+    BOOST_CHECK(!multiproof.validate(tree.root(), tree.leaves(), out_of_tree_indices, leaves));
+
+    BOOST_CHECK(!multiproof.validate(tree.root(), tree.leaves() * Arity, indices, leaves));
+}
+
+template<typename Hash, size_t Arity>
+void testing_not_power_of_arity_template(std::size_t leaf_number, std::size_t pruned_rows) {
+    auto data = generate_random_data<std::uint8_t, 8>(leaf_number);
+    auto tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+    auto produce_leaves = [&data](std::size_t first, std::size_t last, auto&& consume_leaf) {
+        for (std::size_t i = first; i < last; ++i) {
+            consume_leaf(data[i]);
+        }
+    };
+
+    // Every row is ceil(n / Arity) long, the last node of a row hashes default digests in place of the
+    // missing children.
+    std::size_t row_len = leaf_number, row_count = 1, size = leaf_number;
+    for (; row_len > 1; ++row_count) {
+        row_len = (row_len + Arity - 1) / Arity;
+        size += row_len;
+    }
+    BOOST_CHECK_EQUAL(tree.row_count(), row_count);
+    BOOST_CHECK_EQUAL(tree.size(), size);
+    merkle_tree<Hash, Arity> restored(tree.begin(), tree.end());
+    BOOST_CHECK_EQUAL(restored.leaves(), leaf_number);
+
+    const std::size_t last_row = tree.row_begin(tree.row_count() - 2);
+    std::array<typename merkle_tree<Hash, Arity>::value_type, Arity> children {};
+    std::copy(tree.begin() + last_row, tree.begin() + last_row + tree.row_length(tree.row_count() - 2),
+              children.begin());
+    BOOST_CHECK(tree.root() == containers::detail::generate_hash<Hash>(children.begin(), children.end()));
+
+    for (std::size_t leaf_idx = 0; leaf_idx < leaf_number; ++leaf_idx) {
+        merkle_proof<Hash, Arity> proof(tree, leaf_idx);
+        BOOST_CHECK_EQUAL(proof.path().size(), tree.row_count() - 1);
+        BOOST_CHECK(proof.validate(data[leaf_idx]));
+        BOOST_CHECK(!proof.validate(data[(leaf_idx + 1) % leaf_number]));
+
+        merkle_proof<Hash, Arity> cap_proof(tree, leaf_idx, 1);
+        BOOST_CHECK(cap_proof.validate(data[leaf_idx], tree.cap(1)));
+    }
+    for (std::size_t cap_height = 0; cap_height < tree.row_count(); ++cap_height) {
+        auto cap = tree.cap(cap_height);
+        BOOST_CHECK_EQUAL(cap.size(),
+                          containers::detail::merkle_tree_row_length(leaf_number, Arity,
+                                                                     tree.row_count() - 1 - cap_height));
+        BOOST_CHECK((merkle_cap_root<Hash, Arity>(cap) == tree.root()));
+    }
+
+    merkle_tree<Hash, Arity> pruned =
+        make_pruned_merkle_tree_streamed<Hash, Arity>(leaf_number, pruned_rows, produce_leaves);
+    auto pruned_copy = tree;
+    pruned_copy.prune_rows(pruned_rows);
+    BOOST_CHECK(pruned_copy == pruned);
+    for (std::size_t leaf_idx : {std::size_t(0), leaf_number / 2, leaf_number - 1}) {
+        merkle_proof<Hash, Arity> proof(pruned, leaf_idx, 0, produce_leaves);
+        BOOST_CHECK((proof == merkle_proof<Hash, Arity>(tree, leaf_idx)));
+    }
+
+    testing_validate_template_random_data_multiproof<Hash, Arity, std::uint8_t, 8>(leaf_number, leaf_number / 3);
+    testing_validate_template_random_data_compressed_proofs<Hash, Arity, std::uint8_t, 1>(leaf_number);
+}
+
 BOOST_AUTO_TEST_SUITE(containers_merkltree_test)
 
 using field_type = algebra::fields::bls12_scalar_field<381>;
@@ -382,4 +491,98 @@ BOOST_AUTO_TEST_CASE(merkletree_hash_test_2) {
     testing_hash_template<hashes::sha2<256>, 3>(v, "6831d4d32538bedaa7a51970ac10474d5884701c840781f0a434e5b6868d4b73");
 }
 
+BOOST_AUTO_TEST_CASE(merkletree_streamed_test) {
+    auto data = generate_random_data<std::uint8_t, 8>(64);
+    auto expected = make_merkle_tree<hashes::sha2<256>, 2>(data.begin(), data.end());
+
+    // Leaves are produced from a single reused buffer, as a batched precommit does.
+    merkle_tree<hashes::sha2<256>, 2> tree = make_merkle_tree_streamed<hashes::sha2<256>, 2>(
+        data.size(), [&data](std::size_t first, std::size_t last, auto&& consume_leaf) {
+            std::array<std::uint8_t, 8> leaf;
+            for (std::size_t i = first; i < last; ++i) {
+                leaf = data[i];
+                consume_leaf(leaf);
+            }
+        });
+    BOOST_CHECK(tree == expected);
+    BOOST_CHECK(tree.root() == expected.root());
+}
+
+template<typename Hash, std::size_t Arity>
+void testing_multi_buffer_rows_template(std::size_t leaf_number) {
+    auto data = generate_random_data<std::uint8_t, 5>(leaf_number);
+    merkle_tree<Hash, Arity> tree = make_merkle_tree<Hash, Arity>(data.begin(), data.end());
+
+    // Inner rows are hashed through sha2_multi_buffer, every node has to match compressing it on its own.
+    for (std::size_t row = 0; row + 1 < tree.row_count(); ++row) {
+        const std::size_t row_begin = tree.row_begin(row);
+        const std::size_t next_row_begin = tree.row_begin(row + 1);
+        for (std::size_t index = 0; index < tree.row_length(row + 1); ++index) {
+            BOOST_CHECK(tree[next_row_begin + index] ==
+                        (containers::detail::compress_merkle_node<Hash, Arity>(tree.begin() + row_begin,
+                                                                               tree.row_length(row), index)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_multi_buffer_rows_test) {
+    for (std::size_t leaf_number : {9, 100, 1024, 5000}) {
+        testing_multi_buffer_rows_template<hashes::sha2<256>, 2>(leaf_number);
+        testing_multi_buffer_rows_template<hashes::sha2<256>, 3>(leaf_number);
+        testing_multi_buffer_rows_template<hashes::sha2<256>, 8>(leaf_number);
+        testing_multi_buffer_rows_template<hashes::sha2<224>, 4>(leaf_number);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_multiproof_test) {
+    testing_validate_template_random_data_multiproof<hashes::sha2<256>, 2, std::uint8_t, 8>(1024, 50);
+    testing_validate_template_random_data_multiproof<hashes::sha2<256>, 4, std::uint8_t, 8>(256, 20);
+    testing_validate_template_random_data_multiproof<hashes::keccak_1600<256>, 2, std::uint8_t, 8>(64, 64);
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_cap_and_pruned_rows_test) {
+    using hash_type = hashes::sha2<256>;
+    auto data = generate_random_data<std::uint8_t, 8>(256);
+    auto tree = make_merkle_tree<hash_type, 2>(data.begin(), data.end());
+    auto produce_leaves = [&data](std::size_t first, std::size_t last, auto&& consume_leaf) {
+        for (std::size_t i = first; i < last; ++i) {
+            consume_leaf(data[i]);
+        }
+    };
+
+    for (std::size_t cap_height : {0, 3, 7}) {
+        auto cap = tree.cap(cap_height);
+        BOOST_CHECK_EQUAL(cap.size(), std::size_t(1) << cap_height);
+        BOOST_CHECK((merkle_cap_root<hash_type, 2>(cap) == tree.root()));
+        for (std::size_t leaf_idx : {0, 77, 255}) {
+            merkle_proof<hash_type, 2> proof(tree, leaf_idx, cap_height);
+            BOOST_CHECK_EQUAL(proof.path().size(), tree.row_count() - 1 - cap_height);
+            BOOST_CHECK(proof.validate(data[leaf_idx], cap));
+            BOOST_CHECK(!proof.validate(data[(leaf_idx + 1) % data.size()], cap));
+        }
+    }
+
+    merkle_tree<hash_type, 2> pruned = make_pruned_merkle_tree_streamed<hash_type, 2>(data.size(), 4, produce_leaves);
+    BOOST_CHECK(pruned.root() == tree.root());
+    BOOST_CHECK_EQUAL(pruned.size(), tree.size() - tree.row_begin(4));
+    auto pruned_copy = tree;
+    pruned_copy.prune_rows(4);
+    BOOST_CHECK(pruned_copy == pruned);
+    for (std::size_t leaf_idx : {0, 77, 255}) {
+        merkle_proof<hash_type, 2> proof(pruned, leaf_idx, 2, produce_leaves);
+        BOOST_CHECK((proof == merkle_proof<hash_type, 2>(tree, leaf_idx, 2)));
+        BOOST_CHECK(proof.validate(data[leaf_idx], tree.cap(2)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkletree_not_power_of_arity_test) {
+    // Power of 2 leaves under wider trees, as FRI commits them, and a few odd counts.
+    testing_not_power_of_arity_template<hashes::sha2<256>, 4>(8, 1);
+    testing_not_power_of_arity_template<hashes::sha2<256>, 4>(32, 2);
+    testing_not_power_of_arity_template<hashes::sha2<256>, 8>(32, 1);
+    testing_not_power_of_arity_template<hashes::sha2<256>, 8>(16, 1);
+    testing_not_power_of_arity_template<hashes::sha2<256>, 3>(10, 1);
+    testing_not_power_of_arity_template<hashes::sha2<256>, 2>(13, 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
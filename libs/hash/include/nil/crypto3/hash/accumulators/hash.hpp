@@ -40,6 +40,8 @@
 #include <nil/crypto3/detail/make_array.hpp>
 #include <nil/crypto3/detail/static_digest.hpp>
 
+#include <nil/crypto3/block/detail/block_batch.hpp>
+
 #include <nil/crypto3/hash/accumulators/bits_count.hpp>
 #include <nil/crypto3/hash/accumulators/parameters/iterator_last.hpp>
 #include <nil/crypto3/hash/accumulators/parameters/words_to_consume.hpp>
@@ -112,6 +114,42 @@ namespace nil {
                         process(value, bits == 0 ? word_bits : bits);
                     }
 
+                    inline void resolve_type(const block::detail::block_batch<block_type> &batch, std::size_t) {
+                        process(batch.blocks, batch.size);
+                    }
+
+                    /*!
+                     * @brief Processes whole blocks. While the cache holds no partial block they go straight to the
+                     * construction, so constructions able to compress several blocks per call get all of them.
+                     */
+                    inline void process(const block_type *blocks, std::size_t size) {
+                        if (!cache_.is_empty()) {
+                            for (std::size_t i = 0; i != size; ++i) {
+                                process(blocks[i], block_bits);
+                            }
+                            return;
+                        }
+
+                        if constexpr (nil::crypto3::hashes::is_sponge_construction<
+                                          typename hash_type::construction::type>::value) {
+                            for (std::size_t i = 0; i != size; ++i) {
+                                construction.absorb(blocks[i]);
+                            }
+                        } else if constexpr (requires { construction.process_blocks(blocks, size); }) {
+                            construction.process_blocks(blocks, size);
+                        } else {
+                            for (std::size_t i = 0; i != size; ++i) {
+                                construction.process_block(blocks[i]);
+                            }
+                        }
+
+                        // The cache keeps the last block it flushed, finalization of some constructions reads it
+                        if (size != 0) {
+                            cache_.get_block() = blocks[size - 1];
+                        }
+                        total_seen_ += size * block_bits;
+                    }
+
                     inline void process(const block_type &value, std::size_t bits_seen) {
                         std::size_t processed_bits = 0;
 
@@ -98,6 +98,17 @@ namespace nil {
                     return *this;
                 }
 
+                inline merkle_damgard_construction &process_blocks(const block_type *blocks, std::size_t count) {
+                    if constexpr (requires { compressor_functor::process_blocks(state_, blocks, count); }) {
+                        compressor_functor::process_blocks(state_, blocks, count);
+                    } else {
+                        for (std::size_t i = 0; i != count; ++i) {
+                            compressor_functor::process_block(state_, blocks[i]);
+                        }
+                    }
+                    return *this;
+                }
+
                 inline digest_type digest(const block_type &block = block_type(),
                                           length_type total_seen = length_type()) {
                     using namespace nil::crypto3::detail;
@@ -111,12 +111,12 @@ namespace nil {
                         // Multiplying by it only needs one dense dot product for state[0]. Every other
                         // coordinate keeps its old value and receives old_state[0] * v[i - 1].
                         const element_type old_first_element = state[0];
-                        element_type new_first_element = zero();
+                        algebra::fields::unreduced_accumulator<element_type> new_first_element;
                         for (std::size_t i = 0; i < state_words; ++i) {
-                            new_first_element += sparse_first_rows[round][i] * state[i];
+                            new_first_element.mul_add(sparse_first_rows[round][i], state[i]);
                         }
 
-                        state[0] = new_first_element;
+                        state[0] = new_first_element.reduce();
                         for (std::size_t i = 1; i < state_words; ++i) {
                             state[i] += old_first_element * sparse_columns[round][i - 1];
                         }
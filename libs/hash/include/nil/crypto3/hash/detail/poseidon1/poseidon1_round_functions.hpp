@@ -13,6 +13,8 @@
 
 #include <boost/assert.hpp>
 
+#include <nil/crypto3/algebra/fields/unreduced_accumulator.hpp>
+
 #include <nil/crypto3/hash/detail/poseidon1/poseidon1_policy.hpp>
 
 namespace nil {
@@ -40,12 +42,14 @@ namespace nil {
 
                     template<typename MatrixType>
                     static state_type matrix_vector_mul(const MatrixType &matrix, const state_type &vector) {
+                        // Every row is reduced once, after all of its products are summed.
                         state_type result;
-                        result.fill(zero());
                         for (std::size_t i = 0; i < state_words; ++i) {
+                            algebra::fields::unreduced_accumulator<element_type> row;
                             for (std::size_t j = 0; j < state_words; ++j) {
-                                result[i] += matrix[i][j] * vector[j];
+                                row.mul_add(matrix[i][j], vector[j]);
                             }
+                            result[i] = row.reduce();
                         }
                         return result;
                     }
@@ -96,11 +100,6 @@ namespace nil {
                         apply_partial_sbox(state);
                         constants.product_with_mds_matrix(state);
                     }
-
-                private:
-                    static constexpr element_type zero() {
-                        return element_type(0u);
-                    }
                 };
 
             }    // namespace detail
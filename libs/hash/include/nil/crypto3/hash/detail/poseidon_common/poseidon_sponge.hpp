@@ -115,6 +115,22 @@ namespace nil {
                         return make_digest(block);
                     }
 
+                    /*!
+                     * @brief Digest of a message of at most one block, the first words_filled words of block.
+                     *
+                     * Equal to absorbing the message and calling digest(), without the permutation squeeze()
+                     * runs to prepare the next output block: fixed-width compressions, such as Merkle tree nodes
+                     * with at most rate children, take a single permutation.
+                     */
+                    static digest_type hash_single_block(const block_type &block, const std::size_t words_filled) {
+                        poseidon_sponge_construction sponge;
+                        sponge.absorb_with_padding(block, words_filled);
+
+                        block_type output;
+                        std::copy(sponge.state_.begin(), sponge.state_.begin() + block_words, output.begin());
+                        return make_digest(output);
+                    }
+
                     void reset() {
                         state_ = policy_type::iv_generator::generate();
                         pending_full_block_ = block_type();
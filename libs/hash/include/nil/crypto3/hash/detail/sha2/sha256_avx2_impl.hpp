@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_SHA256_AVX2_IMPL_HPP
+#define CRYPTO3_HASH_SHA256_AVX2_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <nil/crypto3/block/detail/shacal/shacal2_policy.hpp>
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief Eight independent SHA-256 compressions at once, one message per 32-bit AVX2 lane. The
+                 * state is kept transposed: word i of every lane lives in state[i]. AVX2 is only enabled for the
+                 * functions below, so callers have to check is_supported() before using them.
+                 */
+                struct sha256_avx2_impl {
+                    typedef block::detail::shacal2_policy<256> policy_type;
+
+                    constexpr static const std::size_t lanes = 8;
+
+                    static bool is_supported() {
+#if defined(__AVX2__)
+                        return true;
+#else
+                        static const bool supported = detect();
+                        return supported;
+#endif
+                    }
+
+                    /*!
+                     * @brief Transposes eight per-lane states of eight words each into the lane layout, or back.
+                     */
+                    static BOOST_ATTRIBUTE_TARGET("avx2") void transpose(__m256i *rows) {
+                        __m256i t[8];
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            t[2 * i] = _mm256_unpacklo_epi32(rows[2 * i], rows[2 * i + 1]);
+                            t[2 * i + 1] = _mm256_unpackhi_epi32(rows[2 * i], rows[2 * i + 1]);
+                        }
+                        for (std::size_t i = 0; i != 2; ++i) {
+                            for (std::size_t j = 0; j != 2; ++j) {
+                                rows[4 * i + 2 * j] = _mm256_unpacklo_epi64(t[4 * i + j], t[4 * i + j + 2]);
+                                rows[4 * i + 2 * j + 1] = _mm256_unpackhi_epi64(t[4 * i + j], t[4 * i + j + 2]);
+                            }
+                        }
+                        for (std::size_t i = 0; i != 4; ++i) {
+                            t[i] = _mm256_permute2x128_si256(rows[i], rows[i + 4], 0x20);
+                            t[i + 4] = _mm256_permute2x128_si256(rows[i], rows[i + 4], 0x31);
+                        }
+                        for (std::size_t i = 0; i != 8; ++i) {
+                            rows[i] = t[i];
+                        }
+                    }
+
+                    /*!
+                     * @brief Compresses one 64-byte big-endian block per lane into the transposed state.
+                     */
+                    static BOOST_ATTRIBUTE_TARGET("avx2") void process_block(__m256i *state,
+                                                                             const std::uint8_t *const *blocks) {
+                        const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3,
+                                                               2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+                        __m256i w[16];
+                        for (std::size_t half = 0; half != 2; ++half) {
+                            for (std::size_t lane = 0; lane != lanes; ++lane) {
+                                w[half * 8 + lane] = _mm256_shuffle_epi8(
+                                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blocks[lane]) + half), bswap);
+                            }
+                            transpose(w + half * 8);
+                        }
+
+                        __m256i a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5],
+                                g = state[6], h = state[7];
+
+                        for (std::size_t t = 0; t != policy_type::rounds; ++t) {
+                            if (t >= 16) {
+                                const __m256i w15 = w[(t - 15) % 16], w2 = w[(t - 2) % 16];
+                                w[t % 16] = _mm256_add_epi32(
+                                    _mm256_add_epi32(w[t % 16], w[(t - 7) % 16]),
+                                    _mm256_add_epi32(
+                                        _mm256_xor_si256(_mm256_xor_si256(rotr(w15, 7), rotr(w15, 18)),
+                                                         _mm256_srli_epi32(w15, 3)),
+                                        _mm256_xor_si256(_mm256_xor_si256(rotr(w2, 17), rotr(w2, 19)),
+                                                         _mm256_srli_epi32(w2, 10))));
+                            }
+
+                            const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+                            const __m256i maj = _mm256_xor_si256(_mm256_and_si256(a, b),
+                                                                 _mm256_and_si256(c, _mm256_xor_si256(a, b)));
+                            const __m256i sigma_1 =
+                                _mm256_xor_si256(_mm256_xor_si256(rotr(e, 6), rotr(e, 11)), rotr(e, 25));
+                            const __m256i sigma_0 =
+                                _mm256_xor_si256(_mm256_xor_si256(rotr(a, 2), rotr(a, 13)), rotr(a, 22));
+
+                            const __m256i k = _mm256_set1_epi32(static_cast<int>(policy_type::constants[t]));
+                            const __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, sigma_1),
+                                                                _mm256_add_epi32(ch, _mm256_add_epi32(w[t % 16], k)));
+                            const __m256i t2 = _mm256_add_epi32(sigma_0, maj);
+
+                            h = g;
+                            g = f;
+                            f = e;
+                            e = _mm256_add_epi32(d, t1);
+                            d = c;
+                            c = b;
+                            b = a;
+                            a = _mm256_add_epi32(t1, t2);
+                        }
+
+                        state[0] = _mm256_add_epi32(state[0], a);
+                        state[1] = _mm256_add_epi32(state[1], b);
+                        state[2] = _mm256_add_epi32(state[2], c);
+                        state[3] = _mm256_add_epi32(state[3], d);
+                        state[4] = _mm256_add_epi32(state[4], e);
+                        state[5] = _mm256_add_epi32(state[5], f);
+                        state[6] = _mm256_add_epi32(state[6], g);
+                        state[7] = _mm256_add_epi32(state[7], h);
+                    }
+
+                private:
+                    static bool detect() {
+                        unsigned int eax, ebx, ecx, edx;
+                        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_OSXSAVE) == 0) {
+                            return false;
+                        }
+                        // The OS has to save the SSE and AVX register states.
+                        std::uint32_t xcr0_low, xcr0_high;
+                        __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+                        if ((xcr0_low & 0x6) != 0x6) {
+                            return false;
+                        }
+                        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                            return false;
+                        }
+                        return (ebx & bit_AVX2) != 0;
+                    }
+
+                    static BOOST_ATTRIBUTE_TARGET("avx2") inline __m256i rotr(__m256i x, int n) {
+                        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+                    }
+                };
+            }    // namespace detail
+        }    // namespace hashes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_SHA256_AVX2_IMPL_HPP
@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_SHA256_COMPRESSOR_HPP
+#define CRYPTO3_HASH_SHA256_COMPRESSOR_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/block/shacal2.hpp>
+
+#include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
+#include <nil/crypto3/hash/detail/state_adder.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <nil/crypto3/hash/detail/sha2/sha256_ni_impl.hpp>
+#define CRYPTO3_HASH_SHA256_NI_SELECTED
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-224/SHA-256 compression function. Uses the SHA extensions when the running CPU has
+                 * them and falls back to the generic Davies-Meyer over SHACAL-2 otherwise.
+                 */
+                struct sha256_compressor : public davies_meyer_compressor<block::shacal2<256>, state_adder> {
+                    typedef davies_meyer_compressor<block::shacal2<256>, state_adder> generic_compressor_type;
+
+                    static_assert(sizeof(block_type) == block_words * sizeof(word_type),
+                                  "consecutive SHA-256 blocks must be contiguous words");
+
+                    /*!
+                     * @brief Whether blocks are compressed by dedicated instructions on this CPU.
+                     */
+                    inline static bool is_accelerated() {
+#if defined(CRYPTO3_HASH_SHA256_NI_SELECTED)
+                        return sha256_ni_impl::is_supported();
+#else
+                        return false;
+#endif
+                    }
+
+                    inline static void process_block(state_type &state, const block_type &block) {
+                        process_blocks(state, &block, 1);
+                    }
+
+                    inline static void process_blocks(state_type &state, const block_type *blocks, std::size_t count) {
+#if defined(CRYPTO3_HASH_SHA256_NI_SELECTED)
+                        if (sha256_ni_impl::is_supported()) {
+                            sha256_ni_impl::process_blocks(state.data(), reinterpret_cast<const word_type *>(blocks),
+                                                           count);
+                            return;
+                        }
+#endif
+                        for (std::size_t i = 0; i != count; ++i) {
+                            generic_compressor_type::process_block(state, blocks[i]);
+                        }
+                    }
+                };
+            }    // namespace detail
+        }    // namespace hashes
+    }    // namespace crypto3
+}    // namespace nil
+
+#undef CRYPTO3_HASH_SHA256_NI_SELECTED
+
+#endif    // CRYPTO3_HASH_SHA256_COMPRESSOR_HPP
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_SHA256_NI_IMPL_HPP
+#define CRYPTO3_HASH_SHA256_NI_IMPL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <nil/crypto3/detail/config.hpp>
+
+#include <nil/crypto3/block/detail/shacal/shacal2_policy.hpp>
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace detail {
+                /*!
+                 * @brief SHA-256 compression function on top of the x86 SHA extensions. The instructions are only
+                 * enabled for the functions below, so callers have to check is_supported() before using them.
+                 *
+                 * Message blocks are passed as the sixteen big-endian decoded words the stream processor produces,
+                 * so no byte shuffling is required on load.
+                 */
+                struct sha256_ni_impl {
+                    typedef block::detail::shacal2_policy<256> policy_type;
+
+                    static bool is_supported() {
+#if defined(__SHA__) && defined(__SSE4_1__)
+                        return true;
+#else
+                        static const bool supported = detect();
+                        return supported;
+#endif
+                    }
+
+                    static BOOST_ATTRIBUTE_TARGET("sha,sse4.1") void process_blocks(std::uint32_t *state,
+                                                                                    const std::uint32_t *blocks,
+                                                                                    std::size_t count) {
+                        // The rounds instructions keep the state as ABEF/CDGH halves
+                        const __m128i *words = reinterpret_cast<const __m128i *>(state);
+                        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(words), 0xB1);
+                        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(words + 1), 0x1B);
+                        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+                        state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+                        const __m128i *constants = reinterpret_cast<const __m128i *>(policy_type::constants.data());
+                        for (; count != 0; --count, blocks += 16) {
+                            const __m128i abef = state0, cdgh = state1;
+
+                            __m128i w[4];
+                            for (std::size_t i = 0; i != 4; ++i) {
+                                w[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks) + i);
+                            }
+
+                            for (std::size_t i = 0; i != policy_type::rounds / 4; ++i) {
+                                if (i >= 4) {
+                                    // W[t..t+3] from W[t-16..t-1], sigma_0 in msg1, sigma_1 in msg2
+                                    __m128i next = _mm_sha256msg1_epu32(w[i % 4], w[(i + 1) % 4]);
+                                    next = _mm_add_epi32(next, _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4));
+                                    w[i % 4] = _mm_sha256msg2_epu32(next, w[(i + 3) % 4]);
+                                }
+
+                                __m128i msg = _mm_add_epi32(w[i % 4], _mm_loadu_si128(constants + i));
+                                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                                state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+                            }
+
+                            state0 = _mm_add_epi32(state0, abef);
+                            state1 = _mm_add_epi32(state1, cdgh);
+                        }
+
+                        tmp = _mm_shuffle_epi32(state0, 0x1B);
+                        state1 = _mm_shuffle_epi32(state1, 0xB1);
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_blend_epi16(tmp, state1, 0xF0));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), _mm_alignr_epi8(state1, tmp, 8));
+                    }
+
+                private:
+                    static bool detect() {
+                        unsigned int eax, ebx, ecx, edx;
+                        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1)) {
+                            return false;
+                        }
+                        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                            return false;
+                        }
+                        return (ebx & bit_SHA) != 0;
+                    }
+                };
+            }    // namespace detail
+        }    // namespace hashes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_SHA256_NI_IMPL_HPP
@@ -26,11 +26,16 @@
 #ifndef CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 #define CRYPTO3_HASH_BLOCK_STREAM_PROCESSOR_HPP
 
+#include <algorithm>
 #include <array>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 
 #include <nil/crypto3/detail/pack.hpp>
 
+#include <nil/crypto3/block/detail/block_batch.hpp>
+
 #include <nil/crypto3/hash/accumulators/bits_count.hpp>
 #include <nil/crypto3/hash/accumulators/parameters/bits.hpp>
 
@@ -83,6 +88,50 @@ namespace nil {
                     acc(block, ::nil::crypto3::accumulators::bits = block_seen);
                 }
 
+                // Number of blocks packed from the caller's buffer before they are handed to the accumulator
+                constexpr static const std::size_t batch_blocks = 16;
+
+                inline void process_blocks(const value_type *p, std::size_t blocks) {
+                    using namespace nil::crypto3::detail;
+
+                    std::array<block_type, batch_blocks> batch;
+                    while (blocks != 0) {
+                        const std::size_t n = std::min(blocks, batch_blocks);
+                        for (std::size_t i = 0; i != n; ++i, p += block_values) {
+                            pack_to<endian_type, value_bits, word_bits>(p, p + block_values, batch[i].begin());
+                        }
+                        acc(block::detail::block_batch<block_type> {batch.data(), n},
+                            ::nil::crypto3::accumulators::bits = n * block_bits);
+                        blocks -= n;
+                    }
+                }
+
+                /*!
+                 * @brief Values of a contiguous buffer are consumed in place: the cache only tops up a partially
+                 * filled block and keeps the tail, every whole block in between is packed straight from the buffer.
+                 */
+                inline void update_contiguous(const value_type *p, std::size_t n) {
+                    for (; n != 0 && cache_seen != 0; --n) {
+                        update_one(*p++);
+                    }
+
+                    const std::size_t blocks = n / block_values;
+                    process_blocks(p, blocks);
+                    p += blocks * block_values;
+                    n -= blocks * block_values;
+
+                    for (; n != 0; --n) {
+                        update_one(*p++);
+                    }
+                }
+
+                template<typename InputIterator>
+                constexpr static bool is_contiguous_input() {
+                    typedef typename std::iterator_traits<InputIterator>::value_type input_value_type;
+                    return std::contiguous_iterator<InputIterator> && std::is_integral<input_value_type>::value &&
+                           sizeof(input_value_type) == sizeof(value_type);
+                }
+
             public:
                 inline void update_one(value_type value) {
                     cache[cache_seen] = value;
@@ -96,15 +145,25 @@ namespace nil {
 
                 template<typename InputIterator>
                 inline void update_n(InputIterator p, size_t n) {
-                    for (; n; --n) {
-                        update_one(*p++);
+                    if constexpr (is_contiguous_input<InputIterator>()) {
+                        if (n != 0) {
+                            update_contiguous(reinterpret_cast<const value_type *>(std::to_address(p)), n);
+                        }
+                    } else {
+                        for (; n; --n) {
+                            update_one(*p++);
+                        }
                     }
                 }
 
                 template<typename InputIterator>
                 inline void operator()(InputIterator b, InputIterator e) {
-                    while (b != e) {
-                        update_one(*b++);
+                    if constexpr (is_contiguous_input<InputIterator>()) {
+                        update_n(b, static_cast<std::size_t>(std::distance(b, e)));
+                    } else {
+                        while (b != e) {
+                            update_one(*b++);
+                        }
                     }
                 }
 
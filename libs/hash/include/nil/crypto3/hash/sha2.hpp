@@ -33,6 +33,7 @@
 
 #include <nil/crypto3/hash/accumulators/hash.hpp>
 #include <nil/crypto3/hash/detail/sha2/sha2_policy.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha256_compressor.hpp>
 #include <nil/crypto3/hash/detail/state_adder.hpp>
 #include <nil/crypto3/hash/detail/davies_meyer_compressor.hpp>
 #include <nil/crypto3/hash/detail/merkle_damgard_construction.hpp>
@@ -88,6 +89,10 @@ namespace nil {
 
                 constexpr static const pkcs_id_type pkcs_id = policy_type::pkcs_id;
 
+                typedef typename std::conditional<
+                    policy_type::cipher_version == 256, detail::sha256_compressor,
+                    davies_meyer_compressor<block_cipher_type, detail::state_adder>>::type compressor_type;
+
                 struct construction {
                     struct params_type {
                         typedef typename policy_type::digest_endian digest_endian;
@@ -97,8 +102,7 @@ namespace nil {
                     };
 
                     typedef merkle_damgard_construction<params_type, typename policy_type::iv_generator,
-                                                        davies_meyer_compressor<block_cipher_type, detail::state_adder>,
-                                                        detail::merkle_damgard_padding<policy_type>>
+                                                        compressor_type, detail::merkle_damgard_padding<policy_type>>
                         type;
                 };
 
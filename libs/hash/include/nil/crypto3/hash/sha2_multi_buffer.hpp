@@ -0,0 +1,231 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
+#define CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/endian/conversion.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/detail/sha2/sha256_compressor.hpp>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <nil/crypto3/hash/detail/sha2/sha256_avx2_impl.hpp>
+#define CRYPTO3_HASH_SHA256_AVX2_SELECTED
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            /*!
+             * @brief Hashes many independent messages of the same length with SHA-224/SHA-256, e.g. the children
+             * pairs of a Merkle tree level. Messages are interleaved eight at a time across AVX2 lanes when the
+             * CPU has AVX2, otherwise (and for long messages on CPUs with the SHA extensions) each one goes
+             * through the single-buffer compressor. Digests are identical to hashing each message with sha2<Version>.
+             *
+             * @tparam Version 224 or 256
+             * @ingroup hashes
+             */
+            template<std::size_t Version>
+            struct sha2_multi_buffer {
+                static_assert(Version == 224 || Version == 256, "multi-buffer hashing supports SHA-224 and SHA-256");
+
+                typedef sha2<Version> hash_type;
+                typedef typename hash_type::policy_type policy_type;
+                typedef typename hash_type::digest_type digest_type;
+
+                typedef detail::sha256_compressor compressor_type;
+                typedef typename compressor_type::state_type state_type;
+                typedef typename compressor_type::block_type block_type;
+
+                constexpr static const std::size_t block_octets = hash_type::block_bits / CHAR_BIT;
+                constexpr static const std::size_t length_octets = policy_type::length_bits / CHAR_BIT;
+                constexpr static const std::size_t digest_octets = hash_type::digest_bits / CHAR_BIT;
+
+#if defined(CRYPTO3_HASH_SHA256_AVX2_SELECTED)
+                constexpr static const std::size_t lanes = detail::sha256_avx2_impl::lanes;
+#else
+                constexpr static const std::size_t lanes = 1;
+#endif
+
+                /*!
+                 * @brief Writes the digest of messages[i], `size` bytes long, to digests[i] for every i < count.
+                 */
+                static void hash(const std::uint8_t *const *messages, std::size_t size, digest_type *digests,
+                                 std::size_t count) {
+                    std::size_t i = 0;
+#if defined(CRYPTO3_HASH_SHA256_AVX2_SELECTED)
+                    // A single message compressed with the SHA extensions outruns one AVX2 lane, interleaving only
+                    // pays off while per-message setup and padding dominate.
+                    const bool interleave = detail::sha256_avx2_impl::is_supported() &&
+                                            (!compressor_type::is_accelerated() || size < 8 * block_octets);
+                    for (; interleave && i + lanes <= count; i += lanes) {
+                        hash_lanes(messages + i, size, digests + i);
+                    }
+#endif
+                    for (; i != count; ++i) {
+                        digests[i] = hash_one(messages[i], size);
+                    }
+                }
+
+                /*!
+                 * @brief Hashes every element of a range of equally sized contiguous byte ranges.
+                 */
+                template<typename MessageRange>
+                static std::vector<digest_type> hash(const MessageRange &messages) {
+                    std::vector<const std::uint8_t *> pointers;
+                    std::size_t size = 0;
+                    for (const auto &message : messages) {
+                        const std::size_t message_size = static_cast<std::size_t>(std::size(message));
+                        if (!pointers.empty() && message_size != size) {
+                            throw std::invalid_argument("multi-buffer hashing requires messages of equal length");
+                        }
+                        size = message_size;
+                        pointers.push_back(reinterpret_cast<const std::uint8_t *>(std::data(message)));
+                    }
+
+                    std::vector<digest_type> digests(pointers.size());
+                    hash(pointers.data(), size, digests.data(), pointers.size());
+                    return digests;
+                }
+
+            private:
+                // Number of blocks of a padded message, the final 1-2 of which are built by padded_tail
+                static std::size_t tail_blocks(std::size_t size) {
+                    return (size % block_octets) + 1 + length_octets > block_octets ? 2 : 1;
+                }
+
+                static void padded_tail(const std::uint8_t *message, std::size_t size,
+                                        std::array<std::uint8_t, 2 * block_octets> &tail) {
+                    const std::size_t rest = size % block_octets;
+                    const std::size_t tail_size = tail_blocks(size) * block_octets;
+
+                    tail.fill(0);
+                    std::copy(message + (size - rest), message + size, tail.begin());
+                    tail[rest] = 0x80;
+
+                    std::uint64_t bits = static_cast<std::uint64_t>(size) * CHAR_BIT;
+                    for (std::size_t i = 0; i != length_octets && i != sizeof(bits); ++i, bits >>= CHAR_BIT) {
+                        tail[tail_size - 1 - i] = static_cast<std::uint8_t>(bits);
+                    }
+                }
+
+                static void load_block(const std::uint8_t *bytes, block_type &block) {
+                    std::memcpy(block.data(), bytes, block_octets);
+                    for (std::uint32_t &word : block) {
+                        boost::endian::big_to_native_inplace(word);
+                    }
+                }
+
+                static digest_type store_digest(const std::uint32_t *state) {
+                    std::array<std::uint32_t, 8> words;
+                    for (std::size_t i = 0; i != words.size(); ++i) {
+                        words[i] = boost::endian::native_to_big(state[i]);
+                    }
+
+                    digest_type digest;
+                    std::memcpy(digest.data(), words.data(), digest_octets);
+                    return digest;
+                }
+
+                static digest_type hash_one(const std::uint8_t *message, std::size_t size) {
+                    state_type state = typename policy_type::iv_generator()();
+
+                    std::array<block_type, 4> blocks;
+                    const std::size_t full_blocks = size / block_octets;
+                    for (std::size_t i = 0; i < full_blocks;) {
+                        const std::size_t n = std::min(blocks.size(), full_blocks - i);
+                        for (std::size_t j = 0; j != n; ++j, ++i) {
+                            load_block(message + i * block_octets, blocks[j]);
+                        }
+                        compressor_type::process_blocks(state, blocks.data(), n);
+                    }
+
+                    std::array<std::uint8_t, 2 * block_octets> tail;
+                    padded_tail(message, size, tail);
+                    const std::size_t n = tail_blocks(size);
+                    for (std::size_t j = 0; j != n; ++j) {
+                        load_block(tail.data() + j * block_octets, blocks[j]);
+                    }
+                    compressor_type::process_blocks(state, blocks.data(), n);
+
+                    return store_digest(state.data());
+                }
+
+#if defined(CRYPTO3_HASH_SHA256_AVX2_SELECTED)
+                static BOOST_ATTRIBUTE_TARGET("avx2") void hash_lanes(const std::uint8_t *const *messages,
+                                                                      std::size_t size, digest_type *digests) {
+                    const state_type &iv = typename policy_type::iv_generator()();
+                    __m256i state[8];
+                    for (std::size_t i = 0; i != 8; ++i) {
+                        state[i] = _mm256_set1_epi32(static_cast<int>(iv[i]));
+                    }
+
+                    const std::uint8_t *blocks[lanes];
+                    const std::size_t full_blocks = size / block_octets;
+                    for (std::size_t i = 0; i != full_blocks; ++i) {
+                        for (std::size_t lane = 0; lane != lanes; ++lane) {
+                            blocks[lane] = messages[lane] + i * block_octets;
+                        }
+                        detail::sha256_avx2_impl::process_block(state, blocks);
+                    }
+
+                    std::array<std::uint8_t, 2 * block_octets> tails[lanes];
+                    for (std::size_t lane = 0; lane != lanes; ++lane) {
+                        padded_tail(messages[lane], size, tails[lane]);
+                    }
+                    for (std::size_t i = 0; i != tail_blocks(size); ++i) {
+                        for (std::size_t lane = 0; lane != lanes; ++lane) {
+                            blocks[lane] = tails[lane].data() + i * block_octets;
+                        }
+                        detail::sha256_avx2_impl::process_block(state, blocks);
+                    }
+
+                    detail::sha256_avx2_impl::transpose(state);
+                    std::uint32_t words[8];
+                    for (std::size_t lane = 0; lane != lanes; ++lane) {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(words), state[lane]);
+                        digests[lane] = store_digest(words);
+                    }
+                }
+#endif
+            };
+        }    // namespace hashes
+    }    // namespace crypto3
+}    // namespace nil
+
+#undef CRYPTO3_HASH_SHA256_AVX2_SELECTED
+
+#endif    // CRYPTO3_HASH_SHA2_MULTI_BUFFER_HPP
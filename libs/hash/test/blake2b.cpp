@@ -41,6 +41,8 @@
 #include <nil/crypto3/hash/blake2b.hpp>
 #include <nil/crypto3/hash/hash_state.hpp>
 
+#include <nil/crypto3/hash/test_tools/contiguous_input.hpp>
+
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
 
@@ -674,3 +676,11 @@ BOOST_AUTO_TEST_CASE(blake2b_512_preprocessor2) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(blake2b_contiguous_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(blake2b_512_contiguous_input_matches_iterator_input) {
+    hashes::test_tools::check_contiguous_input_matches_iterator_input<hashes::blake2b<512>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_HASH_TEST_TOOLS_CONTIGUOUS_INPUT_HPP
+#define CRYPTO3_HASH_TEST_TOOLS_CONTIGUOUS_INPUT_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace hashes {
+            namespace test_tools {
+                /*!
+                 * @brief Hashes a contiguous buffer and the same bytes through list iterators, split in two calls,
+                 * and checks that the digests agree. Sizes and splits sit on the block edges of HashType, so
+                 * the whole-block fast path is entered with an empty, a partial and an almost full cache.
+                 */
+                template<typename HashType>
+                void check_contiguous_input_matches_iterator_input() {
+                    constexpr std::size_t block = HashType::block_bits / CHAR_BIT;
+
+                    const std::vector<std::size_t> sizes = {
+                        0, 1, block - 1, block, block + 1, 2 * block - 1, 2 * block, 2 * block + 1, 7 * block + 3,
+                        16 * block + block / 2, 17 * block + 5};
+                    const std::vector<std::size_t> splits = {0, 1, block - 1, block, block + 1, 2 * block + 1};
+
+                    std::vector<std::uint8_t> data(sizes.back());
+                    for (std::size_t i = 0; i != data.size(); ++i) {
+                        data[i] = static_cast<std::uint8_t>(i * 131 + 7);
+                    }
+                    const std::list<std::uint8_t> list(data.begin(), data.end());
+
+                    for (std::size_t size : sizes) {
+                        for (std::size_t split : splits) {
+                            if (split > size) {
+                                continue;
+                            }
+
+                            accumulator_set<HashType> contiguous, iterated;
+                            hash<HashType>(data.begin(), data.begin() + split, contiguous);
+                            hash<HashType>(data.begin() + split, data.begin() + size, contiguous);
+                            hash<HashType>(list.begin(), std::next(list.begin(), split), iterated);
+                            hash<HashType>(std::next(list.begin(), split), std::next(list.begin(), size), iterated);
+
+                            BOOST_TEST_CONTEXT("size " << size << ", split " << split) {
+                                BOOST_CHECK_EQUAL(std::to_string(accumulators::extract::hash<HashType>(contiguous)),
+                                                  std::to_string(accumulators::extract::hash<HashType>(iterated)));
+                            }
+                        }
+                    }
+                }
+            }    // namespace test_tools
+        }    // namespace hashes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_HASH_TEST_TOOLS_CONTIGUOUS_INPUT_HPP
@@ -26,6 +26,8 @@
 #define BOOST_TEST_MODULE sha2_test
 
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -38,6 +40,9 @@
 #include <nil/crypto3/hash/adaptor/hashed.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/sha2_multi_buffer.hpp>
+
+#include <nil/crypto3/hash/test_tools/contiguous_input.hpp>
 
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
@@ -689,3 +694,92 @@ BOOST_AUTO_TEST_CASE(sha224_range_hash) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_multi_buffer_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha2_256_compressor_matches_generic) {
+    typedef hashes::detail::sha256_compressor compressor_type;
+
+    std::mt19937 rng(256);
+    compressor_type::state_type state, expected;
+    for (std::size_t i = 0; i != state.size(); ++i) {
+        state[i] = expected[i] = static_cast<std::uint32_t>(rng());
+    }
+
+    std::vector<compressor_type::block_type> blocks(9);
+    for (auto &block : blocks) {
+        for (auto &word : block) {
+            word = static_cast<std::uint32_t>(rng());
+        }
+    }
+
+    // One block at a time, then the remaining blocks as one batch
+    compressor_type::process_block(state, blocks[0]);
+    compressor_type::process_blocks(state, blocks.data() + 1, blocks.size() - 1);
+    for (const auto &block : blocks) {
+        compressor_type::generic_compressor_type::process_block(expected, block);
+    }
+
+    BOOST_CHECK(state == expected);
+}
+
+template<std::size_t Version>
+void check_multi_buffer_matches_single() {
+    std::mt19937 rng(Version);
+    // Sizes around the one/two padding block boundary and multi-block messages, counts around the lane width
+    for (std::size_t size : {0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 300, 1000}) {
+        for (std::size_t count : {0, 1, 7, 8, 9, 17}) {
+            std::vector<std::vector<std::uint8_t>> messages(count, std::vector<std::uint8_t>(size));
+            for (auto &message : messages) {
+                for (auto &octet : message) {
+                    octet = static_cast<std::uint8_t>(rng());
+                }
+            }
+
+            std::vector<typename hashes::sha2<Version>::digest_type> digests =
+                hashes::sha2_multi_buffer<Version>::hash(messages);
+            BOOST_REQUIRE_EQUAL(digests.size(), count);
+            for (std::size_t i = 0; i != count; ++i) {
+                typename hashes::sha2<Version>::digest_type expected = hash<hashes::sha2<Version>>(messages[i]);
+                BOOST_CHECK_EQUAL(std::to_string(digests[i]), std::to_string(expected));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_multi_buffer_matches_single) {
+    check_multi_buffer_matches_single<256>();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_224_multi_buffer_matches_single) {
+    check_multi_buffer_matches_single<224>();
+}
+
+BOOST_AUTO_TEST_CASE(sha2_256_multi_buffer_nist_vectors) {
+    std::vector<std::string> messages(
+        9, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq");
+    messages[4] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopr";
+
+    std::vector<hashes::sha2<256>::digest_type> digests = hashes::sha2_multi_buffer<256>::hash(messages);
+    for (std::size_t i = 0; i != messages.size(); ++i) {
+        if (i == 4) {
+            continue;
+        }
+        BOOST_CHECK_EQUAL("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+                          std::to_string(digests[i]).data());
+    }
+    BOOST_CHECK(std::to_string(digests[4]) != std::to_string(digests[0]));
+
+    std::vector<std::string> unequal = {"abc", "abcd"};
+    BOOST_CHECK_THROW(hashes::sha2_multi_buffer<256>::hash(unequal), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha2_contiguous_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha2_256_contiguous_input_matches_iterator_input) {
+    hashes::test_tools::check_contiguous_input_matches_iterator_input<hashes::sha2<256>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
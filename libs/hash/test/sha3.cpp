@@ -39,6 +39,8 @@
 #include <nil/crypto3/hash/sha3.hpp>
 #include <nil/crypto3/hash/hash_state.hpp>
 
+#include <nil/crypto3/hash/test_tools/contiguous_input.hpp>
+
 using namespace nil::crypto3;
 using namespace nil::crypto3::accumulators;
 
@@ -802,3 +804,11 @@ BOOST_AUTO_TEST_CASE(sha3_512_preprocessor3) {
 //}
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sha3_contiguous_input_test_suite)
+
+BOOST_AUTO_TEST_CASE(sha3_256_contiguous_input_matches_iterator_input) {
+    hashes::test_tools::check_contiguous_input_matches_iterator_input<hashes::sha3<256>>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,9 +25,18 @@
 #ifndef CRYPTO3_MAC_DETAIL_GHASH_HPP
 #define CRYPTO3_MAC_DETAIL_GHASH_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+#if defined(__PCLMUL__) && defined(__SSSE3__) && (defined(__x86_64__) || defined(__i386__))
+#include <nil/crypto3/mac/detail/ghash_clmul_impl.hpp>
+#define CRYPTO3_GHASH_CLMUL_SELECTED
+#endif
 
 namespace nil {
     namespace crypto3 {
@@ -89,6 +98,97 @@ namespace nil {
                         }
                     }
 
+                    inline std::uint64_t load_big_endian_64(const std::uint8_t *in) {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0; i < 8; ++i) {
+                            value = (value << 8) | in[i];
+                        }
+                        return value;
+                    }
+
+                    /*!
+                     * @brief Portable GHASH multiplication by H with 4-bit tables (Shoup's method, as in the GCM
+                     * specification, section 4.1). Sixteen multiples of H are precomputed, each multiplication then
+                     * takes 32 table lookups instead of 128 conditional additions.
+                     *
+                     * @note Table indices depend on the hashed data. Platforms with carry-less multiplication use
+                     * clmul_multiplier instead, which runs in constant time.
+                     */
+                    class table_multiplier {
+                    public:
+                        explicit table_multiplier(const block_type &hash_subkey) {
+                            std::uint64_t v_hi = load_big_endian_64(hash_subkey.data());
+                            std::uint64_t v_lo = load_big_endian_64(hash_subkey.data() + 8);
+
+                            table_hi[0] = table_lo[0] = 0;
+                            table_hi[8] = v_hi;
+                            table_lo[8] = v_lo;
+                            for (std::size_t i = 4; i > 0; i >>= 1) {
+                                const std::uint64_t reduction = 0xe100000000000000ULL & (0 - (v_lo & 1));
+                                v_lo = (v_hi << 63) | (v_lo >> 1);
+                                v_hi = (v_hi >> 1) ^ reduction;
+                                table_hi[i] = v_hi;
+                                table_lo[i] = v_lo;
+                            }
+                            for (std::size_t i = 2; i < 16; i <<= 1) {
+                                for (std::size_t j = 1; j < i; ++j) {
+                                    table_hi[i + j] = table_hi[i] ^ table_hi[j];
+                                    table_lo[i + j] = table_lo[i] ^ table_lo[j];
+                                }
+                            }
+                        }
+
+                        void multiply(block_type &value) const {
+                            std::uint64_t z_hi = 0, z_lo = 0;
+
+                            for (std::size_t i = value.size(); i-- > 0;) {
+                                shift_nibble(z_hi, z_lo, value[i] & 0x0f, i == value.size() - 1);
+                                shift_nibble(z_hi, z_lo, value[i] >> 4, false);
+                            }
+
+                            store_big_endian_64(value, 0, z_hi);
+                            store_big_endian_64(value, 8, z_lo);
+                        }
+
+                        void process_blocks(block_type &value, const std::uint8_t *data, std::size_t blocks) const {
+                            for (; blocks != 0; --blocks, data += value.size()) {
+                                for (std::size_t i = 0; i < value.size(); ++i) {
+                                    value[i] ^= data[i];
+                                }
+                                multiply(value);
+                            }
+                        }
+
+                    private:
+                        // Z = Z * x^4 + nibble * H, consuming the data from its last coefficient backwards.
+                        void shift_nibble(std::uint64_t &z_hi, std::uint64_t &z_lo, std::size_t nibble,
+                                          bool first) const {
+                            if (!first) {
+                                const std::size_t remainder = z_lo & 0x0f;
+                                z_lo = (z_hi << 60) | (z_lo >> 4);
+                                z_hi = (z_hi >> 4) ^ (static_cast<std::uint64_t>(reduction_table()[remainder]) << 48);
+                            }
+                            z_hi ^= table_hi[nibble];
+                            z_lo ^= table_lo[nibble];
+                        }
+
+                        static const std::array<std::uint16_t, 16> &reduction_table() {
+                            static const std::array<std::uint16_t, 16> table = {
+                                0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+                                0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0};
+                            return table;
+                        }
+
+                        std::array<std::uint64_t, 16> table_hi;
+                        std::array<std::uint64_t, 16> table_lo;
+                    };
+
+#if defined(CRYPTO3_GHASH_CLMUL_SELECTED)
+                    typedef clmul_multiplier multiplier_type;
+#else
+                    typedef table_multiplier multiplier_type;
+#endif
+
                     // GHASH always finishes with one block containing the bit lengths of the authenticated data and
                     // ciphertext. These lengths are mixed into the hash.
                     inline block_type length_block(std::uint64_t associated_data_bits, std::uint64_t ciphertext_bits) {
@@ -109,19 +209,58 @@ namespace nil {
                     class state {
                     public:
                         explicit state(const block_type &hash_subkey) :
-                            hash_subkey(hash_subkey), value(zero_block()), buffer(zero_block()), buffer_size(0) {
+                            multiplier(hash_subkey), value(zero_block()), buffer(zero_block()), buffer_size(0) {
+                        }
+
+                        // Starts a new polynomial under the same hash subkey, keeping the precomputed multiplier.
+                        void reset() {
+                            value = zero_block();
+                            buffer = zero_block();
+                            buffer_size = 0;
                         }
 
                         template<typename InputIterator>
                         void update(InputIterator first, InputIterator last) {
-                            while (first != last) {
-                                buffer[buffer_size++] = static_cast<std::uint8_t>(*first++);
-                                if (buffer_size == buffer.size()) {
-                                    process_buffer();
+                            if constexpr (std::contiguous_iterator<InputIterator> &&
+                                          sizeof(std::iter_value_t<InputIterator>) == 1) {
+                                update(reinterpret_cast<const std::uint8_t *>(std::to_address(first)),
+                                       static_cast<std::size_t>(std::distance(first, last)));
+                            } else {
+                                while (first != last) {
+                                    buffer[buffer_size++] = static_cast<std::uint8_t>(*first++);
+                                    if (buffer_size == buffer.size()) {
+                                        process_buffer();
+                                    }
                                 }
                             }
                         }
 
+                        // Whole blocks are hashed straight from the input, only the edges go through the buffer.
+                        void update(const std::uint8_t *data, std::size_t size) {
+                            if (size == 0) {
+                                return;
+                            }
+                            if (buffer_size != 0) {
+                                const std::size_t taken = std::min(size, buffer.size() - buffer_size);
+                                std::memcpy(buffer.data() + buffer_size, data, taken);
+                                buffer_size += taken;
+                                data += taken;
+                                size -= taken;
+                                if (buffer_size != buffer.size()) {
+                                    return;
+                                }
+                                process_buffer();
+                            }
+
+                            const std::size_t blocks = size / buffer.size();
+                            multiplier.process_blocks(value, data, blocks);
+                            data += blocks * buffer.size();
+                            size -= blocks * buffer.size();
+
+                            std::memcpy(buffer.data(), data, size);
+                            buffer_size = size;
+                        }
+
                         void update_octet(std::uint8_t octet) {
                             buffer[buffer_size++] = octet;
                             if (buffer_size == buffer.size()) {
@@ -137,7 +276,7 @@ namespace nil {
 
                         void update_block(const block_type &block) {
                             xor_block(value, block);
-                            value = multiply(value, hash_subkey);
+                            multiplier.multiply(value);
                         }
 
                         // Add the mandatory final length block:
@@ -157,7 +296,7 @@ namespace nil {
                             buffer_size = 0;
                         }
 
-                        block_type hash_subkey;
+                        multiplier_type multiplier;
                         // running hash value
                         block_type value;
                         // Staging area for ordinary input bytes until they form a 16-byte GHASH block. The mandatory
@@ -172,4 +311,6 @@ namespace nil {
     }    // namespace crypto3
 }    // namespace nil
 
+#undef CRYPTO3_GHASH_CLMUL_SELECTED
+
 #endif    // CRYPTO3_MAC_DETAIL_GHASH_HPP
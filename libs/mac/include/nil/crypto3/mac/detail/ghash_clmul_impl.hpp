@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MAC_DETAIL_GHASH_CLMUL_IMPL_HPP
+#define CRYPTO3_MAC_DETAIL_GHASH_CLMUL_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace mac {
+            namespace detail {
+                namespace ghash {
+                    /*!
+                     * @brief GHASH with carry-less multiplication (Intel, "Carry-Less Multiplication Instruction and
+                     * its Usage for Computing the GCM Mode"). Blocks are byte-reversed on load, which turns the
+                     * bit-reflected GCM field into plain polynomials up to a one-bit shift.
+                     *
+                     * Eight blocks are folded per reduction: Y' = (Y ^ X_1) H^8 ^ X_2 H^7 ^ ... ^ X_8 H. The 256-bit
+                     * products are summed unreduced, and the shift and reduction run once per group.
+                     */
+                    class clmul_multiplier {
+                    public:
+                        typedef std::array<std::uint8_t, 16> block_type;
+
+                        constexpr static const std::size_t aggregated_blocks = 8;
+
+                        explicit clmul_multiplier(const block_type &hash_subkey) {
+                            const __m128i h = load(hash_subkey.data());
+                            __m128i power = h;
+                            powers[0] = h;
+                            for (std::size_t i = 1; i != aggregated_blocks; ++i) {
+                                power = multiply(power, h);
+                                powers[i] = power;
+                            }
+                        }
+
+                        void multiply(block_type &value) const {
+                            store(value.data(), multiply(load(value.data()), powers[0]));
+                        }
+
+                        /*!
+                         * @brief Absorbs `blocks` whole blocks: value = (...((value ^ X_1) H ^ X_2) H ...) H.
+                         */
+                        void process_blocks(block_type &value, const std::uint8_t *data, std::size_t blocks) const {
+                            __m128i y = load(value.data());
+
+                            for (; blocks >= aggregated_blocks; blocks -= aggregated_blocks) {
+                                __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                                for (std::size_t i = 0; i != aggregated_blocks; ++i, data += 16) {
+                                    __m128i x = load(data);
+                                    if (i == 0) {
+                                        x = _mm_xor_si128(x, y);
+                                    }
+                                    multiply_accumulate(x, powers[aggregated_blocks - 1 - i], lo, mid, hi);
+                                }
+                                y = reduce(lo, mid, hi);
+                            }
+
+                            for (; blocks != 0; --blocks, data += 16) {
+                                y = multiply(_mm_xor_si128(y, load(data)), powers[0]);
+                            }
+
+                            store(value.data(), y);
+                        }
+
+                    private:
+                        static __m128i byte_reverse_mask() {
+                            return _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+                        }
+
+                        static __m128i load(const std::uint8_t *data) {
+                            return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)),
+                                                    byte_reverse_mask());
+                        }
+
+                        static void store(std::uint8_t *data, __m128i value) {
+                            _mm_storeu_si128(reinterpret_cast<__m128i *>(data),
+                                             _mm_shuffle_epi8(value, byte_reverse_mask()));
+                        }
+
+                        static void multiply_accumulate(__m128i a, __m128i b, __m128i &lo, __m128i &mid,
+                                                        __m128i &hi) {
+                            lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(a, b, 0x00));
+                            mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x10));
+                            mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x01));
+                            hi = _mm_xor_si128(hi, _mm_clmulepi64_si128(a, b, 0x11));
+                        }
+
+                        static __m128i multiply(__m128i a, __m128i b) {
+                            __m128i lo = _mm_setzero_si128(), mid = _mm_setzero_si128(), hi = _mm_setzero_si128();
+                            multiply_accumulate(a, b, lo, mid, hi);
+                            return reduce(lo, mid, hi);
+                        }
+
+                        // Shifts the 256-bit product left by one bit to undo the reflection, then reduces it
+                        // modulo x^128 + x^7 + x^2 + x + 1.
+                        static __m128i reduce(__m128i lo, __m128i mid, __m128i hi) {
+                            lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+                            hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+                            __m128i lo_carry = _mm_srli_epi32(lo, 31);
+                            __m128i hi_carry = _mm_srli_epi32(hi, 31);
+                            lo = _mm_slli_epi32(lo, 1);
+                            hi = _mm_slli_epi32(hi, 1);
+                            const __m128i cross_carry = _mm_srli_si128(lo_carry, 12);
+                            hi_carry = _mm_slli_si128(hi_carry, 4);
+                            lo_carry = _mm_slli_si128(lo_carry, 4);
+                            lo = _mm_or_si128(lo, lo_carry);
+                            hi = _mm_or_si128(_mm_or_si128(hi, hi_carry), cross_carry);
+
+                            __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+                                                      _mm_slli_epi32(lo, 25));
+                            const __m128i t_high = _mm_srli_si128(t, 4);
+                            lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+
+                            __m128i u = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+                                                      _mm_srli_epi32(lo, 7));
+                            u = _mm_xor_si128(u, t_high);
+                            lo = _mm_xor_si128(lo, u);
+                            return _mm_xor_si128(hi, lo);
+                        }
+
+                        __m128i powers[aggregated_blocks];
+                    };
+                }    // namespace ghash
+            }    // namespace detail
+        }    // namespace mac
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MAC_DETAIL_GHASH_CLMUL_IMPL_HPP
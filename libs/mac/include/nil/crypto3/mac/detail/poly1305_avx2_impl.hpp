@@ -0,0 +1,212 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MAC_DETAIL_POLY1305_AVX2_IMPL_HPP
+#define CRYPTO3_MAC_DETAIL_POLY1305_AVX2_IMPL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <immintrin.h>
+
+namespace nil {
+    namespace crypto3 {
+        namespace mac {
+            namespace detail {
+                /**
+                 * Four-way parallel Horner evaluation of Poly1305 with AVX2. Four consecutive blocks are spread over
+                 * the four 64-bit lanes, every lane is multiplied by r^4 per step, and at the end lane j is
+                 * multiplied by r^(4 - j) before the lanes are summed. Limbs are in radix 2^26 so that the products
+                 * fit into the 32x32->64 bit _mm256_mul_epu32.
+                 */
+                struct poly1305_avx2_impl {
+                    typedef std::array<std::uint32_t, 5> limbs_type;
+                    // powers[j] holds r^(j + 1) in radix 2^26.
+                    typedef std::array<limbs_type, 4> powers_type;
+
+                    constexpr static const std::size_t lanes = 4;
+                    constexpr static const std::size_t group_octets = lanes * 16;
+                    // Below this the radix conversions are not worth it.
+                    constexpr static const std::size_t min_blocks = 8;
+
+                    /**
+                     * Converts a partially reduced radix 2^44 value (h0, h1 < 2^44 + small, h2 < 2^42 + small)
+                     * to radix 2^26.
+                     */
+                    static limbs_type to_radix26(std::uint64_t h0, std::uint64_t h1, std::uint64_t h2) {
+                        constexpr std::uint64_t mask26 = 0x3ffffff;
+                        constexpr std::uint64_t mask44 = 0xfffffffffff;
+
+                        std::uint64_t carry = h0 >> 44;
+                        h0 &= mask44;
+                        h1 += carry;
+                        carry = h1 >> 44;
+                        h1 &= mask44;
+                        h2 += carry;
+
+                        return {static_cast<std::uint32_t>(h0 & mask26),
+                                static_cast<std::uint32_t>(((h0 >> 26) | (h1 << 18)) & mask26),
+                                static_cast<std::uint32_t>((h1 >> 8) & mask26),
+                                static_cast<std::uint32_t>(((h1 >> 34) | (h2 << 10)) & mask26),
+                                static_cast<std::uint32_t>(h2 >> 16)};
+                    }
+
+                    /**
+                     * Absorbs groups * 4 full blocks from in into the radix 2^44 accumulator (h0, h1, h2).
+                     */
+                    static void process_blocks(std::uint64_t &h0,
+                                               std::uint64_t &h1,
+                                               std::uint64_t &h2,
+                                               const std::uint8_t *in,
+                                               std::size_t groups,
+                                               const powers_type &powers) {
+                        if (groups == 0) {
+                            return;
+                        }
+
+                        __m256i r4[5], s4[5], rf[5], sf[5];
+                        for (std::size_t i = 0; i < 5; ++i) {
+                            r4[i] = _mm256_set1_epi64x(powers[3][i]);
+                            s4[i] = _mm256_set1_epi64x(5 * std::uint64_t(powers[3][i]));
+                            // Lane 0 (the lowest) gets r^4, lane 3 gets r.
+                            rf[i] = _mm256_set_epi64x(powers[0][i], powers[1][i], powers[2][i], powers[3][i]);
+                            sf[i] = _mm256_set_epi64x(5 * std::uint64_t(powers[0][i]), 5 * std::uint64_t(powers[1][i]),
+                                                      5 * std::uint64_t(powers[2][i]), 5 * std::uint64_t(powers[3][i]));
+                        }
+
+                        const limbs_type h = to_radix26(h0, h1, h2);
+
+                        __m256i acc[5];
+                        load_group(in, acc);
+                        for (std::size_t i = 0; i < 5; ++i) {
+                            acc[i] = _mm256_add_epi64(acc[i], _mm256_set_epi64x(0, 0, 0, h[i]));
+                        }
+                        in += group_octets;
+
+                        for (std::size_t group = 1; group < groups; ++group, in += group_octets) {
+                            __m256i message[5];
+                            multiply(acc, r4, s4);
+                            load_group(in, message);
+                            for (std::size_t i = 0; i < 5; ++i) {
+                                acc[i] = _mm256_add_epi64(acc[i], message[i]);
+                            }
+                        }
+                        multiply(acc, rf, sf);
+
+                        std::uint64_t t[5];
+                        for (std::size_t i = 0; i < 5; ++i) {
+                            t[i] = horizontal_sum(acc[i]);
+                        }
+
+                        constexpr std::uint64_t mask26 = 0x3ffffff;
+                        constexpr std::uint64_t mask44 = 0xfffffffffff;
+
+                        std::uint64_t carry = 0;
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            t[i] += carry;
+                            carry = t[i] >> 26;
+                            t[i] &= mask26;
+                        }
+                        t[4] += carry;
+                        carry = t[4] >> 26;
+                        t[4] &= mask26;
+                        t[0] += carry * 5;
+                        carry = t[0] >> 26;
+                        t[0] &= mask26;
+                        t[1] += carry;
+
+                        std::uint64_t wide = t[0] + (t[1] << 26);
+                        h0 = wide & mask44;
+                        wide = (wide >> 44) + (t[2] << 8) + (t[3] << 34);
+                        h1 = wide & mask44;
+                        h2 = (wide >> 44) + (t[4] << 16);
+                    }
+
+                private:
+                    static void load_group(const std::uint8_t *in, __m256i (&limbs)[5]) {
+                        const __m256i mask26 = _mm256_set1_epi64x(0x3ffffff);
+                        const __m256i hibit = _mm256_set1_epi64x(std::uint64_t(1) << 24);
+
+                        const __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+                        const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 32));
+                        // unpack works within 128-bit halves and yields blocks in the order 0, 2, 1, 3.
+                        const __m256i lo = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(first, second), 0xD8);
+                        const __m256i hi = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(first, second), 0xD8);
+
+                        limbs[0] = _mm256_and_si256(lo, mask26);
+                        limbs[1] = _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask26);
+                        limbs[2] =
+                            _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)),
+                                             mask26);
+                        limbs[3] = _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask26);
+                        limbs[4] = _mm256_or_si256(_mm256_srli_epi64(hi, 40), hibit);
+                    }
+
+                    // acc = acc * r mod 2^130 - 5, partially reduced. s holds 5 * r.
+                    static void multiply(__m256i (&acc)[5], const __m256i (&r)[5], const __m256i (&s)[5]) {
+                        const __m256i mask26 = _mm256_set1_epi64x(0x3ffffff);
+
+                        __m256i d[5];
+                        for (std::size_t k = 0; k < 5; ++k) {
+                            d[k] = _mm256_mul_epu32(acc[0], r[k]);
+                            for (std::size_t i = 1; i <= k; ++i) {
+                                d[k] = _mm256_add_epi64(d[k], _mm256_mul_epu32(acc[i], r[k - i]));
+                            }
+                            for (std::size_t i = k + 1; i < 5; ++i) {
+                                d[k] = _mm256_add_epi64(d[k], _mm256_mul_epu32(acc[i], s[k + 5 - i]));
+                            }
+                        }
+
+                        __m256i carry = _mm256_srli_epi64(d[0], 26);
+                        d[0] = _mm256_and_si256(d[0], mask26);
+                        for (std::size_t k = 1; k < 5; ++k) {
+                            d[k] = _mm256_add_epi64(d[k], carry);
+                            carry = _mm256_srli_epi64(d[k], 26);
+                            d[k] = _mm256_and_si256(d[k], mask26);
+                        }
+                        d[0] = _mm256_add_epi64(d[0], _mm256_add_epi64(carry, _mm256_slli_epi64(carry, 2)));
+                        carry = _mm256_srli_epi64(d[0], 26);
+                        d[0] = _mm256_and_si256(d[0], mask26);
+                        d[1] = _mm256_add_epi64(d[1], carry);
+
+                        for (std::size_t k = 0; k < 5; ++k) {
+                            acc[k] = d[k];
+                        }
+                    }
+
+                    static std::uint64_t horizontal_sum(__m256i value) {
+                        const __m128i sum =
+                            _mm_add_epi64(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+                        return static_cast<std::uint64_t>(_mm_cvtsi128_si64(sum)) +
+                               static_cast<std::uint64_t>(_mm_extract_epi64(sum, 1));
+                    }
+                };
+            }    // namespace detail
+        }    // namespace mac
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MAC_DETAIL_POLY1305_AVX2_IMPL_HPP
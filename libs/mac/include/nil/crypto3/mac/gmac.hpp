@@ -30,6 +30,7 @@
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
@@ -58,9 +59,18 @@ namespace nil {
 
                     template<typename InputIterator>
                     void update(InputIterator first, InputIterator last) {
-                        while (first != last) {
-                            increment_associated_data_size();
-                            ghash.update_octet(static_cast<std::uint8_t>(*first++));
+                        if constexpr (std::random_access_iterator<InputIterator>) {
+                            const std::uint64_t size = static_cast<std::uint64_t>(std::distance(first, last));
+                            if (size > std::numeric_limits<std::uint64_t>::max() / CHAR_BIT - associated_data_octets) {
+                                throw std::length_error("GMAC associated data is too long");
+                            }
+                            associated_data_octets += size;
+                            ghash.update(first, last);
+                        } else {
+                            while (first != last) {
+                                increment_associated_data_size();
+                                ghash.update_octet(static_cast<std::uint8_t>(*first++));
+                            }
                         }
                     }
 
@@ -29,13 +29,21 @@
 #include <array>
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 #include <boost/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/mac/mac_key.hpp>
 
+#if defined(__SIZEOF_INT128__) && defined(__AVX2__) && (defined(__x86_64__) || defined(__i386__))
+#include <nil/crypto3/mac/detail/poly1305_avx2_impl.hpp>
+#define CRYPTO3_POLY1305_AVX2_SELECTED
+#endif
+
 namespace nil {
     namespace crypto3 {
         namespace mac {
@@ -180,6 +188,9 @@ namespace nil {
                     std::uint64_t s2;
                     std::uint64_t pad0;
                     std::uint64_t pad1;
+#if defined(CRYPTO3_POLY1305_AVX2_SELECTED)
+                    poly1305_avx2_impl::powers_type r_powers {};
+#endif
                 };
 
                 class poly1305_optimized_state {
@@ -190,15 +201,48 @@ namespace nil {
 
                     template<typename InputIterator>
                     void update(InputIterator first, InputIterator last, const poly1305_optimized_key_schedule &key) {
-                        while (first != last) {
-                            buffer[buffer_size++] = static_cast<std::uint8_t>(*first++);
-                            if (buffer_size == buffer.size()) {
-                                process_block(buffer.data(), key, false);
-                                buffer_size = 0;
+                        if constexpr (std::contiguous_iterator<InputIterator> &&
+                                      sizeof(std::iter_value_t<InputIterator>) == 1) {
+                            // Whole blocks are read straight from the input, only the edges go through the buffer.
+                            const std::uint8_t *in = reinterpret_cast<const std::uint8_t *>(std::to_address(first));
+                            update(in, static_cast<std::size_t>(std::distance(first, last)), key);
+                        } else {
+                            while (first != last) {
+                                buffer[buffer_size++] = static_cast<std::uint8_t>(*first++);
+                                if (buffer_size == buffer.size()) {
+                                    process_block(buffer.data(), key, false);
+                                    buffer_size = 0;
+                                }
                             }
                         }
                     }
 
+                    void update(const std::uint8_t *in, std::size_t size, const poly1305_optimized_key_schedule &key) {
+                        if (size == 0) {
+                            return;
+                        }
+                        if (buffer_size != 0) {
+                            const std::size_t taken = std::min(size, buffer.size() - buffer_size);
+                            std::memcpy(buffer.data() + buffer_size, in, taken);
+                            buffer_size += taken;
+                            in += taken;
+                            size -= taken;
+                            if (buffer_size != buffer.size()) {
+                                return;
+                            }
+                            process_block(buffer.data(), key, false);
+                            buffer_size = 0;
+                        }
+
+                        const std::size_t blocks = size / buffer.size();
+                        process_blocks(in, blocks, key);
+                        in += blocks * buffer.size();
+                        size -= blocks * buffer.size();
+
+                        std::memcpy(buffer.data(), in, size);
+                        buffer_size = size;
+                    }
+
                     std::array<std::uint8_t, 16> finalize(const poly1305_optimized_key_schedule &key) const {
                         poly1305_optimized_state finalized = *this;
                         if (finalized.buffer_size != 0) {
@@ -210,21 +254,16 @@ namespace nil {
                         return finalized.finish(key);
                     }
 
-                private:
-                    void process_block(const std::uint8_t *block,
-                                       const poly1305_optimized_key_schedule &key,
-                                       bool partial) {
+                    /**
+                     * Multiplies (h0, h1, h2) by the clamped key r, partially reducing modulo 2^130 - 5.
+                     */
+                    static void multiply(std::uint64_t &h0,
+                                         std::uint64_t &h1,
+                                         std::uint64_t &h2,
+                                         const poly1305_optimized_key_schedule &key) {
                         constexpr std::uint64_t mask44 = 0xfffffffffff;
                         constexpr std::uint64_t mask42 = 0x3ffffffffff;
 
-                        const std::uint64_t t0 = load_little_endian_64(block);
-                        const std::uint64_t t1 = load_little_endian_64(block + 8);
-                        const std::uint64_t hibit = partial ? 0 : (std::uint64_t(1) << 40);
-
-                        h0 += t0 & mask44;
-                        h1 += ((t0 >> 44) | (t1 << 20)) & mask44;
-                        h2 += ((t1 >> 24) & mask42) | hibit;
-
                         poly1305_uint128_type d0 = poly1305_uint128_type(h0) * key.r0 +
                                                    poly1305_uint128_type(h1) * key.s2 +
                                                    poly1305_uint128_type(h2) * key.s1;
@@ -252,6 +291,40 @@ namespace nil {
                         h1 += carry;
                     }
 
+                private:
+                    void process_block(const std::uint8_t *block,
+                                       const poly1305_optimized_key_schedule &key,
+                                       bool partial) {
+                        constexpr std::uint64_t mask44 = 0xfffffffffff;
+                        constexpr std::uint64_t mask42 = 0x3ffffffffff;
+
+                        const std::uint64_t t0 = load_little_endian_64(block);
+                        const std::uint64_t t1 = load_little_endian_64(block + 8);
+                        const std::uint64_t hibit = partial ? 0 : (std::uint64_t(1) << 40);
+
+                        h0 += t0 & mask44;
+                        h1 += ((t0 >> 44) | (t1 << 20)) & mask44;
+                        h2 += ((t1 >> 24) & mask42) | hibit;
+
+                        multiply(h0, h1, h2, key);
+                    }
+
+                    void process_blocks(const std::uint8_t *in,
+                                        std::size_t blocks,
+                                        const poly1305_optimized_key_schedule &key) {
+#if defined(CRYPTO3_POLY1305_AVX2_SELECTED)
+                        if (blocks >= poly1305_avx2_impl::min_blocks) {
+                            const std::size_t groups = blocks / poly1305_avx2_impl::lanes;
+                            poly1305_avx2_impl::process_blocks(h0, h1, h2, in, groups, key.r_powers);
+                            in += groups * poly1305_avx2_impl::group_octets;
+                            blocks -= groups * poly1305_avx2_impl::lanes;
+                        }
+#endif
+                        for (; blocks != 0; --blocks, in += buffer.size()) {
+                            process_block(in, key, false);
+                        }
+                    }
+
                     std::array<std::uint8_t, 16> finish(const poly1305_optimized_key_schedule &key) {
                         constexpr std::uint64_t mask44 = 0xfffffffffff;
                         constexpr std::uint64_t mask42 = 0x3ffffffffff;
@@ -346,6 +419,16 @@ namespace nil {
 
                         schedule.s1 = schedule.r1 * (5 << 2);
                         schedule.s2 = schedule.r2 * (5 << 2);
+
+#if defined(CRYPTO3_POLY1305_AVX2_SELECTED)
+                        std::uint64_t p0 = schedule.r0, p1 = schedule.r1, p2 = schedule.r2;
+                        for (std::size_t i = 0; i < schedule.r_powers.size(); ++i) {
+                            if (i != 0) {
+                                accumulator_type::multiply(p0, p1, p2, schedule);
+                            }
+                            schedule.r_powers[i] = poly1305_avx2_impl::to_radix26(p0, p1, p2);
+                        }
+#endif
                         return schedule;
                     }
 
@@ -447,4 +530,6 @@ namespace nil {
     }    // namespace crypto3
 }    // namespace nil
 
+#undef CRYPTO3_POLY1305_AVX2_SELECTED
+
 #endif    // CRYPTO3_MAC_POLY1305_HPP
@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE mac_poly1305_bench_test
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/mac/algorithm/compute.hpp>
+#include <nil/crypto3/mac/poly1305.hpp>
+
+#include <nil/crypto3/bench/benchmark.hpp>
+
+using namespace nil::crypto3;
+
+template<typename MacType>
+void run_poly1305_bench(std::string const &name, std::size_t message_size) {
+    const std::vector<std::uint8_t> key_bytes = {
+        0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52, 0xfe, 0x42, 0xd5, 0x06, 0xa8,
+        0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d, 0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b};
+    const mac::mac_key<MacType> key(key_bytes);
+
+    std::vector<std::uint8_t> message(message_size);
+    for (std::size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    }
+
+    bench::detail::run_benchmark_impl(
+        std::format("{:20} {:6} bytes:", name, message_size),
+        [](std::size_t) { return std::make_tuple(std::uint8_t(0)); },
+        [&](std::size_t batch_size, std::uint8_t &sink) {
+            for (std::size_t b = 0; b < batch_size; ++b) {
+                message[0] = sink;
+                const typename MacType::digest_type tag = compute<MacType>(message, key);
+                sink ^= tag[0];
+            }
+            return sink;
+        });
+}
+
+BOOST_AUTO_TEST_SUITE(poly1305_bench_test_suite)
+
+BOOST_AUTO_TEST_CASE(poly1305_bench) {
+    for (std::size_t message_size : {34, 64, 1024, 16384}) {
+        run_poly1305_bench<mac::poly1305_reference>("poly1305_reference", message_size);
+        run_poly1305_bench<mac::poly1305>("poly1305", message_size);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
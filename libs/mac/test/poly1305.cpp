@@ -33,6 +33,7 @@
 #include <array>
 #include <cctype>
 #include <cstdint>
+#include <list>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -203,6 +204,81 @@ BOOST_AUTO_TEST_CASE(poly1305_matches_rfc8439_appendix_a3_vectors) {
                           tag_from_hex("13000000000000000000000000000000"));
 }
 
+BOOST_AUTO_TEST_CASE(poly1305_bulk_path_matches_reference) {
+    // Lengths cross the scalar/vectorized thresholds and the block boundaries, the 0xff pattern stresses the carry
+    // propagation of the wide lanes.
+    const std::vector<std::uint8_t> key =
+        hex_to_bytes("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b");
+    mac::mac_key<mac::poly1305> optimized_key(key);
+    mac::mac_key<mac::poly1305_reference> reference_key(key);
+
+    for (std::uint8_t fill : {std::uint8_t(0x00), std::uint8_t(0xff), std::uint8_t(0x5a)}) {
+        for (std::size_t length : {0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 129, 143, 144, 255, 256, 257, 1000, 4099}) {
+            std::vector<std::uint8_t> message(length, fill);
+            for (std::size_t i = 0; fill == 0x5a && i < length; ++i) {
+                message[i] = static_cast<std::uint8_t>(i * 131 + 7);
+            }
+
+            const typename mac::poly1305::digest_type expected =
+                compute<mac::poly1305_reference>(message, reference_key);
+            const typename mac::poly1305::digest_type tag = compute<mac::poly1305>(message, optimized_key);
+            BOOST_TEST(std::equal(tag.begin(), tag.end(), expected.begin()));
+
+            for (std::size_t split : {std::size_t(1), std::size_t(13), length / 3}) {
+                if (split > length) {
+                    continue;
+                }
+                mac::computation_accumulator_set<mac::computation_policy<mac::poly1305>> acc(optimized_key);
+                compute<mac::poly1305>(message.begin(), message.begin() + split, acc);
+                compute<mac::poly1305>(message.begin() + split, message.end(), acc);
+                const typename mac::poly1305::digest_type streamed_tag =
+                    accumulators::extract::mac<mac::computation_policy<mac::poly1305>>(acc);
+                BOOST_TEST(std::equal(streamed_tag.begin(), streamed_tag.end(), expected.begin()));
+            }
+
+            const std::list<std::uint8_t> listed(message.begin(), message.end());
+            const typename mac::poly1305::digest_type listed_tag = compute<mac::poly1305>(listed, optimized_key);
+            BOOST_TEST(std::equal(listed_tag.begin(), listed_tag.end(), expected.begin()));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(poly1305_empty_updates_leave_tag_unchanged) {
+    const std::vector<std::uint8_t> key =
+        hex_to_bytes("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b");
+    const std::vector<std::uint8_t> message = bytes_from_text("Cryptographic Forum Research Group");
+    const std::array<std::uint8_t, 16> expected = tag_from_hex("a8061dc1305136c6c22b8baf0c0127a9");
+
+    // An empty vector may hand out a null data() pointer.
+    const std::vector<std::uint8_t> empty;
+    mac::mac_key<mac::poly1305> poly1305_key(key);
+    mac::computation_accumulator_set<mac::computation_policy<mac::poly1305>> acc(poly1305_key);
+    compute<mac::poly1305>(empty.begin(), empty.end(), acc);
+    compute<mac::poly1305>(message.begin(), message.begin() + 5, acc);
+    compute<mac::poly1305>(empty.begin(), empty.end(), acc);
+    compute<mac::poly1305>(message.begin() + 5, message.end(), acc);
+    compute<mac::poly1305>(empty.begin(), empty.end(), acc);
+    const typename mac::poly1305::digest_type tag =
+        accumulators::extract::mac<mac::computation_policy<mac::poly1305>>(acc);
+    BOOST_TEST(std::equal(tag.begin(), tag.end(), expected.begin()));
+
+#if defined(__SIZEOF_INT128__)
+    std::array<std::uint8_t, 32> key_bytes;
+    std::copy(key.begin(), key.end(), key_bytes.begin());
+    const mac::detail::poly1305_optimized_key_schedule schedule =
+        mac::detail::poly1305_optimized_backend::process_key(key_bytes);
+
+    mac::detail::poly1305_optimized_state state;
+    state.update(nullptr, 0, schedule);
+    state.update(message.data(), 5, schedule);
+    state.update(nullptr, 0, schedule);
+    state.update(message.data() + 5, message.size() - 5, schedule);
+    state.update(nullptr, 0, schedule);
+    const std::array<std::uint8_t, 16> state_tag = state.finalize(schedule);
+    BOOST_TEST(std::equal(state_tag.begin(), state_tag.end(), expected.begin()));
+#endif
+}
+
 BOOST_AUTO_TEST_CASE(poly1305_rejects_wrong_key_size) {
     std::vector<std::uint8_t> short_key(31, 0);
 
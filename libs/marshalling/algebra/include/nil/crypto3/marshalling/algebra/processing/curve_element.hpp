@@ -178,7 +178,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(const group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const chunk_type I_bit = 0x40;
                         typename group_type::curve_type::template g1_type<typename algebra::curves::coordinates::affine,
@@ -212,12 +212,12 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(const group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
                         constexpr static const std::size_t units_bits = 8;
-                        constexpr static const std::size_t chunk_bits = sizeof(typename TIter::value_type) * units_bits;
+                        constexpr static const std::size_t chunk_bits = sizeof(chunk_type) * units_bits;
                         constexpr static const std::size_t sizeof_field_element_chunks_count =
                             (sizeof_field_element / chunk_bits) + ((sizeof_field_element % chunk_bits) ? 1 : 0);
 
@@ -268,7 +268,7 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
                         constexpr static const chunk_type I_bit = 0x80;
                         constexpr static const chunk_type S_bit = 0x40;
 
@@ -312,12 +312,12 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
                         constexpr static const std::size_t units_bits = 8;
-                        constexpr static const std::size_t chunk_bits = sizeof(typename TIter::value_type) * units_bits;
+                        constexpr static const std::size_t chunk_bits = sizeof(chunk_type) * units_bits;
                         constexpr static const std::size_t sizeof_field_element_chunks_count =
                             (sizeof_field_element / chunk_bits) + ((sizeof_field_element % chunk_bits) ? 1 : 0);
 
@@ -375,7 +375,7 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
                         constexpr static const chunk_type I_bit = 0x80;
                         constexpr static const chunk_type S_bit = 0x40;
 
@@ -420,12 +420,12 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
                         constexpr static const std::size_t units_bits = 8;
-                        constexpr static const std::size_t chunk_bits = sizeof(typename TIter::value_type) * units_bits;
+                        constexpr static const std::size_t chunk_bits = sizeof(chunk_type) * units_bits;
                         constexpr static const std::size_t sizeof_field_element_chunks_count =
                             (sizeof_field_element / chunk_bits) + ((sizeof_field_element % chunk_bits) ? 1 : 0);
 
@@ -480,7 +480,7 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
                         constexpr static const chunk_type I_bit = 0x80;
                         constexpr static const chunk_type S_bit = 0x40;
 
@@ -525,12 +525,12 @@ namespace nil {
                          * Highest bit is Infinity flag
                          * Second highest bit is sign of Y coordinate */
 
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
                         constexpr static const std::size_t units_bits = 8;
-                        constexpr static const std::size_t chunk_bits = sizeof(typename TIter::value_type) * units_bits;
+                        constexpr static const std::size_t chunk_bits = sizeof(chunk_type) * units_bits;
                         constexpr static const std::size_t sizeof_field_element_chunks_count =
                             (sizeof_field_element / chunk_bits) + ((sizeof_field_element % chunk_bits) ? 1 : 0);
 
@@ -678,7 +678,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         const chunk_type m_unit = *iter & 0xE0;
                         BOOST_ASSERT(m_unit != 0x20 && m_unit != 0x60 && m_unit != 0xE0);
@@ -740,7 +740,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         const chunk_type m_unit = *iter & 0xE0;
                         BOOST_ASSERT(m_unit != 0x20 && m_unit != 0x60 && m_unit != 0xE0);
@@ -807,7 +807,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -861,7 +861,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -923,7 +923,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -979,7 +979,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -1042,7 +1042,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -1098,7 +1098,7 @@ namespace nil {
 
                     template<typename TIter>
                     static nil::marshalling::status_type process(group_value_type &point, TIter &iter) {
-                        using chunk_type = typename TIter::value_type;
+                        using chunk_type = typename std::iterator_traits<TIter>::value_type;
 
                         constexpr static const std::size_t sizeof_field_element =
                             params_type::bit_length() / (group_value_type::field_type::arity);
@@ -38,6 +38,8 @@
 #include <nil/marshalling/types/tag.hpp>
 #include <nil/marshalling/types/detail/adapt_basic_field.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
+
 #include <nil/crypto3/marshalling/algebra/types/detail/curve_element/basic_type.hpp>
 #include <nil/crypto3/marshalling/algebra/inference.hpp>
 #include <nil/crypto3/marshalling/algebra/type_traits.hpp>
@@ -350,11 +352,15 @@ namespace nil {
                         nil::marshalling::option::sequence_size_field_prefix<
                             nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>>>;
 
+                    // Normalized points are written without an inversion each.
+                    std::vector<typename CurveGroupType::value_type> normalized_vector = curve_elem_vector;
+                    algebra::batch_normalize(normalized_vector);
+
                     curve_element_vector_type result;
 
                     std::vector<curve_element_type> &val = result.value();
-                    for (std::size_t i = 0; i < curve_elem_vector.size(); i++) {
-                        val.push_back(curve_element_type(curve_elem_vector[i]));
+                    for (std::size_t i = 0; i < normalized_vector.size(); i++) {
+                        val.push_back(curve_element_type(normalized_vector[i]));
                     }
                     return result;
                 }
@@ -39,6 +39,7 @@
 #include <nil/marshalling/status_type.hpp>
 #include <nil/marshalling/options.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
@@ -109,11 +110,21 @@ namespace nil {
                         nil::marshalling::option::sequence_size_field_prefix<
                             nil::marshalling::types::integral<nil::marshalling::field_type<Endianness>, std::size_t>>>;
 
+                    using field_element_type =
+                        field_element<TTypeBase, typename CurveGroupType::value_type::field_type::value_type>;
+
+                    // One inversion for the whole vector instead of one per point.
+                    const auto affine_points = algebra::batch_to_affine(curve_elem_vector);
+
                     fast_curve_element_vector_type result;
 
                     std::vector<fast_curve_element_type> &val = result.value();
                     for (std::size_t i = 0; i < curve_elem_vector.size(); i++) {
-                        val.push_back(fill_fast_curve_element<CurveGroupType, Endianness>(curve_elem_vector[i]));
+                        std::uint8_t is_infinity = curve_elem_vector[i].is_zero();
+                        val.push_back(fast_curve_element_type(
+                            std::make_tuple(field_element_type(affine_points[i].X),
+                                            field_element_type(affine_points[i].Y),
+                                            nil::marshalling::types::integral<TTypeBase, std::uint8_t>(is_infinity))));
                     }
                     return result;
                 }
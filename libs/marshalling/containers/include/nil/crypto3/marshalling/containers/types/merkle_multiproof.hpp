@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_MERKLE_MULTIPROOF_HPP
+#define CRYPTO3_MARSHALLING_MERKLE_MULTIPROOF_HPP
+
+#include <type_traits>
+
+#include <nil/marshalling/types/bundle.hpp>
+#include <nil/marshalling/types/array_list.hpp>
+#include <nil/marshalling/status_type.hpp>
+#include <nil/marshalling/options.hpp>
+#include <nil/marshalling/field_type.hpp>
+
+#include <nil/crypto3/marshalling/containers/types/merkle_node.hpp>
+
+#include <nil/crypto3/container/merkle/multiproof.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace marshalling {
+            namespace types {
+                template<typename TTypeBase,
+                         typename MerkleMultiproof,
+                         typename = typename std::enable_if<
+                             std::is_same<MerkleMultiproof,
+                                          nil::crypto3::containers::merkle_multiproof<
+                                              typename MerkleMultiproof::hash_type, MerkleMultiproof::arity>>::value,
+                             bool>::type,
+                         typename... TOptions>
+                using merkle_multiproof = nil::marshalling::types::bundle<
+                    TTypeBase,
+                    std::tuple<
+                        // std::vector<value_type> _nodes
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase, typename merkle_node_value<TTypeBase, typename MerkleMultiproof::value_type>::type>>>;
+
+                template<typename MerkleMultiproof, typename Endianness>
+                merkle_multiproof<nil::marshalling::field_type<Endianness>, MerkleMultiproof>
+                    fill_merkle_multiproof(const MerkleMultiproof &mp) {
+
+                    using TTypeBase = nil::marshalling::field_type<Endianness>;
+                    using node_value_marshalling_type =
+                        typename merkle_node_value<TTypeBase, typename MerkleMultiproof::value_type>::type;
+
+                    nil::marshalling::types::standard_array_list<TTypeBase, node_value_marshalling_type> filled_nodes;
+                    for (const auto &node : mp.nodes()) {
+                        filled_nodes.value().push_back(
+                            fill_merkle_node_value<typename MerkleMultiproof::value_type, Endianness>(node));
+                    }
+
+                    return merkle_multiproof<TTypeBase, MerkleMultiproof>(std::make_tuple(filled_nodes));
+                }
+
+                template<typename MerkleMultiproof, typename Endianness>
+                MerkleMultiproof make_merkle_multiproof(
+                    const merkle_multiproof<nil::marshalling::field_type<Endianness>, MerkleMultiproof> &filled_mp) {
+                    std::vector<typename MerkleMultiproof::value_type> nodes;
+                    nodes.reserve(std::get<0>(filled_mp.value()).value().size());
+                    for (const auto &node : std::get<0>(filled_mp.value()).value()) {
+                        nodes.push_back(make_merkle_node_value<typename MerkleMultiproof::value_type, Endianness>(node));
+                    }
+
+                    return MerkleMultiproof(std::move(nodes));
+                }
+            }    // namespace types
+        }    // namespace marshalling
+    }    // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_MARSHALLING_MERKLE_MULTIPROOF_HPP
@@ -87,24 +87,25 @@ std::vector<std::vector<std::uint8_t>> generate_random_data_for_merkle_tree(size
                                                                             boost::random::mt11213b &rnd) {
     std::vector<std::vector<std::uint8_t>> rdata(leafs_number, std::vector<std::uint8_t>(leaf_bytes));
 
-    for (std::size_t i = 0; i < leafs_number; ++i) {
-        std::vector<uint8_t> leaf(leaf_bytes);
+    for (auto &leaf : rdata) {
         for (size_t i = 0; i < leaf_bytes; i++) {
             leaf[i] = rnd() % (std::numeric_limits<std::uint8_t>::max() + 1);
         }
-        rdata.emplace_back(leaf);
     }
     return rdata;
 }
 
 template<typename FRI>
 typename FRI::merkle_proof_type generate_random_merkle_proof(std::size_t tree_depth, boost::random::mt11213b &rnd) {
-    std::size_t leafs_number = 1 << tree_depth;
+    std::size_t leafs_number = 1;
+    for (std::size_t i = 0; i < tree_depth; i++) {
+        leafs_number *= FRI::merkle_tree_arity;
+    }
     std::size_t leaf_size = 32;
 
     auto rdata1 = generate_random_data_for_merkle_tree(leafs_number, leaf_size, rnd);
-    auto tree1 =
-        containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(rdata1.begin(), rdata1.end());
+    auto tree1 = containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::merkle_tree_arity>(
+        rdata1.begin(), rdata1.end());
     std::size_t idx1 = rnd() % leafs_number;
     typename FRI::merkle_proof_type mp1(tree1, idx1);
     return mp1;
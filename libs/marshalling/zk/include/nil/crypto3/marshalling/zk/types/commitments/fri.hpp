@@ -30,7 +30,9 @@
 #include <limits>
 #include <map>
 #include <ratio>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include <boost/assert.hpp>
 
@@ -42,6 +44,7 @@
 
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/containers/types/merkle_proof.hpp>
+#include <nil/crypto3/marshalling/containers/types/merkle_multiproof.hpp>
 #include <nil/crypto3/marshalling/math/types/polynomial.hpp>
 
 namespace nil {
@@ -289,48 +292,69 @@ namespace nil {
                 ///////////////////////////////////////////////////
                 template<typename TTypeBase, typename FRI>
                 struct fri_proof {
-                    using type = nil::marshalling::types::bundle<
-                        TTypeBase,
-                        std::tuple<
-                            // step_list.size() merkle roots
-                            // Fixed size. It's Ok
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase,
-                                typename types::merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type>,
+                    // With merkle multiproofs each tree gets one multiproof instead of one merkle proof per query.
+                    using merkle_proofs_type = typename std::conditional<
+                        FRI::use_merkle_multiproofs,
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase, types::merkle_multiproof<TTypeBase, typename FRI::merkle_multiproof_type>>,
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase,
+                            typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>>>::type;
 
-                            // step_list.
-                            // We'll check is it good for current EVM instance
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase, nil::marshalling::types::integral<TTypeBase, uint8_t>>,
+                    using fields_type = std::tuple<
+                        // step_list.size() merkle roots
+                        // Fixed size. It's Ok
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase,
+                            typename types::merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type>,
 
-                            // Polynomials' values for initial proofs
-                            // Fixed size
-                            // lambda * polynomials_num * m
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase, field_element<TTypeBase, typename FRI::field_type::value_type>>,
+                        // step_list.
+                        // We'll check is it good for current EVM instance
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase, nil::marshalling::types::integral<TTypeBase, uint8_t>>,
 
-                            // Polynomials' values for round proofs
-                            // Fixed size
-                            // lambda * \sum_rounds{m^{r_i}}
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase, field_element<TTypeBase, typename FRI::field_type::value_type>>,
+                        // Polynomials' values for initial proofs
+                        // Fixed size
+                        // lambda * polynomials_num * m
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase, field_element<TTypeBase, typename FRI::field_type::value_type>>,
 
-                            // Merkle proofs for initial proofs
-                            // Fixed size lambda * batches_num
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase, typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>>,
+                        // Polynomials' values for round proofs
+                        // Fixed size
+                        // lambda * \sum_rounds{m^{r_i}}
+                        nil::marshalling::types::standard_array_list<
+                            TTypeBase, field_element<TTypeBase, typename FRI::field_type::value_type>>,
 
-                            // Merkle proofs for round proofs
-                            // Fixed size lambda * |step_list|
-                            nil::marshalling::types::standard_array_list<
-                                TTypeBase, typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>>,
+                        // Merkle proofs for initial proofs
+                        // Fixed size lambda * batches_num, or batches_num merkle multiproofs
+                        merkle_proofs_type,
+
+                        // Merkle proofs for round proofs
+                        // Fixed size lambda * |step_list|, or |step_list| merkle multiproofs
+                        merkle_proofs_type,
 
-                            // std::select_container<math::polynomial> final_polynomials
-                            // May be different size, because real degree may be less than before. So put int in the end
-                            typename polynomial<TTypeBase, typename FRI::polynomial_type>::type,
+                        // std::select_container<math::polynomial> final_polynomials
+                        // May be different size, because real degree may be less than before. So put int in the end
+                        typename polynomial<TTypeBase, typename FRI::polynomial_type>::type,
 
-                            // proof of work.
-                            nil::marshalling::types::integral<TTypeBase, typename FRI::grinding_type::output_type>>>;
+                        // proof of work.
+                        nil::marshalling::types::integral<TTypeBase, typename FRI::grinding_type::output_type>>;
+
+                    // With merkle caps, the caps of the initial trees in batch_info order and then the ones of the
+                    // rounds are appended. Proofs without caps keep their format.
+                    using merkle_cap_type = nil::marshalling::types::bundle<
+                        TTypeBase,
+                        std::tuple<nil::marshalling::types::standard_array_list<
+                            TTypeBase,
+                            typename types::merkle_node_value<TTypeBase, typename FRI::merkle_proof_type>::type>>>;
+                    using merkle_caps_type = nil::marshalling::types::standard_array_list<TTypeBase, merkle_cap_type>;
+
+                    using fields_with_merkle_caps_type = decltype(std::tuple_cat(
+                        std::declval<fields_type>(), std::declval<std::tuple<merkle_caps_type>>()));
+
+                    using type = nil::marshalling::types::bundle<
+                        TTypeBase, typename std::conditional<FRI::merkle_cap_height != 0,
+                                                             fields_with_merkle_caps_type, fields_type>::type>;
                 };
 
                 using batch_info_type = std::map<std::size_t, std::size_t>;    // batch_id->batch_size
@@ -409,38 +433,80 @@ namespace nil {
                     }
 
                     // initial merkle proofs
-                    nil::marshalling::types::standard_array_list<
-                        TTypeBase, typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>>
-                        filled_initial_merkle_proofs;
-                    for (std::size_t i = 0; i < lambda; i++) {
-                        const auto &query_proof = proof.query_proofs[i];
-                        for (const auto &it : query_proof.initial_proof) {
-                            const auto &initial_proof = it.second;
+                    typename fri_proof<TTypeBase, FRI>::merkle_proofs_type filled_initial_merkle_proofs;
+                    // round merkle proofs
+                    typename fri_proof<TTypeBase, FRI>::merkle_proofs_type filled_round_merkle_proofs;
+                    if constexpr (FRI::use_merkle_multiproofs) {
+                        for (const auto &it : batch_info) {
+                            auto initial_multiproof = proof.initial_multiproofs.find(it.first);
+                            if (initial_multiproof == proof.initial_multiproofs.end()) {
+                                throw std::invalid_argument(std::string("No initial merkle multiproof for batch ") +
+                                                            std::to_string(it.first));
+                            }
                             filled_initial_merkle_proofs.value().push_back(
-                                fill_merkle_proof<typename FRI::merkle_proof_type, Endianness>(initial_proof.p));
+                                fill_merkle_multiproof<typename FRI::merkle_multiproof_type, Endianness>(
+                                    initial_multiproof->second));
                         }
-                    }
-
-                    // round merkle proofs
-                    nil::marshalling::types::standard_array_list<
-                        TTypeBase, typename types::merkle_proof<TTypeBase, typename FRI::merkle_proof_type>>
-                        filled_round_merkle_proofs;
-                    for (std::size_t i = 0; i < lambda; i++) {
-                        const auto &query_proof = proof.query_proofs[i];
-                        for (const auto &round_proof : query_proof.round_proofs) {
+                        for (const auto &round_multiproof : proof.round_multiproofs) {
                             filled_round_merkle_proofs.value().push_back(
-                                fill_merkle_proof<typename FRI::merkle_proof_type, Endianness>(round_proof.p));
+                                fill_merkle_multiproof<typename FRI::merkle_multiproof_type, Endianness>(
+                                    round_multiproof));
+                        }
+                    } else {
+                        for (std::size_t i = 0; i < lambda; i++) {
+                            const auto &query_proof = proof.query_proofs[i];
+                            for (const auto &it : query_proof.initial_proof) {
+                                const auto &initial_proof = it.second;
+                                filled_initial_merkle_proofs.value().push_back(
+                                    fill_merkle_proof<typename FRI::merkle_proof_type, Endianness>(initial_proof.p));
+                            }
+                        }
+                        for (std::size_t i = 0; i < lambda; i++) {
+                            const auto &query_proof = proof.query_proofs[i];
+                            for (const auto &round_proof : query_proof.round_proofs) {
+                                filled_round_merkle_proofs.value().push_back(
+                                    fill_merkle_proof<typename FRI::merkle_proof_type, Endianness>(round_proof.p));
+                            }
                         }
                     }
 
                     auto filled_final_polynomial =
                         fill_polynomial<Endianness, typename FRI::polynomial_type>(proof.final_polynomial);
 
-                    return typename fri_proof<nil::marshalling::field_type<Endianness>, FRI>::type(std::tuple(
+                    auto filled_fields = std::tuple(
                         filled_fri_roots, filled_step_list, filled_initial_val, filled_round_val,
                         filled_initial_merkle_proofs, filled_round_merkle_proofs, filled_final_polynomial,
                         nil::marshalling::types::integral<TTypeBase, typename FRI::grinding_type::output_type>(
-                            proof.proof_of_work)));
+                            proof.proof_of_work));
+
+                    if constexpr (FRI::merkle_cap_height != 0) {
+                        using merkle_cap_type = typename fri_proof<TTypeBase, FRI>::merkle_cap_type;
+                        auto fill_cap = [](const std::vector<typename FRI::commitment_type> &cap) {
+                            std::tuple_element_t<0, typename merkle_cap_type::value_type> filled_nodes;
+                            for (const auto &node : cap) {
+                                filled_nodes.value().push_back(
+                                    fill_merkle_node_value<typename FRI::commitment_type, Endianness>(node));
+                            }
+                            return merkle_cap_type(std::make_tuple(filled_nodes));
+                        };
+
+                        typename fri_proof<TTypeBase, FRI>::merkle_caps_type filled_caps;
+                        for (const auto &it : batch_info) {
+                            auto initial_cap = proof.initial_caps.find(it.first);
+                            if (initial_cap == proof.initial_caps.end()) {
+                                throw std::invalid_argument(std::string("No initial merkle cap for batch ") +
+                                                            std::to_string(it.first));
+                            }
+                            filled_caps.value().push_back(fill_cap(initial_cap->second));
+                        }
+                        for (const auto &round_cap : proof.round_caps) {
+                            filled_caps.value().push_back(fill_cap(round_cap));
+                        }
+                        return typename fri_proof<nil::marshalling::field_type<Endianness>, FRI>::type(
+                            std::tuple_cat(filled_fields, std::make_tuple(filled_caps)));
+                    } else {
+                        return typename fri_proof<nil::marshalling::field_type<Endianness>, FRI>::type(filled_fields);
+                    }
                 }
 
                 template<typename Endianness, typename FRI>
@@ -460,7 +526,18 @@ namespace nil {
                         step_list.push_back(c);
                     }
 
-                    std::size_t lambda = std::get<5>(filled_proof.value()).value().size() / step_list.size();
+                    std::size_t lambda;
+                    if constexpr (FRI::use_merkle_multiproofs) {
+                        // No per-query merkle proofs, count the queries by their round values.
+                        std::size_t query_round_values = 0;
+                        for (std::size_t r = 0; r < step_list.size(); r++) {
+                            query_round_values +=
+                                FRI::m * (r == step_list.size() - 1 ? 1 : (1 << (step_list[r + 1] - 1)));
+                        }
+                        lambda = std::get<3>(filled_proof.value()).value().size() / query_round_values;
+                    } else {
+                        lambda = std::get<5>(filled_proof.value()).value().size() / step_list.size();
+                    }
                     proof.query_proofs.resize(lambda);
                     // initial_polynomials values
                     std::size_t coset_size = 1 << (step_list[0] - 1);
@@ -507,31 +584,54 @@ namespace nil {
                             }
                         }
                     }
-                    // initial merkle proofs
                     auto const &initial_merkle_proofs = std::get<4>(filled_proof.value()).value();
-                    cur = 0;
-                    for (std::size_t i = 0; i < lambda; i++) {
+                    auto const &round_merkle_proofs = std::get<5>(filled_proof.value()).value();
+                    if constexpr (FRI::use_merkle_multiproofs) {
+                        // initial merkle multiproofs
+                        if (initial_merkle_proofs.size() != batch_info.size()) {
+                            throw std::invalid_argument("Wrong number of initial merkle multiproofs");
+                        }
+                        cur = 0;
                         for (const auto &it : batch_info) {
-                            if (cur >= initial_merkle_proofs.size()) {
-                                throw std::invalid_argument("Not enough initial_merkle_proof values");
+                            proof.initial_multiproofs[it.first] =
+                                make_merkle_multiproof<typename FRI::merkle_multiproof_type, Endianness>(
+                                    initial_merkle_proofs[cur++]);
+                        }
+
+                        // round merkle multiproofs
+                        if (round_merkle_proofs.size() != step_list.size()) {
+                            throw std::invalid_argument("Wrong number of round merkle multiproofs");
+                        }
+                        for (const auto &round_multiproof : round_merkle_proofs) {
+                            proof.round_multiproofs.push_back(
+                                make_merkle_multiproof<typename FRI::merkle_multiproof_type, Endianness>(
+                                    round_multiproof));
+                        }
+                    } else {
+                        // initial merkle proofs
+                        cur = 0;
+                        for (std::size_t i = 0; i < lambda; i++) {
+                            for (const auto &it : batch_info) {
+                                if (cur >= initial_merkle_proofs.size()) {
+                                    throw std::invalid_argument("Not enough initial_merkle_proof values");
+                                }
+                                proof.query_proofs[i].initial_proof[it.first].p =
+                                    make_merkle_proof<typename FRI::merkle_proof_type, Endianness>(
+                                        initial_merkle_proofs[cur++]);
                             }
-                            proof.query_proofs[i].initial_proof[it.first].p =
-                                make_merkle_proof<typename FRI::merkle_proof_type, Endianness>(
-                                    std::get<4>(filled_proof.value()).value()[cur++]);
                         }
-                    }
 
-                    // round merkle proofs
-                    auto const &round_merkle_proofs = std::get<5>(filled_proof.value()).value();
-                    cur = 0;
-                    for (std::size_t i = 0; i < lambda; i++) {
-                        for (std::size_t r = 0; r < step_list.size(); r++, cur++) {
-                            if (cur >= round_merkle_proofs.size()) {
-                                throw std::invalid_argument("Not enough round_merkle_proof values");
+                        // round merkle proofs
+                        cur = 0;
+                        for (std::size_t i = 0; i < lambda; i++) {
+                            for (std::size_t r = 0; r < step_list.size(); r++, cur++) {
+                                if (cur >= round_merkle_proofs.size()) {
+                                    throw std::invalid_argument("Not enough round_merkle_proof values");
+                                }
+                                proof.query_proofs[i].round_proofs[r].p =
+                                    make_merkle_proof<typename FRI::merkle_proof_type, Endianness>(
+                                        round_merkle_proofs[cur]);
                             }
-                            proof.query_proofs[i].round_proofs[r].p =
-                                make_merkle_proof<typename FRI::merkle_proof_type, Endianness>(
-                                    round_merkle_proofs[cur]);
                         }
                     }
 
@@ -541,6 +641,29 @@ namespace nil {
 
                     // proof_of_work
                     proof.proof_of_work = std::get<7>(filled_proof.value()).value();
+
+                    // merkle caps
+                    if constexpr (FRI::merkle_cap_height != 0) {
+                        auto const &merkle_caps = std::get<8>(filled_proof.value()).value();
+                        if (merkle_caps.size() != batch_info.size() + step_list.size()) {
+                            throw std::invalid_argument("Wrong number of merkle caps");
+                        }
+                        auto make_cap = [](const typename fri_proof<nil::marshalling::field_type<Endianness>,
+                                                                    FRI>::merkle_cap_type &filled_cap) {
+                            std::vector<typename FRI::commitment_type> cap;
+                            for (const auto &node : std::get<0>(filled_cap.value()).value()) {
+                                cap.push_back(make_merkle_node_value<typename FRI::commitment_type, Endianness>(node));
+                            }
+                            return cap;
+                        };
+                        cur = 0;
+                        for (const auto &it : batch_info) {
+                            proof.initial_caps[it.first] = make_cap(merkle_caps[cur++]);
+                        }
+                        while (cur < merkle_caps.size()) {
+                            proof.round_caps.push_back(make_cap(merkle_caps[cur++]));
+                        }
+                    }
                     return proof;
                 }
 
@@ -204,6 +204,24 @@ BOOST_AUTO_TEST_CASE(fri_grinding_proof_test) {
                                        alg_random_engines.template get_alg_engine<field_type>(), generic_random_engine);
     test_fri_proof<Endianness, FRI>(proof, batch_info, fri_params);
 }
+
+BOOST_AUTO_TEST_CASE(fri_proof_merkle_tree_arity_4_test) {
+    using FRI4 = typename nil::crypto3::zk::commitments::detail::basic_batched_fri<
+        field_type, hash_type, hash_type, m, nil::crypto3::zk::commitments::proof_of_work<hash_type>, 4>;
+
+    nil::crypto3::marshalling::types::batch_info_type batch_info;
+    batch_info[0] = 1;
+    batch_info[1] = 5;
+    batch_info[3] = 6;
+    batch_info[4] = 3;
+
+    typename FRI4::params_type fri_params(1, 11, lambda, 4);
+
+    auto proof =
+        generate_random_fri_proof<FRI4>(2, 5, fri_params.step_list, lambda, false, batch_info,
+                                        alg_random_engines.template get_alg_engine<field_type>(), generic_random_engine);
+    test_fri_proof<Endianness, FRI4>(proof, batch_info, fri_params);
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_FIXTURE_TEST_SUITE(
@@ -211,7 +229,8 @@ BOOST_FIXTURE_TEST_SUITE(
     nil::crypto3::zk::test_tools::random_test_initializer<algebra::curves::pallas::base_field_type>)
 using Endianness = nil::marshalling::option::big_endian;
 
-BOOST_AUTO_TEST_CASE(marshalling_fri_basic_test) {
+template<std::size_t MerkleTreeArity, bool UseMerkleMultiproofs, std::size_t MerkleCapHeight = 0>
+void test_real_fri_proof() {
     // setup
     using curve_type = algebra::curves::pallas;
     using field_type = typename curve_type::base_field_type;
@@ -225,7 +244,10 @@ BOOST_AUTO_TEST_CASE(marshalling_fri_basic_test) {
     constexpr static const std::size_t m = 2;
     constexpr static const std::size_t lambda = 40;
 
-    typedef zk::commitments::fri<field_type, merkle_hash_type, transcript_hash_type, m> fri_type;
+    typedef zk::commitments::fri<field_type, merkle_hash_type, transcript_hash_type, m,
+                                 zk::commitments::proof_of_work<transcript_hash_type>, MerkleTreeArity,
+                                 UseMerkleMultiproofs, MerkleCapHeight>
+        fri_type;
 
     static_assert(zk::is_commitment<fri_type>::value);
     static_assert(!zk::is_commitment<merkle_hash_type>::value);
@@ -235,10 +257,10 @@ BOOST_AUTO_TEST_CASE(marshalling_fri_basic_test) {
 
     // Setup params
     std::size_t degree_log = std::ceil(std::log2(d - 1));
-    typename fri_type::params_type fri_params(3, /*max_step*/
-                                              degree_log,
-                                              lambda,
-                                              2    // expand_factor
+    params_type fri_params(3, /*max_step*/
+                           degree_log,
+                           lambda,
+                           2    // expand_factor
     );
 
     // commit
@@ -260,6 +282,32 @@ BOOST_AUTO_TEST_CASE(marshalling_fri_basic_test) {
     nil::crypto3::marshalling::types::batch_info_type batch_info;
     batch_info[0] = 1;
     test_fri_proof<Endianness, fri_type>(proof, batch_info, fri_params);
+
+    // The proof read back must still verify.
+    auto filled_proof =
+        nil::crypto3::marshalling::types::fill_fri_proof<Endianness, fri_type>(proof, batch_info, fri_params);
+    proof_type read_proof =
+        nil::crypto3::marshalling::types::make_fri_proof<Endianness, fri_type>(filled_proof, batch_info);
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
+    BOOST_CHECK(zk::algorithms::verify_eval<fri_type>(read_proof, root, fri_params, transcript_verifier));
+}
+
+BOOST_AUTO_TEST_CASE(marshalling_fri_basic_test) {
+    test_real_fri_proof<2, false>();
+}
+
+BOOST_AUTO_TEST_CASE(marshalling_fri_merkle_multiproofs_test) {
+    test_real_fri_proof<2, true>();
+}
+
+BOOST_AUTO_TEST_CASE(marshalling_fri_merkle_tree_arity_4_test) {
+    test_real_fri_proof<4, false>();
+    test_real_fri_proof<4, true>();
+}
+
+BOOST_AUTO_TEST_CASE(marshalling_fri_merkle_caps_test) {
+    test_real_fri_proof<2, false, 1>();
+    test_real_fri_proof<4, false, 1>();
 }
 
 BOOST_AUTO_TEST_SUITE_END()
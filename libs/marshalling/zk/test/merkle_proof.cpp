@@ -165,7 +165,15 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(marshalling_merkle_proof_arity_2_test, HashType, H
     }
 }
 
-// Poseidon hash function supports only Arity 2.
+// Rate-4 Poseidon compresses four children in a single permutation.
+using wide_poseidon =
+    nil::crypto3::hashes::poseidon<nil::crypto3::hashes::detail::poseidon1_policy<field_type, 128, 4>>;
+
+BOOST_AUTO_TEST_CASE(marshalling_merkle_proof_poseidon_arity_4_test) {
+    test_merkle_proof<nil::marshalling::option::big_endian, wide_poseidon, 4>(3);
+}
+
+// Narrow Poseidon instances only compress Arity 2 nodes in a single permutation.
 using BlockHashTypes = boost::mpl::list<nil::crypto3::hashes::sha2<256>, nil::crypto3::hashes::keccak_1600<512>>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(marshalling_merkle_proof_arity_3_test, HashType, BlockHashTypes) {
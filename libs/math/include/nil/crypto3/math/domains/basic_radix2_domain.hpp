@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_HPP
 #define CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_HPP
 
+#include <span>
 #include <vector>
 
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -147,6 +148,54 @@ namespace nil {
                     }
                 }
 
+                /** \brief Batch 'fft' over views into caller-owned storage, e.g. columns of a plonk_column_arena.
+                 *  Views are transformed in place, no temporary vectors are allocated.
+                 */
+                void batch_fft_views(const std::vector<std::span<value_type>> &views) override {
+                    for (std::span<value_type> view : views) {
+                        if (view.size() != this->m) {
+                            throw std::invalid_argument("basic_radix2: expected view.size() == this->m");
+                        }
+                        detail::basic_radix2_fft_cached<FieldType>(view, this->fft_cache->first);
+                    }
+                }
+
+                /** \brief Batch 'inverse_fft' over views into caller-owned storage.
+                 */
+                void batch_inverse_fft_views(const std::vector<std::span<value_type>> &views) override {
+                    const field_value_type sconst = field_value_type(this->m).inversed();
+                    for (std::span<value_type> view : views) {
+                        if (view.size() != this->m) {
+                            throw std::invalid_argument("basic_radix2: expected view.size() == this->m");
+                        }
+                        detail::basic_radix2_fft_cached<FieldType>(view, this->fft_cache->second);
+                        for (value_type &v_i : view) {
+                            v_i *= sconst;
+                        }
+                    }
+                }
+
+                /** \brief Batch 'inverse_fft' from inputs into views. The bit-reversal pass of each FFT reads
+                 *  the input directly, so the views are filled without a separate copy.
+                 */
+                void batch_inverse_fft_views(const std::vector<std::span<const value_type>> &inputs,
+                                             const std::vector<std::span<value_type>> &views) override {
+                    if (inputs.size() != views.size()) {
+                        throw std::invalid_argument("basic_radix2: expected inputs.size() == views.size()");
+                    }
+                    const field_value_type sconst = field_value_type(this->m).inversed();
+                    for (std::size_t i = 0; i < views.size(); ++i) {
+                        std::span<value_type> view = views[i];
+                        if (view.size() != this->m) {
+                            throw std::invalid_argument("basic_radix2: expected view.size() == this->m");
+                        }
+                        detail::basic_radix2_fft_cached<FieldType>(inputs[i], view, this->fft_cache->second);
+                        for (value_type &v_i : view) {
+                            v_i *= sconst;
+                        }
+                    }
+                }
+
                 void inverse_fft(std::vector<value_type> &a) override {
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
@@ -28,10 +28,13 @@
 #define CRYPTO3_MATH_BASIC_RADIX2_DOMAIN_AUX_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/batch_operations.hpp>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
@@ -58,6 +61,37 @@ namespace nil {
                     }
                 }
 
+                /*
+                 * Butterfly stages of the radix-2 FFT, a must already be in bit-reversed order.
+                 */
+                template<typename FieldType, typename Range>
+                void basic_radix2_fft_butterflies(Range &a, std::size_t logn,
+                                                  const std::vector<typename FieldType::value_type> &omega_cache) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    const std::size_t n = a.size();
+
+                    // invariant: m = 2^{s-1}
+                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                        // w_m is 2^s-th root of unity now
+                        for (std::size_t k = 0; k < n; k += 2 * m) {
+                            if constexpr (std::is_same<value_type, typename FieldType::value_type>::value) {
+                                if (m >= algebra::fields::detail::batch_kernel_threshold) {
+                                    algebra::fields::butterfly_n(&a[k], &a[k + m], omega_cache.data(), inc, m);
+                                    continue;
+                                }
+                            }
+                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
+                                value_type t = a[k + j + m];
+                                t *= omega_cache[idx];
+                                a[k + j + m] = a[k + j];
+                                a[k + j + m] -= t;
+                                a[k + j] += t;
+                            }
+                        }
+                    }
+                }
+
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
@@ -83,19 +117,35 @@ namespace nil {
                             std::swap(a[k], a[rk]);
                     }
 
-                    // invariant: m = 2^{s-1}
-                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
-                        // w_m is 2^s-th root of unity now
-                        for (std::size_t k = 0; k < n; k += 2 * m) {
-                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
-                                value_type t = a[k + j + m];
-                                t *= omega_cache[idx];
-                                a[k + j + m] = a[k + j];
-                                a[k + j + m] -= t;
-                                a[k + j] += t;
-                            }
-                        }
+                    basic_radix2_fft_butterflies<FieldType>(a, logn, omega_cache);
+                }
+
+                /*
+                 * Out-of-place version of basic_radix2_fft_cached: the bit-reversal permutation gathers the values
+                 * of input straight into a, so filling a column of a larger buffer costs no separate copy pass.
+                 * The input may be shorter than a, the missing values are taken to be zero.
+                 */
+                template<typename FieldType, typename InputRange, typename Range>
+                void basic_radix2_fft_cached(const InputRange &input, Range &a,
+                                             const std::vector<typename FieldType::value_type> &omega_cache) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (std::size(input) > n)
+                        throw std::invalid_argument("expected input.size() <= n");
+                    bench::register_fft<FieldType>(logn);
+
+                    const std::size_t input_size = std::size(input);
+                    for (std::size_t k = 0; k < n; ++k) {
+                        a[crypto3::math::detail::bitreverse(k, logn)] =
+                            k < input_size ? value_type(input[k]) : value_type::zero();
                     }
+
+                    basic_radix2_fft_butterflies<FieldType>(a, logn, omega_cache);
                 }
 
                 /**
@@ -26,6 +26,9 @@
 #ifndef CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 #define CRYPTO3_MATH_EVALUATION_DOMAIN_HPP
 
+#include <algorithm>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/multiprecision/integer.hpp>
@@ -96,6 +99,62 @@ namespace nil {
                  */
                 virtual void batch_inverse_fft(std::vector<std::vector<value_type>> &a) = 0;
 
+                /**
+                 * Compute the FFT, over the domain S, of every view in a, in place. Each view must hold exactly m
+                 * elements, which lets columns living in one contiguous allocation be transformed without copies.
+                 *
+                 * The default implementation goes through a temporary vector. Domains that can transform an
+                 * arbitrary contiguous range override this method.
+                 */
+                virtual void batch_fft_views(const std::vector<std::span<value_type>> &a) {
+                    std::vector<value_type> tmp;
+                    for (const std::span<value_type> &view : a) {
+                        if (view.size() != m) {
+                            throw std::invalid_argument("evaluation_domain: expected view.size() == this->m");
+                        }
+                        tmp.assign(view.begin(), view.end());
+                        fft(tmp);
+                        std::copy(tmp.begin(), tmp.end(), view.begin());
+                    }
+                }
+
+                /**
+                 * Compute the inverse FFT, over the domain S, of every view in a, in place. Each view must hold
+                 * exactly m elements.
+                 */
+                virtual void batch_inverse_fft_views(const std::vector<std::span<value_type>> &a) {
+                    std::vector<value_type> tmp;
+                    for (const std::span<value_type> &view : a) {
+                        if (view.size() != m) {
+                            throw std::invalid_argument("evaluation_domain: expected view.size() == this->m");
+                        }
+                        tmp.assign(view.begin(), view.end());
+                        inverse_fft(tmp);
+                        std::copy(tmp.begin(), tmp.end(), view.begin());
+                    }
+                }
+
+                /**
+                 * Compute the inverse FFT, over the domain S, of every range in inputs and write the result to the
+                 * view with the same index. Inputs shorter than m are padded with zeros, the inputs themselves are
+                 * not modified. This fills caller-owned storage from existing columns without copying them there
+                 * first.
+                 */
+                virtual void batch_inverse_fft_views(const std::vector<std::span<const value_type>> &inputs,
+                                                     const std::vector<std::span<value_type>> &a) {
+                    if (inputs.size() != a.size()) {
+                        throw std::invalid_argument("evaluation_domain: expected inputs.size() == a.size()");
+                    }
+                    for (std::size_t i = 0; i < a.size(); ++i) {
+                        if (a[i].size() != m || inputs[i].size() > m) {
+                            throw std::invalid_argument("evaluation_domain: expected view.size() == this->m");
+                        }
+                        auto it = std::copy(inputs[i].begin(), inputs[i].end(), a[i].begin());
+                        std::fill(it, a[i].end(), value_type::zero());
+                    }
+                    batch_inverse_fft_views(a);
+                }
+
                 /**
                  * Evaluate all Lagrange polynomials.
                  *
@@ -33,8 +33,10 @@
 #include <vector>
 #include <ostream>
 #include <iterator>
+#include <type_traits>
 #include <unordered_map>
 
+#include <nil/crypto3/math/algorithms/batch_inverse.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
@@ -42,11 +44,80 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fields/batch_operations.hpp>
+#include <nil/crypto3/algebra/fields/unreduced_accumulator.hpp>
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
+            namespace detail {
+                /**
+                 * Barycentric weights of the radix-2 domain {omega^i} of size n at the point z, such that
+                 * p(z) = sum_i w_i * p(omega^i) for every polynomial p of degree < n:
+                 *     w_i = (z^n - 1) / n * omega^i / (z - omega^i).
+                 * The n denominators are inverted at once with Montgomery's trick. If z lies on the domain,
+                 * the weights degenerate to the unit vector selecting the matching evaluation.
+                 */
+                template<typename FieldValueType, typename EvaluationFieldValueType>
+                std::vector<EvaluationFieldValueType> barycentric_weights(std::size_t n,
+                                                                          const EvaluationFieldValueType& z) {
+                    typedef typename FieldValueType::field_type FieldType;
+
+                    std::vector<EvaluationFieldValueType> weights;
+                    if (n == 0) {
+                        return weights;
+                    }
+
+                    const FieldValueType omega = unity_root<FieldType>(n);
+                    weights.reserve(n);
+                    FieldValueType omega_i = FieldValueType::one();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        weights.emplace_back(z - EvaluationFieldValueType(omega_i));
+                        if (weights.back() == EvaluationFieldValueType::zero()) {
+                            std::vector<EvaluationFieldValueType> unit(n, EvaluationFieldValueType::zero());
+                            unit[i] = EvaluationFieldValueType::one();
+                            return unit;
+                        }
+                        omega_i *= omega;
+                    }
+
+                    weights = batch_inverse_nonzero(weights);
+
+                    EvaluationFieldValueType factor =
+                        (z.pow(n) - EvaluationFieldValueType::one()) * FieldValueType(n).inversed();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        weights[i] *= factor;
+                        factor = factor * omega;
+                    }
+                    return weights;
+                }
+
+                /**
+                 * Evaluates sum_i weights[i] * values[i], the values being the DFS form of a polynomial.
+                 */
+                template<typename EvaluationFieldValueType, typename ContainerType>
+                EvaluationFieldValueType barycentric_evaluate(const std::vector<EvaluationFieldValueType>& weights,
+                                                              const ContainerType& values) {
+                    BOOST_ASSERT_MSG(weights.size() == values.size(),
+                                     "Barycentric weights do not match the polynomial size");
+                    if constexpr (std::is_same_v<typename ContainerType::value_type, EvaluationFieldValueType>) {
+                        // One reduction for the whole sum.
+                        algebra::fields::unreduced_accumulator<EvaluationFieldValueType> result;
+                        for (std::size_t i = 0; i < weights.size(); ++i) {
+                            result.mul_add(weights[i], values[i]);
+                        }
+                        return result.reduce();
+                    } else {
+                        EvaluationFieldValueType result = EvaluationFieldValueType::zero();
+                        for (std::size_t i = 0; i < weights.size(); ++i) {
+                            result += weights[i] * values[i];
+                        }
+                        return result;
+                    }
+                }
+            }    // namespace detail
+
             // size_t __global_from_coefficients_counter_test = 0;
             // size_t __global_coefficients_counter_test = 0;
             //  Optimal val.size must be power of two, if it's not true we have points that we will never use
@@ -409,16 +480,19 @@ namespace nil {
                     std::swap(_d, other._d);
                 }
 
+                /**
+                 * Evaluates the polynomial at an arbitrary point straight from the DFS form, using barycentric
+                 * interpolation on the domain of size this->size(). No inverse FFT is performed.
+                 * To evaluate many polynomials at the same point use polynomial_dfs_point_evaluator, which
+                 * shares the weights.
+                 */
                 template<typename EvaluationFieldValueType>
                 EvaluationFieldValueType evaluate(const EvaluationFieldValueType& value) const {
-                    std::vector<FieldValueType> tmp = this->coefficients();
-                    auto result = EvaluationFieldValueType::zero();
-                    auto end = tmp.end();
-                    // TODO(martun): parallelize the lower loop.
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
+                    if (this->val.empty()) {
+                        return EvaluationFieldValueType::zero();
                     }
-                    return result;
+                    return detail::barycentric_evaluate(
+                        detail::barycentric_weights<FieldValueType>(this->size(), value), this->val);
                 }
 
                 /**
@@ -628,15 +702,11 @@ namespace nil {
                         polynomial_dfs tmp(other);
                         tmp.resize(polynomial_s, other_domain, new_domain);
 
-                        for (std::size_t i = 0; i < this->size(); ++i) {
-                            this->val[i] *= tmp[i];
-                        }
+                        algebra::fields::mul_n(this->val.data(), this->val.data(), tmp.val.data(), this->size());
                         return *this;
                     }
 
-                    for (std::size_t i = 0; i < this->size(); ++i) {
-                        this->val[i] *= other[i];
-                    }
+                    algebra::fields::mul_n(this->val.data(), this->val.data(), other.val.data(), this->size());
 
                     return *this;
                 }
@@ -646,9 +716,7 @@ namespace nil {
                  * and stores result in polynomial A.
                  */
                 polynomial_dfs& operator*=(const FieldValueType& c) {
-                    for (FieldValueType& value : this->val) {
-                        value *= c;
-                    }
+                    algebra::fields::mul_n(this->val.data(), this->val.data(), c, this->size());
                     return *this;
                 }
 
@@ -1061,6 +1129,69 @@ namespace nil {
                 }
                 return result;
             }
+
+            /**
+             * Evaluates polynomials in DFS form at a fixed point. Barycentric weights are computed once per
+             * domain size and reused for every polynomial of that size, so evaluating k polynomials of size n
+             * costs one batch inversion and k * n multiplications.
+             */
+            template<typename FieldValueType, typename EvaluationFieldValueType = FieldValueType>
+            class polynomial_dfs_point_evaluator {
+            public:
+                typedef EvaluationFieldValueType value_type;
+
+                explicit polynomial_dfs_point_evaluator(const EvaluationFieldValueType& point) : _point(point) {
+                }
+
+                template<typename Allocator>
+                EvaluationFieldValueType operator()(const polynomial_dfs<FieldValueType, Allocator>& poly) {
+                    if (poly.size() == 0) {
+                        return EvaluationFieldValueType::zero();
+                    }
+                    return detail::barycentric_evaluate(weights(poly.size()), poly);
+                }
+
+                /// Weights for the domain of the given size, computed on first use.
+                const std::vector<EvaluationFieldValueType>& weights(std::size_t size) {
+                    auto it = _weights.find(size);
+                    if (it == _weights.end()) {
+                        it = _weights
+                                 .emplace(size, detail::barycentric_weights<FieldValueType>(size, _point))
+                                 .first;
+                    }
+                    return it->second;
+                }
+
+                const EvaluationFieldValueType& point() const {
+                    return _point;
+                }
+
+            private:
+                EvaluationFieldValueType _point;
+                std::unordered_map<std::size_t, std::vector<EvaluationFieldValueType>> _weights;
+            };
+
+            /**
+             * Evaluates every polynomial at every point, result[i][j] = polys[i](points[j]).
+             * Weights are shared by all polynomials of the same size, and only one point's weights are kept
+             * alive at a time.
+             */
+            template<typename FieldValueType, typename Allocator, typename EvaluationFieldValueType>
+            std::vector<std::vector<EvaluationFieldValueType>>
+                polynomial_batch_evaluate(const std::vector<polynomial_dfs<FieldValueType, Allocator>>& polys,
+                                          const std::vector<EvaluationFieldValueType>& points) {
+                PROFILE_SCOPE("Polynomial batch evaluation in DFS form");
+
+                std::vector<std::vector<EvaluationFieldValueType>> result(
+                    polys.size(), std::vector<EvaluationFieldValueType>(points.size()));
+                for (std::size_t j = 0; j < points.size(); ++j) {
+                    polynomial_dfs_point_evaluator<FieldValueType, EvaluationFieldValueType> evaluator(points[j]);
+                    for (std::size_t i = 0; i < polys.size(); ++i) {
+                        result[i][j] = evaluator(polys[i]);
+                    }
+                }
+                return result;
+            }
         }    // namespace math
     }    // namespace crypto3
 }    // namespace nil
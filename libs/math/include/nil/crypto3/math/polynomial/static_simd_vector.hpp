@@ -33,6 +33,8 @@
 #include <boost/container/static_vector.hpp>
 #include <boost/functional/hash.hpp>
 
+#include <nil/crypto3/algebra/fields/batch_operations.hpp>
+
 #include <nil/crypto3/bench/scoped_profiler.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
@@ -271,23 +273,17 @@ namespace nil::crypto3::math {
 
         static_simd_vector operator*(const static_simd_vector& other) const {
             static_simd_vector result;
-            for (std::size_t i = 0; i < Size; ++i) {
-                result[i] = (*this)[i] * other[i];
-            }
+            algebra::fields::mul_n(result.data(), this->data(), other.data(), Size);
             return result;
         }
 
         static_simd_vector& operator*=(const static_simd_vector& other) {
-            for (std::size_t i = 0; i < Size; ++i) {
-                (*this)[i] *= other[i];
-            }
+            algebra::fields::mul_n(this->data(), this->data(), other.data(), Size);
             return *this;
         }
 
         static_simd_vector& operator*=(const FieldValueType& alpha) {
-            for (std::size_t i = 0; i < Size; ++i) {
-                (*this)[i] *= alpha;
-            }
+            algebra::fields::mul_n(this->data(), this->data(), alpha, Size);
             return *this;
         }
 
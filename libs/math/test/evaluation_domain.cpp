@@ -28,6 +28,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <memory>
+#include <span>
 #include <vector>
 #include <cstdint>
 #include <algorithm>
@@ -191,6 +192,51 @@ void test_inverse_coset_ftt_of_coset_fft() {
     }
 }
 
+template<typename FieldType, typename DomainType>
+void test_batch_fft_views(std::size_t m) {
+    typedef typename FieldType::value_type value_type;
+    const std::size_t columns_amount = 3;
+
+    // All columns live in one contiguous buffer, the same way plonk_column_arena stores them.
+    std::vector<value_type> storage(columns_amount * m);
+    for (auto &v : storage) {
+        v = random_element<FieldType>();
+    }
+    const std::vector<value_type> original = storage;
+
+    std::shared_ptr<evaluation_domain<FieldType>> domain = std::make_shared<DomainType>(m);
+
+    std::vector<std::span<value_type>> views;
+    for (std::size_t i = 0; i < columns_amount; ++i) {
+        views.emplace_back(storage.data() + i * m, m);
+    }
+
+    domain->batch_fft_views(views);
+    for (std::size_t i = 0; i < columns_amount; ++i) {
+        std::vector<value_type> expected(original.begin() + i * m, original.begin() + (i + 1) * m);
+        domain->fft(expected);
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), views[i].begin()));
+    }
+
+    domain->batch_inverse_fft_views(views);
+    BOOST_CHECK(storage == original);
+
+    // Out-of-place inverse FFT from separately stored, possibly shorter, inputs into the views.
+    std::vector<std::vector<value_type>> inputs(columns_amount);
+    std::vector<std::span<const value_type>> input_views;
+    for (std::size_t i = 0; i < columns_amount; ++i) {
+        inputs[i].assign(original.begin() + i * m, original.begin() + i * m + (i == 0 ? m / 2 : m));
+        input_views.emplace_back(inputs[i].data(), inputs[i].size());
+    }
+    domain->batch_inverse_fft_views(input_views, views);
+    for (std::size_t i = 0; i < columns_amount; ++i) {
+        std::vector<value_type> expected = inputs[i];
+        expected.resize(m, value_type::zero());
+        domain->inverse_fft(expected);
+        BOOST_CHECK(std::equal(expected.begin(), expected.end(), views[i].begin()));
+    }
+}
+
 template<typename FieldType>
 void test_lagrange_coefficients() {
     typedef typename FieldType::value_type value_type;
@@ -524,6 +570,14 @@ BOOST_AUTO_TEST_CASE(curve_elements_lagrange_coefficients) {
                                               arithmetic_sequence_domain<field_type, group_value_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(batch_fft_views) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+
+    test_batch_fft_views<field_type, basic_radix2_domain<field_type>>(16);
+    test_batch_fft_views<field_type, step_radix2_domain<field_type>>(4);
+    test_batch_fft_views<fields::goldilocks, basic_radix2_domain<fields::goldilocks>>(32);
+}
+
 BOOST_AUTO_TEST_CASE(get_vanishing_polynomial) {
     typedef curves::bls12<381>::scalar_field_type field_type;
 
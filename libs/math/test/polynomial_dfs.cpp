@@ -1389,6 +1389,59 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_equality_check_perf_test, *boost::unit_test:
     std::cout << "Equality check time: " << duration.count() << " microseconds." << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_dfs_barycentric_evaluate_test) {
+    typedef typename FieldType::value_type value_type;
+
+    for (std::size_t size : {1, 2, 8, 64}) {
+        std::vector<value_type> values(size);
+        for (auto& value : values) {
+            value = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polynomial_dfs<value_type> poly(size - 1, values);
+        polynomial<value_type> poly_coeffs(poly.coefficients());
+
+        value_type point = nil::crypto3::algebra::random_element<FieldType>();
+        BOOST_CHECK(poly.evaluate(point) == poly_coeffs.evaluate(point));
+
+        // Points on the domain select the stored evaluation.
+        value_type omega = unity_root<FieldType>(size);
+        BOOST_CHECK(poly.evaluate(value_type::one()) == values[0]);
+        BOOST_CHECK(poly.evaluate(omega.pow(size - 1)) == values[size - 1]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_batch_evaluate_test) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<polynomial_dfs<value_type>> polys;
+    for (std::size_t size : {4, 16, 16, 32}) {
+        std::vector<value_type> values(size);
+        for (auto& value : values) {
+            value = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polys.emplace_back(size - 1, values);
+    }
+
+    std::vector<value_type> points = {nil::crypto3::algebra::random_element<FieldType>(),
+                                      nil::crypto3::algebra::random_element<FieldType>(),
+                                      unity_root<FieldType>(16)};
+
+    auto result = polynomial_batch_evaluate(polys, points);
+    BOOST_CHECK_EQUAL(result.size(), polys.size());
+    for (std::size_t i = 0; i < polys.size(); ++i) {
+        polynomial<value_type> poly_coeffs(polys[i].coefficients());
+        BOOST_CHECK_EQUAL(result[i].size(), points.size());
+        for (std::size_t j = 0; j < points.size(); ++j) {
+            BOOST_CHECK(result[i][j] == poly_coeffs.evaluate(points[j]));
+        }
+    }
+
+    polynomial_dfs_point_evaluator<value_type> evaluator(points[0]);
+    for (const auto& poly : polys) {
+        BOOST_CHECK(evaluator(poly) == poly.evaluate(points[0]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(polynomial_dfs_batch_VS_normal_conversion_test_suite)
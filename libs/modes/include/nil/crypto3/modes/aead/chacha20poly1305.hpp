@@ -30,8 +30,11 @@
 #include <array>
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -39,10 +42,320 @@
 #include <nil/crypto3/mac/poly1305.hpp>
 #include <nil/crypto3/stream/chacha.hpp>
 
+#include <nil/crypto3/modes/detail/byte_chunks.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace modes {
             namespace aead {
+                namespace detail {
+                    using modes::detail::for_each_chunk;
+                    using modes::detail::transform_chunks;
+
+                    /*!
+                     * @brief ChaCha20 keystream of the AEAD payload (RFC 8439, section 2.8). The keystream is generated
+                     * eight blocks at a time into a buffer that stays in L1 together with the data it is applied to.
+                     */
+                    class chacha20poly1305_keystream {
+                        typedef stream::detail::chacha_functions<20, 96, 256> functions_type;
+
+                    public:
+                        typedef typename functions_type::key_schedule_type key_schedule_type;
+                        typedef typename functions_type::key_type key_type;
+                        typedef typename functions_type::iv_type nonce_type;
+                        typedef typename functions_type::block_type block_type;
+                        typedef mac::poly1305::key_type poly1305_key_type;
+
+                        constexpr static const std::size_t block_size = functions_type::block_size;
+                        constexpr static const std::size_t chunk_blocks = 8;
+                        constexpr static const std::size_t chunk_size = block_size * chunk_blocks;
+
+                        static void schedule_key(key_schedule_type &schedule, const key_type &key) {
+                            functions_type::schedule_key(schedule, key);
+                        }
+
+                        /*!
+                         * @brief Starts the keystream for the nonce. The block with counter 0 becomes the one-time
+                         * Poly1305 key, the payload is encrypted starting from counter 1.
+                         */
+                        void init(const key_schedule_type &keyed_schedule, const nonce_type &nonce) {
+                            schedule = keyed_schedule;
+                            functions_type::schedule_iv(schedule, nonce, 0);
+
+                            block_type block;
+                            functions_type::generate_block(block, schedule);
+                            std::copy(block.begin(), block.begin() + one_time_key.size(), one_time_key.begin());
+
+                            offset = 0;
+                            size = 0;
+                        }
+
+                        const poly1305_key_type &poly1305_key() const {
+                            return one_time_key;
+                        }
+
+                        /*!
+                         * @brief Refills the buffer when it is exhausted.
+                         * @return Amount of bytes out of `length` the next apply_chunk call processes
+                         */
+                        std::size_t next_chunk(std::size_t length) {
+                            if (offset == size) {
+                                refill(length);
+                            }
+                            return std::min(length, size - offset);
+                        }
+
+                        /*!
+                         * @brief XORs the keystream into at most one buffered chunk of the input. `in` and `out` may
+                         * be equal.
+                         * @return Amount of bytes processed
+                         */
+                        std::size_t apply_chunk(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            const std::size_t processed = next_chunk(length);
+                            const std::uint8_t *keystream = buffer.data() + offset;
+                            for (std::size_t i = 0; i != processed; ++i) {
+                                out[i] = in[i] ^ keystream[i];
+                            }
+                            offset += processed;
+                            return processed;
+                        }
+
+                        void apply(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            while (length != 0) {
+                                const std::size_t processed = apply_chunk(in, out, length);
+                                in += processed;
+                                out += processed;
+                                length -= processed;
+                            }
+                        }
+
+                    private:
+                        void refill(std::size_t remaining) {
+                            constexpr std::uint64_t counter_limit = std::numeric_limits<std::uint32_t>::max();
+
+                            offset = 0;
+                            if (remaining >= chunk_size && schedule[12] <= counter_limit - chunk_blocks) {
+                                functions_type::impl_type::chacha_x8(buffer, schedule);
+                                size = chunk_size;
+                                return;
+                            }
+
+                            block_type block;
+                            if (schedule[12] == counter_limit) {
+                                functions_type::generate_block_without_counter_increment(block, schedule);
+                            } else {
+                                functions_type::generate_block(block, schedule);
+                            }
+                            std::copy(block.begin(), block.end(), buffer.begin());
+                            size = block_size;
+                        }
+
+                        key_schedule_type schedule;
+                        std::array<std::uint8_t, chunk_size> buffer;
+                        std::size_t offset;
+                        std::size_t size;
+                        poly1305_key_type one_time_key;
+                    };
+
+                    /*!
+                     * @brief Poly1305 over the AEAD construction (RFC 8439, section 2.8): the AAD and the ciphertext,
+                     * each zero-padded to 16 bytes, followed by both lengths. Data is absorbed as it arrives, nothing
+                     * is buffered beyond the Poly1305 block.
+                     */
+                    class chacha20poly1305_authenticator {
+                        typedef mac::mac_key<mac::poly1305> poly1305_key_schedule_type;
+                        typedef typename poly1305_key_schedule_type::accumulator_type accumulator_type;
+
+                    public:
+                        typedef mac::poly1305::key_type poly1305_key_type;
+                        typedef mac::poly1305::digest_type tag_type;
+
+                        chacha20poly1305_authenticator() : poly1305_key(poly1305_key_type()) {
+                            init(poly1305_key_type());
+                        }
+
+                        void init(const poly1305_key_type &one_time_key) {
+                            poly1305_key = poly1305_key_schedule_type(one_time_key);
+                            poly1305_key.init_accumulator(acc);
+                            aad_size = 0;
+                            ciphertext_size = 0;
+                            aad_finished = false;
+                        }
+
+                        void update_aad(const std::uint8_t *data, std::size_t length) {
+                            if (aad_finished) {
+                                throw std::logic_error("ChaCha20-Poly1305 AAD must precede the payload");
+                            }
+                            poly1305_key.update(acc, data, data + length);
+                            aad_size += length;
+                        }
+
+                        void update_ciphertext(const std::uint8_t *data, std::size_t length) {
+                            finish_aad();
+                            poly1305_key.update(acc, data, data + length);
+                            ciphertext_size += length;
+                        }
+
+                        tag_type finalize() {
+                            finish_aad();
+                            pad16(ciphertext_size);
+
+                            std::array<std::uint8_t, 16> lengths = {0};
+                            for (std::size_t i = 0; i != 8; ++i) {
+                                lengths[i] = static_cast<std::uint8_t>(aad_size >> (8 * i));
+                                lengths[8 + i] = static_cast<std::uint8_t>(ciphertext_size >> (8 * i));
+                            }
+                            poly1305_key.update(acc, lengths.begin(), lengths.end());
+                            return poly1305_key.compute(acc);
+                        }
+
+                        std::uint64_t payload_size() const {
+                            return ciphertext_size;
+                        }
+
+                    private:
+                        void finish_aad() {
+                            if (!aad_finished) {
+                                pad16(aad_size);
+                                aad_finished = true;
+                            }
+                        }
+
+                        void pad16(std::uint64_t size) {
+                            static const std::array<std::uint8_t, 16> zeros = {0};
+                            const std::size_t padding = size % 16 == 0 ? 0 : 16 - size % 16;
+                            poly1305_key.update(acc, zeros.begin(), zeros.begin() + padding);
+                        }
+
+                        poly1305_key_schedule_type poly1305_key;
+                        accumulator_type acc;
+                        std::uint64_t aad_size;
+                        std::uint64_t ciphertext_size;
+                        bool aad_finished;
+                    };
+
+                    constexpr std::uint64_t chacha20poly1305_max_payload_size() {
+                        return static_cast<std::uint64_t>(std::numeric_limits<std::uint32_t>::max()) *
+                               chacha20poly1305_keystream::block_size;
+                    }
+
+                    /*!
+                     * @brief Single-pass streaming ChaCha20-Poly1305. Every keystream chunk is applied and absorbed
+                     * into Poly1305 while it is still in cache, so the payload is read and written exactly once.
+                     * @tparam Encrypting Whether the payload is plaintext (true) or ciphertext (false)
+                     */
+                    template<bool Encrypting>
+                    class chacha20poly1305_stream {
+                    public:
+                        typedef chacha20poly1305_keystream::key_schedule_type key_schedule_type;
+                        typedef chacha20poly1305_keystream::key_type key_type;
+                        typedef chacha20poly1305_keystream::nonce_type nonce_type;
+                        typedef chacha20poly1305_authenticator::tag_type tag_type;
+
+                        chacha20poly1305_stream() = default;
+
+                        chacha20poly1305_stream(const key_type &key, const nonce_type &nonce) {
+                            init(key, nonce);
+                        }
+
+                        void init(const key_type &key, const nonce_type &nonce) {
+                            key_schedule_type schedule;
+                            chacha20poly1305_keystream::schedule_key(schedule, key);
+                            init(schedule, nonce);
+                        }
+
+                        /*!
+                         * @brief Starts a message with a key already expanded by
+                         * chacha20poly1305_keystream::schedule_key, letting many messages share one key setup.
+                         */
+                        void init(const key_schedule_type &keyed_schedule, const nonce_type &nonce) {
+                            keystream.init(keyed_schedule, nonce);
+                            authenticator.init(keystream.poly1305_key());
+                        }
+
+                        void update_aad(std::span<const std::uint8_t> aad) {
+                            authenticator.update_aad(aad.data(), aad.size());
+                        }
+
+                        template<typename InputIterator>
+                        void update_aad(InputIterator first, InputIterator last) {
+                            for_each_chunk<chacha20poly1305_keystream::chunk_size>(
+                                first, last, [this](const std::uint8_t *data, std::size_t length) {
+                                    authenticator.update_aad(data, length);
+                                });
+                        }
+
+                        /*!
+                         * @brief Processes the next piece of the payload into `out`, which must have the same size as
+                         * `in`. The spans may be the same memory, but must not partially overlap.
+                         */
+                        void update(std::span<const std::uint8_t> in, std::span<std::uint8_t> out) {
+                            if (in.size() != out.size()) {
+                                throw std::invalid_argument("ChaCha20-Poly1305 output size must match input size");
+                            }
+                            if (in.size() > chacha20poly1305_max_payload_size() - authenticator.payload_size()) {
+                                throw std::out_of_range("ChaCha20-Poly1305 plaintext is too large");
+                            }
+
+                            const std::uint8_t *src = in.data();
+                            std::uint8_t *dst = out.data();
+                            std::size_t length = in.size();
+                            while (length != 0) {
+                                std::size_t processed;
+                                if constexpr (Encrypting) {
+                                    processed = keystream.apply_chunk(src, dst, length);
+                                    authenticator.update_ciphertext(dst, processed);
+                                } else {
+                                    // Absorb before the keystream is applied, in-place output overwrites the input.
+                                    processed = keystream.next_chunk(length);
+                                    authenticator.update_ciphertext(src, processed);
+                                    keystream.apply_chunk(src, dst, processed);
+                                }
+                                src += processed;
+                                dst += processed;
+                                length -= processed;
+                            }
+                        }
+
+                        void update(std::span<std::uint8_t> data) {
+                            update(data, data);
+                        }
+
+                        /*!
+                         * @brief Completes encryption.
+                         * @return Authentication tag of the AAD and the ciphertext
+                         */
+                        tag_type finalize()
+                            requires Encrypting
+                        {
+                            return authenticator.finalize();
+                        }
+
+                        /*!
+                         * @brief Completes decryption by checking the tag in constant time.
+                         * @note Plaintext has already been released by update(). Callers must discard it when this
+                         * returns false; the one-shot chacha20poly1305::decrypt verifies before decrypting instead.
+                         */
+                        bool finalize(const tag_type &expected_tag)
+                            requires(!Encrypting)
+                        {
+                            const tag_type tag = authenticator.finalize();
+                            std::uint8_t diff = 0;
+                            for (std::size_t i = 0; i != tag.size(); ++i) {
+                                diff |= static_cast<std::uint8_t>(tag[i] ^ expected_tag[i]);
+                            }
+                            return diff == 0;
+                        }
+
+                    private:
+                        chacha20poly1305_keystream keystream;
+                        chacha20poly1305_authenticator authenticator;
+                    };
+                }    // namespace detail
+
+                typedef detail::chacha20poly1305_stream<true> chacha20poly1305_encryptor;
+                typedef detail::chacha20poly1305_stream<false> chacha20poly1305_decryptor;
+
                 class chacha20poly1305 {
                 public:
                     typedef stream::chacha20 stream_type;
@@ -51,36 +364,46 @@ namespace nil {
                     typedef mac::poly1305::key_type poly1305_key_type;
                     typedef mac::poly1305::digest_type tag_type;
 
+                    typedef chacha20poly1305_encryptor encryptor_type;
+                    typedef chacha20poly1305_decryptor decryptor_type;
+
                     constexpr static const std::size_t key_size = stream_type::key_bits / CHAR_BIT;
                     constexpr static const std::size_t nonce_size = stream_type::iv_bits / CHAR_BIT;
                     constexpr static const std::size_t tag_size = mac::poly1305::digest_octets;
 
-                    static poly1305_key_type poly1305_key_gen(const key_type &key, const nonce_type &nonce) {
-                        std::array<std::uint8_t, stream_type::block_size> zeros = {0};
-                        std::array<std::uint8_t, stream_type::block_size> block = {0};
+                    /*!
+                     * @brief A message sealed in place by seal_batch: `data` holds the plaintext on input and the
+                     * ciphertext on output, `tag` receives the authentication tag.
+                     */
+                    struct packet {
+                        nonce_type nonce;
+                        std::span<const std::uint8_t> aad;
+                        std::span<std::uint8_t> data;
+                        tag_type tag;
+                    };
 
-                        stream::chacha20_cipher cipher(key, nonce, 0);
-                        cipher.process(zeros.begin(), zeros.end(), block.begin());
+                    static poly1305_key_type poly1305_key_gen(const key_type &key, const nonce_type &nonce) {
+                        detail::chacha20poly1305_keystream::key_schedule_type schedule;
+                        detail::chacha20poly1305_keystream::schedule_key(schedule, key);
 
-                        poly1305_key_type one_time_key = {0};
-                        std::copy(block.begin(), block.begin() + one_time_key.size(), one_time_key.begin());
-                        return one_time_key;
+                        detail::chacha20poly1305_keystream keystream;
+                        keystream.init(schedule, nonce);
+                        return keystream.poly1305_key();
                     }
 
                     template<typename PlaintextIterator, typename AadIterator, typename OutputIterator>
                     static tag_type encrypt(PlaintextIterator plaintext_first, PlaintextIterator plaintext_last,
                                             AadIterator aad_first, AadIterator aad_last, const key_type &key,
                                             const nonce_type &nonce, OutputIterator ciphertext_out) {
-                        const std::vector<std::uint8_t> plaintext = to_byte_vector(plaintext_first, plaintext_last);
-                        const std::vector<std::uint8_t> aad = to_byte_vector(aad_first, aad_last);
-                        ensure_plaintext_size(plaintext.size());
-
-                        std::vector<std::uint8_t> ciphertext(plaintext.size());
-                        stream::chacha20_cipher cipher(key, nonce, 1);
-                        cipher.process(plaintext.begin(), plaintext.end(), ciphertext.begin());
-
-                        std::copy(ciphertext.begin(), ciphertext.end(), ciphertext_out);
-                        return compute_tag(aad, ciphertext, key, nonce);
+                        encryptor_type encryptor(key, nonce);
+                        encryptor.update_aad(aad_first, aad_last);
+                        detail::transform_chunks<detail::chacha20poly1305_keystream::chunk_size>(
+                            plaintext_first, plaintext_last, ciphertext_out,
+                            [&encryptor](const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                                encryptor.update(std::span<const std::uint8_t>(in, length),
+                                                 std::span<std::uint8_t>(out, length));
+                            });
+                        return encryptor.finalize();
                     }
 
                     template<typename PlaintextRange, typename AadRange, typename OutputIterator>
@@ -90,24 +413,50 @@ namespace nil {
                                        nonce, ciphertext_out);
                     }
 
+                    /*!
+                     * @brief Verifies the tag and only then decrypts, nothing is written for a forged message.
+                     * Multi-pass ciphertext is read twice in place, single-pass input is buffered first.
+                     */
                     template<typename CiphertextIterator, typename AadIterator, typename OutputIterator>
                     static bool decrypt(CiphertextIterator ciphertext_first, CiphertextIterator ciphertext_last,
                                         AadIterator aad_first, AadIterator aad_last, const tag_type &tag,
                                         const key_type &key, const nonce_type &nonce, OutputIterator plaintext_out) {
-                        const std::vector<std::uint8_t> ciphertext = to_byte_vector(ciphertext_first, ciphertext_last);
-                        const std::vector<std::uint8_t> aad = to_byte_vector(aad_first, aad_last);
-                        ensure_plaintext_size(ciphertext.size());
+                        if constexpr (!std::forward_iterator<CiphertextIterator>) {
+                            const std::vector<std::uint8_t> ciphertext = to_byte_vector(ciphertext_first,
+                                                                                        ciphertext_last);
+                            return decrypt(ciphertext.begin(), ciphertext.end(), aad_first, aad_last, tag, key, nonce,
+                                           plaintext_out);
+                        } else {
+                            detail::chacha20poly1305_keystream::key_schedule_type schedule;
+                            detail::chacha20poly1305_keystream::schedule_key(schedule, key);
 
-                        const tag_type expected_tag = compute_tag(aad, ciphertext, key, nonce);
-                        if (!constant_time_equal(expected_tag, tag)) {
-                            return false;
-                        }
+                            detail::chacha20poly1305_keystream keystream;
+                            keystream.init(schedule, nonce);
+
+                            detail::chacha20poly1305_authenticator authenticator;
+                            authenticator.init(keystream.poly1305_key());
+                            detail::for_each_chunk<detail::chacha20poly1305_keystream::chunk_size>(
+                                aad_first, aad_last, [&authenticator](const std::uint8_t *data, std::size_t length) {
+                                    authenticator.update_aad(data, length);
+                                });
+                            detail::for_each_chunk<detail::chacha20poly1305_keystream::chunk_size>(
+                                ciphertext_first, ciphertext_last,
+                                [&authenticator](const std::uint8_t *data, std::size_t length) {
+                                    ensure_plaintext_size(authenticator.payload_size(), length);
+                                    authenticator.update_ciphertext(data, length);
+                                });
 
-                        std::vector<std::uint8_t> plaintext(ciphertext.size());
-                        stream::chacha20_cipher cipher(key, nonce, 1);
-                        cipher.process(ciphertext.begin(), ciphertext.end(), plaintext.begin());
-                        std::copy(plaintext.begin(), plaintext.end(), plaintext_out);
-                        return true;
+                            if (!constant_time_equal(authenticator.finalize(), tag)) {
+                                return false;
+                            }
+
+                            detail::transform_chunks<detail::chacha20poly1305_keystream::chunk_size>(
+                                ciphertext_first, ciphertext_last, plaintext_out,
+                                [&keystream](const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                                    keystream.apply(in, out, length);
+                                });
+                            return true;
+                        }
                     }
 
                     template<typename CiphertextRange, typename AadRange, typename OutputIterator>
@@ -117,6 +466,23 @@ namespace nil {
                                        tag, key, nonce, plaintext_out);
                     }
 
+                    /*!
+                     * @brief Seals many messages under one key in place. The key is expanded once and every packet
+                     * is processed in a single pass without allocations, which dominates the cost for short packets.
+                     */
+                    static void seal_batch(std::span<packet> packets, const key_type &key) {
+                        detail::chacha20poly1305_keystream::key_schedule_type schedule;
+                        detail::chacha20poly1305_keystream::schedule_key(schedule, key);
+
+                        encryptor_type encryptor;
+                        for (packet &p : packets) {
+                            encryptor.init(schedule, p.nonce);
+                            encryptor.update_aad(p.aad);
+                            encryptor.update(p.data);
+                            p.tag = encryptor.finalize();
+                        }
+                    }
+
                     template<typename ByteRange>
                     static bool constant_time_equal(const ByteRange &lhs, const ByteRange &rhs) {
                         if (lhs.size() != rhs.size()) {
@@ -131,13 +497,8 @@ namespace nil {
                     }
 
                 private:
-                    static constexpr std::uint64_t max_plaintext_size() {
-                        return static_cast<std::uint64_t>(std::numeric_limits<std::uint32_t>::max()) *
-                               stream_type::block_size;
-                    }
-
-                    static void ensure_plaintext_size(std::size_t size) {
-                        if (size > max_plaintext_size()) {
+                    static void ensure_plaintext_size(std::uint64_t processed, std::size_t size) {
+                        if (size > detail::chacha20poly1305_max_payload_size() - processed) {
                             throw std::out_of_range("ChaCha20-Poly1305 plaintext is too large");
                         }
                     }
@@ -150,40 +511,6 @@ namespace nil {
                         }
                         return bytes;
                     }
-
-                    static void append_pad16(std::vector<std::uint8_t> &out, std::size_t size) {
-                        const std::size_t padding = size % 16 == 0 ? 0 : 16 - size % 16;
-                        out.insert(out.end(), padding, 0);
-                    }
-
-                    static void append_u64_le(std::vector<std::uint8_t> &out, std::uint64_t value) {
-                        for (std::size_t i = 0; i != 8; ++i) {
-                            out.push_back(static_cast<std::uint8_t>((value >> (8 * i)) & 0xff));
-                        }
-                    }
-
-                    static std::vector<std::uint8_t> mac_data(const std::vector<std::uint8_t> &aad,
-                                                              const std::vector<std::uint8_t> &ciphertext) {
-                        std::vector<std::uint8_t> data;
-                        data.reserve(aad.size() + ciphertext.size() + 32);
-
-                        data.insert(data.end(), aad.begin(), aad.end());
-                        append_pad16(data, aad.size());
-                        data.insert(data.end(), ciphertext.begin(), ciphertext.end());
-                        append_pad16(data, ciphertext.size());
-                        append_u64_le(data, static_cast<std::uint64_t>(aad.size()));
-                        append_u64_le(data, static_cast<std::uint64_t>(ciphertext.size()));
-                        return data;
-                    }
-
-                    static tag_type compute_tag(const std::vector<std::uint8_t> &aad,
-                                                const std::vector<std::uint8_t> &ciphertext, const key_type &key,
-                                                const nonce_type &nonce) {
-                        const poly1305_key_type one_time_key = poly1305_key_gen(key, nonce);
-                        const mac::mac_key<mac::poly1305> poly1305_key(one_time_key);
-                        const std::vector<std::uint8_t> data = mac_data(aad, ciphertext);
-                        return compute<mac::poly1305>(data, poly1305_key);
-                    }
                 };
             }    // namespace aead
         }    // namespace modes
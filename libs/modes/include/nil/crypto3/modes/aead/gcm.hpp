@@ -0,0 +1,436 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MODE_AEAD_GCM_HPP
+#define CRYPTO3_MODE_AEAD_GCM_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/mac/detail/ghash.hpp>
+
+#include <nil/crypto3/modes/ctr.hpp>
+#include <nil/crypto3/modes/detail/byte_chunks.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace modes {
+            namespace aead {
+                namespace detail {
+                    using modes::detail::byte_pointer;
+                    using modes::detail::for_each_chunk;
+                    using modes::detail::is_contiguous_byte_iterator;
+                    using modes::detail::transform_chunks;
+
+                    /*!
+                     * @brief Per-key GCM state (NIST SP 800-38D): the expanded cipher, the GHASH multiplier for
+                     * H = E_K(0^128) and the CTR keystream. Both are set up once per key, init() only derives the
+                     * pre-counter block J0 of the next message.
+                     *
+                     * The payload is processed in chunks of eight blocks: the chunk is encrypted by the pipelined
+                     * CTR keystream and hashed by the aggregated GHASH while it is still in L1.
+                     */
+                    template<typename BlockCipher>
+                    class gcm_context {
+                    public:
+                        typedef BlockCipher cipher_type;
+                        typedef typename cipher_type::key_type key_type;
+                        typedef typename cipher_type::block_type block_type;
+                        typedef std::array<std::uint8_t, 16> tag_type;
+                        typedef ctr<cipher_type, 32> keystream_type;
+
+                        constexpr static const std::size_t chunk_size = keystream_type::chunk_size;
+                        // SP 800-38D, section 5.2.1.1: len(P) <= 2^39 - 256 and len(A) <= 2^64 - 1 bits.
+                        constexpr static const std::uint64_t max_payload_size = (std::uint64_t(1) << 36) - 32;
+                        constexpr static const std::uint64_t max_aad_size = (std::uint64_t(1) << 61) - 1;
+
+                        static_assert(cipher_type::block_bits == 128, "GCM requires a 128-bit block cipher");
+                        static_assert(std::is_same<block_type, mac::detail::ghash::block_type>::value,
+                                      "GCM requires byte-oriented cipher blocks");
+
+                        explicit gcm_context(const key_type &key) :
+                            cipher(key), ghash(cipher.encrypt(mac::detail::ghash::zero_block())),
+                            j0(mac::detail::ghash::zero_block()), keystream(cipher, j0), aad_size(0), payload_size(0),
+                            aad_finished(false) {
+                        }
+
+                        // The keystream refers to the cipher member.
+                        gcm_context(const gcm_context &) = delete;
+                        gcm_context &operator=(const gcm_context &) = delete;
+
+                        /*!
+                         * @brief Starts a message. 96-bit IVs give J0 = IV || 0^31 || 1, other lengths are GHASHed
+                         * with their bit length as specified by SP 800-38D, section 7.1.
+                         */
+                        void init(const std::uint8_t *iv, std::size_t iv_size) {
+                            if (iv_size == 0) {
+                                throw std::invalid_argument("GCM IV must not be empty");
+                            }
+                            if (iv_size > max_aad_size) {
+                                throw std::length_error("GCM IV is too long");
+                            }
+
+                            if (iv_size == 12) {
+                                j0 = mac::detail::ghash::zero_block();
+                                std::copy(iv, iv + iv_size, j0.begin());
+                                j0[15] = 1;
+                            } else {
+                                ghash.reset();
+                                ghash.update(iv, iv_size);
+                                ghash.pad();
+                                ghash.update_lengths(0, static_cast<std::uint64_t>(iv_size) * CHAR_BIT);
+                                j0 = ghash.digest();
+                            }
+
+                            // The payload starts at inc32(J0), J0 itself is kept for the tag.
+                            block_type counter = j0;
+                            for (std::size_t i = 16; i != 12;) {
+                                if (++counter[--i] != 0) {
+                                    break;
+                                }
+                            }
+                            keystream.init(counter);
+
+                            ghash.reset();
+                            aad_size = 0;
+                            payload_size = 0;
+                            aad_finished = false;
+                        }
+
+                        template<typename IvRange>
+                        void init(const IvRange &iv) {
+                            if constexpr (is_contiguous_byte_iterator<decltype(std::begin(iv))>()) {
+                                init(byte_pointer(std::begin(iv)),
+                                     static_cast<std::size_t>(std::distance(std::begin(iv), std::end(iv))));
+                            } else {
+                                std::vector<std::uint8_t> bytes;
+                                for (auto it = std::begin(iv); it != std::end(iv); ++it) {
+                                    bytes.push_back(static_cast<std::uint8_t>(*it));
+                                }
+                                init(bytes.data(), bytes.size());
+                            }
+                        }
+
+                        void update_aad(const std::uint8_t *data, std::size_t length) {
+                            if (aad_finished) {
+                                throw std::logic_error("GCM AAD must precede the payload");
+                            }
+                            if (length > max_aad_size - aad_size) {
+                                throw std::length_error("GCM AAD is too long");
+                            }
+                            ghash.update(data, length);
+                            aad_size += length;
+                        }
+
+                        void encrypt(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            begin_payload(length);
+                            while (length != 0) {
+                                const std::size_t processed = keystream.next_chunk(length);
+                                keystream.apply_chunk(in, out, processed);
+                                ghash.update(out, processed);
+                                in += processed;
+                                out += processed;
+                                length -= processed;
+                            }
+                        }
+
+                        void decrypt(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            begin_payload(length);
+                            while (length != 0) {
+                                // Hash before the keystream is applied, in-place output overwrites the input.
+                                const std::size_t processed = keystream.next_chunk(length);
+                                ghash.update(in, processed);
+                                keystream.apply_chunk(in, out, processed);
+                                in += processed;
+                                out += processed;
+                                length -= processed;
+                            }
+                        }
+
+                        /*!
+                         * @brief Hashes ciphertext without decrypting it, for callers that verify the tag first and
+                         * decrypt afterwards with apply_keystream().
+                         */
+                        void authenticate(const std::uint8_t *in, std::size_t length) {
+                            begin_payload(length);
+                            ghash.update(in, length);
+                        }
+
+                        void apply_keystream(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            keystream.process(in, out, length);
+                        }
+
+                        /*!
+                         * @brief T = E_K(J0) xor GHASH_H(A || pad || C || pad || len(A) || len(C)). Ends the message,
+                         * the next one starts with init().
+                         */
+                        tag_type tag() {
+                            aad_finished = true;
+                            ghash.pad();
+                            ghash.update_lengths(aad_size * CHAR_BIT, payload_size * CHAR_BIT);
+
+                            tag_type result = cipher.encrypt(j0);
+                            mac::detail::ghash::xor_block(result, ghash.digest());
+                            return result;
+                        }
+
+                    private:
+                        void begin_payload(std::size_t length) {
+                            if (length > max_payload_size - payload_size) {
+                                throw std::out_of_range("GCM plaintext is too large");
+                            }
+                            if (!aad_finished) {
+                                ghash.pad();
+                                aad_finished = true;
+                            }
+                            payload_size += length;
+                        }
+
+                        cipher_type cipher;
+                        mac::detail::ghash::state ghash;
+                        // pre-counter block
+                        block_type j0;
+                        keystream_type keystream;
+                        std::uint64_t aad_size;
+                        std::uint64_t payload_size;
+                        bool aad_finished;
+                    };
+
+                    /*!
+                     * @brief Single-pass streaming GCM. One object serves any number of messages under its key.
+                     * @tparam Encrypting Whether the payload is plaintext (true) or ciphertext (false)
+                     */
+                    template<typename BlockCipher, bool Encrypting>
+                    class gcm_stream {
+                        typedef gcm_context<BlockCipher> context_type;
+
+                    public:
+                        typedef typename context_type::key_type key_type;
+                        typedef typename context_type::tag_type tag_type;
+
+                        explicit gcm_stream(const key_type &key) : context(key) {
+                        }
+
+                        template<typename IvRange>
+                        gcm_stream(const key_type &key, const IvRange &iv) : context(key) {
+                            context.init(iv);
+                        }
+
+                        /*!
+                         * @brief Starts a message under the same key, reusing the key schedule and GHASH tables.
+                         */
+                        template<typename IvRange>
+                        void init(const IvRange &iv) {
+                            context.init(iv);
+                        }
+
+                        void update_aad(std::span<const std::uint8_t> aad) {
+                            context.update_aad(aad.data(), aad.size());
+                        }
+
+                        template<typename InputIterator>
+                        void update_aad(InputIterator first, InputIterator last) {
+                            for_each_chunk<context_type::chunk_size>(
+                                first, last, [this](const std::uint8_t *data, std::size_t length) {
+                                    context.update_aad(data, length);
+                                });
+                        }
+
+                        /*!
+                         * @brief Processes the next piece of the payload into `out`, which must have the same size as
+                         * `in`. The spans may be the same memory, but must not partially overlap.
+                         */
+                        void update(std::span<const std::uint8_t> in, std::span<std::uint8_t> out) {
+                            if (in.size() != out.size()) {
+                                throw std::invalid_argument("GCM output size must match input size");
+                            }
+                            if constexpr (Encrypting) {
+                                context.encrypt(in.data(), out.data(), in.size());
+                            } else {
+                                context.decrypt(in.data(), out.data(), in.size());
+                            }
+                        }
+
+                        void update(std::span<std::uint8_t> data) {
+                            update(data, data);
+                        }
+
+                        /*!
+                         * @brief Completes encryption.
+                         * @return Authentication tag of the AAD and the ciphertext
+                         */
+                        tag_type finalize()
+                            requires Encrypting
+                        {
+                            return context.tag();
+                        }
+
+                        /*!
+                         * @brief Completes decryption by checking the tag in constant time.
+                         * @note Plaintext has already been released by update(). Callers must discard it when this
+                         * returns false; the one-shot gcm::decrypt verifies before decrypting instead.
+                         */
+                        bool finalize(const tag_type &expected_tag)
+                            requires(!Encrypting)
+                        {
+                            const tag_type tag = context.tag();
+                            std::uint8_t diff = 0;
+                            for (std::size_t i = 0; i != tag.size(); ++i) {
+                                diff |= static_cast<std::uint8_t>(tag[i] ^ expected_tag[i]);
+                            }
+                            return diff == 0;
+                        }
+
+                    private:
+                        context_type context;
+                    };
+                }    // namespace detail
+
+                /*!
+                 * @brief Galois/Counter Mode (NIST SP 800-38D) with 128-bit tags.
+                 *
+                 * CTR encryption with inc32 counters and GHASH authentication are fused into one pass over the
+                 * payload. With AES-NI the keystream is produced eight blocks at a time and with PCLMULQDQ eight
+                 * GHASH blocks share a single reduction; elsewhere the portable cipher and a 4-bit table GHASH are
+                 * used. The caller is responsible for never reusing an IV under the same key.
+                 *
+                 * @tparam BlockCipher 128-bit block cipher with byte-oriented block and key types, normally AES.
+                 * @ingroup modes
+                 */
+                template<typename BlockCipher>
+                class gcm {
+                    typedef detail::gcm_context<BlockCipher> context_type;
+
+                public:
+                    typedef BlockCipher cipher_type;
+                    typedef typename cipher_type::key_type key_type;
+                    typedef typename context_type::tag_type tag_type;
+
+                    typedef detail::gcm_stream<BlockCipher, true> encryptor_type;
+                    typedef detail::gcm_stream<BlockCipher, false> decryptor_type;
+
+                    constexpr static const std::size_t key_size = cipher_type::key_bits / CHAR_BIT;
+                    constexpr static const std::size_t iv_size = 12;
+                    constexpr static const std::size_t tag_size = 16;
+
+                    template<typename PlaintextIterator, typename AadIterator, typename IvRange,
+                             typename OutputIterator>
+                    static tag_type encrypt(PlaintextIterator plaintext_first, PlaintextIterator plaintext_last,
+                                            AadIterator aad_first, AadIterator aad_last, const key_type &key,
+                                            const IvRange &iv, OutputIterator ciphertext_out) {
+                        encryptor_type encryptor(key, iv);
+                        encryptor.update_aad(aad_first, aad_last);
+                        detail::transform_chunks<context_type::chunk_size>(
+                            plaintext_first, plaintext_last, ciphertext_out,
+                            [&encryptor](const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                                encryptor.update(std::span<const std::uint8_t>(in, length),
+                                                 std::span<std::uint8_t>(out, length));
+                            });
+                        return encryptor.finalize();
+                    }
+
+                    template<typename PlaintextRange, typename AadRange, typename IvRange, typename OutputIterator>
+                    static tag_type encrypt(const PlaintextRange &plaintext, const AadRange &aad, const key_type &key,
+                                            const IvRange &iv, OutputIterator ciphertext_out) {
+                        return encrypt(std::begin(plaintext), std::end(plaintext), std::begin(aad), std::end(aad), key,
+                                       iv, ciphertext_out);
+                    }
+
+                    /*!
+                     * @brief Verifies the tag and only then decrypts, nothing is written for a forged message.
+                     * Multi-pass ciphertext is read twice in place, single-pass input is buffered first.
+                     */
+                    template<typename CiphertextIterator, typename AadIterator, typename IvRange,
+                             typename OutputIterator>
+                    static bool decrypt(CiphertextIterator ciphertext_first, CiphertextIterator ciphertext_last,
+                                        AadIterator aad_first, AadIterator aad_last, const tag_type &tag,
+                                        const key_type &key, const IvRange &iv, OutputIterator plaintext_out) {
+                        if constexpr (!std::forward_iterator<CiphertextIterator>) {
+                            std::vector<std::uint8_t> ciphertext;
+                            for (; ciphertext_first != ciphertext_last; ++ciphertext_first) {
+                                ciphertext.push_back(static_cast<std::uint8_t>(*ciphertext_first));
+                            }
+                            return decrypt(ciphertext.begin(), ciphertext.end(), aad_first, aad_last, tag, key, iv,
+                                           plaintext_out);
+                        } else {
+                            context_type context(key);
+                            context.init(iv);
+                            detail::for_each_chunk<context_type::chunk_size>(
+                                aad_first, aad_last, [&context](const std::uint8_t *data, std::size_t length) {
+                                    context.update_aad(data, length);
+                                });
+                            detail::for_each_chunk<context_type::chunk_size>(
+                                ciphertext_first, ciphertext_last,
+                                [&context](const std::uint8_t *data, std::size_t length) {
+                                    context.authenticate(data, length);
+                                });
+
+                            if (!constant_time_equal(context.tag(), tag)) {
+                                return false;
+                            }
+
+                            detail::transform_chunks<context_type::chunk_size>(
+                                ciphertext_first, ciphertext_last, plaintext_out,
+                                [&context](const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                                    context.apply_keystream(in, out, length);
+                                });
+                            return true;
+                        }
+                    }
+
+                    template<typename CiphertextRange, typename AadRange, typename IvRange, typename OutputIterator>
+                    static bool decrypt(const CiphertextRange &ciphertext, const AadRange &aad, const tag_type &tag,
+                                        const key_type &key, const IvRange &iv, OutputIterator plaintext_out) {
+                        return decrypt(std::begin(ciphertext), std::end(ciphertext), std::begin(aad), std::end(aad),
+                                       tag, key, iv, plaintext_out);
+                    }
+
+                    template<typename ByteRange>
+                    static bool constant_time_equal(const ByteRange &lhs, const ByteRange &rhs) {
+                        if (lhs.size() != rhs.size()) {
+                            return false;
+                        }
+
+                        std::uint8_t diff = 0;
+                        for (std::size_t i = 0; i != lhs.size(); ++i) {
+                            diff |= static_cast<std::uint8_t>(lhs[i] ^ rhs[i]);
+                        }
+                        return diff == 0;
+                    }
+                };
+            }    // namespace aead
+        }    // namespace modes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MODE_AEAD_GCM_HPP
@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MODES_CTR_HPP
+#define CRYPTO3_MODES_CTR_HPP
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <nil/crypto3/modes/detail/byte_chunks.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace modes {
+            /*!
+             * @brief Counter mode (NIST SP 800-38A, section 6.5) over a 128-bit block cipher.
+             *
+             * The low CounterBits of the counter block are incremented as a big-endian integer modulo 2^CounterBits,
+             * the remaining bits stay fixed: CounterBits = 128 is plain SP 800-38A CTR, CounterBits = 32 is the inc32
+             * function used by GCM. The keystream is generated eight blocks at a time, through
+             * BlockCipher::encrypt_blocks when the cipher provides it, so hardware implementations keep all of them
+             * in flight.
+             *
+             * The object refers to the cipher, which must outlive it. The caller is responsible for never reusing a
+             * counter value under the same key.
+             *
+             * @tparam BlockCipher 128-bit block cipher with byte-oriented block type.
+             * @tparam CounterBits number of low-order counter block bits that are incremented.
+             * @ingroup modes
+             */
+            template<typename BlockCipher, std::size_t CounterBits = BlockCipher::block_bits>
+            class ctr {
+            public:
+                typedef BlockCipher cipher_type;
+                typedef typename cipher_type::block_type block_type;
+
+                constexpr static const std::size_t block_size = cipher_type::block_bits / CHAR_BIT;
+                constexpr static const std::size_t chunk_blocks = 8;
+                constexpr static const std::size_t chunk_size = block_size * chunk_blocks;
+
+                static_assert(cipher_type::block_bits == 128, "CTR mode requires a 128-bit block cipher");
+                static_assert(std::is_same<typename block_type::value_type, std::uint8_t>::value,
+                              "CTR mode requires byte-oriented cipher blocks");
+                static_assert(CounterBits % CHAR_BIT == 0 && CounterBits > 0 && CounterBits <= cipher_type::block_bits,
+                              "CTR counter must be a whole number of bytes within the block");
+                static_assert(sizeof(std::array<block_type, chunk_blocks>) == chunk_size,
+                              "cipher blocks must be tightly packed");
+
+                ctr(const cipher_type &cipher, const block_type &initial_counter) : cipher(cipher) {
+                    init(initial_counter);
+                }
+
+                /*!
+                 * @brief Restarts the keystream at the counter block, without touching the cipher key schedule.
+                 */
+                void init(const block_type &initial_counter) {
+                    counter = initial_counter;
+                    offset = 0;
+                    size = 0;
+                }
+
+                /*!
+                 * @brief Makes keystream available for up to `length` bytes and returns how many bytes the next
+                 * apply_chunk will process. Short requests generate only the blocks they need.
+                 */
+                std::size_t next_chunk(std::size_t length) {
+                    if (offset == size) {
+                        refill((std::min(length, chunk_size) + block_size - 1) / block_size);
+                    }
+                    return std::min(length, size - offset);
+                }
+
+                /*!
+                 * @brief XORs `length` bytes, at most what next_chunk returned, with the buffered keystream.
+                 */
+                void apply_chunk(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                    const std::uint8_t *stream = reinterpret_cast<const std::uint8_t *>(keystream.data()) + offset;
+                    for (std::size_t i = 0; i != length; ++i) {
+                        out[i] = in[i] ^ stream[i];
+                    }
+                    offset += length;
+                }
+
+                /*!
+                 * @brief Encrypts or decrypts `length` bytes. `in` and `out` may be the same memory, but must not
+                 * partially overlap.
+                 */
+                void process(const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                    while (length != 0) {
+                        const std::size_t taken = next_chunk(length);
+                        apply_chunk(in, out, taken);
+                        in += taken;
+                        out += taken;
+                        length -= taken;
+                    }
+                }
+
+                template<typename InputIterator, typename OutputIterator>
+                OutputIterator process(InputIterator first, InputIterator last, OutputIterator out) {
+                    return detail::transform_chunks<chunk_size>(
+                        first, last, out, [this](const std::uint8_t *in, std::uint8_t *out, std::size_t length) {
+                            process(in, out, length);
+                        });
+                }
+
+                template<typename InputRange, typename OutputIterator>
+                OutputIterator process(const InputRange &range, OutputIterator out) {
+                    return process(std::begin(range), std::end(range), out);
+                }
+
+            private:
+                void increment_counter() {
+                    for (std::size_t i = block_size; i != block_size - CounterBits / CHAR_BIT;) {
+                        if (++counter[--i] != 0) {
+                            break;
+                        }
+                    }
+                }
+
+                void refill(std::size_t blocks) {
+                    std::array<block_type, chunk_blocks> counters;
+                    for (std::size_t i = 0; i != blocks; ++i) {
+                        counters[i] = counter;
+                        increment_counter();
+                    }
+
+                    if constexpr (requires { cipher.encrypt_blocks(counters.data(), keystream.data(), blocks); }) {
+                        cipher.encrypt_blocks(counters.data(), keystream.data(), blocks);
+                    } else {
+                        for (std::size_t i = 0; i != blocks; ++i) {
+                            keystream[i] = cipher.encrypt(counters[i]);
+                        }
+                    }
+
+                    offset = 0;
+                    size = blocks * block_size;
+                }
+
+                const cipher_type &cipher;
+                block_type counter;
+                std::array<block_type, chunk_blocks> keystream;
+                std::size_t offset;
+                std::size_t size;
+            };
+        }    // namespace modes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MODES_CTR_HPP
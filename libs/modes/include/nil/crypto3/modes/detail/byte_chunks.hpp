@@ -0,0 +1,112 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MODES_DETAIL_BYTE_CHUNKS_HPP
+#define CRYPTO3_MODES_DETAIL_BYTE_CHUNKS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+
+namespace nil {
+    namespace crypto3 {
+        namespace modes {
+            namespace detail {
+                template<typename Iterator>
+                constexpr bool is_contiguous_byte_iterator() {
+                    if constexpr (std::contiguous_iterator<Iterator>) {
+                        return sizeof(std::iter_value_t<Iterator>) == 1;
+                    } else {
+                        return false;
+                    }
+                }
+
+                template<typename Iterator>
+                const std::uint8_t *byte_pointer(Iterator it) {
+                    return reinterpret_cast<const std::uint8_t *>(std::to_address(it));
+                }
+
+                template<typename Iterator>
+                std::uint8_t *mutable_byte_pointer(Iterator it) {
+                    return reinterpret_cast<std::uint8_t *>(std::to_address(it));
+                }
+
+                /*!
+                 * @brief Calls `f(data, length)` on contiguous pieces of the byte range, staging non-contiguous input
+                 * through a chunk-sized buffer.
+                 */
+                template<std::size_t ChunkSize, typename InputIterator, typename F>
+                void for_each_chunk(InputIterator first, InputIterator last, F &&f) {
+                    if constexpr (is_contiguous_byte_iterator<InputIterator>()) {
+                        f(byte_pointer(first), static_cast<std::size_t>(std::distance(first, last)));
+                    } else {
+                        std::array<std::uint8_t, ChunkSize> chunk;
+                        while (first != last) {
+                            std::size_t length = 0;
+                            for (; first != last && length != chunk.size(); ++first, ++length) {
+                                chunk[length] = static_cast<std::uint8_t>(*first);
+                            }
+                            f(chunk.data(), length);
+                        }
+                    }
+                }
+
+                /*!
+                 * @brief Calls `f(in, out, length)` on pieces of the byte range. Contiguous input and output are passed
+                 * through directly, anything else is staged through a chunk-sized buffer processed in place.
+                 */
+                template<std::size_t ChunkSize, typename InputIterator, typename OutputIterator, typename F>
+                OutputIterator transform_chunks(InputIterator first, InputIterator last, OutputIterator out, F &&f) {
+                    if constexpr (is_contiguous_byte_iterator<InputIterator>() &&
+                                  is_contiguous_byte_iterator<OutputIterator>()) {
+                        const std::size_t length = static_cast<std::size_t>(std::distance(first, last));
+                        f(byte_pointer(first), mutable_byte_pointer(out), length);
+                        return out + length;
+                    } else {
+                        for_each_chunk<ChunkSize>(first, last, [&](const std::uint8_t *data, std::size_t length) {
+                            // Contiguous input arrives in one piece, the output still goes through the chunk.
+                            std::array<std::uint8_t, ChunkSize> chunk;
+                            while (length != 0) {
+                                const std::size_t taken = std::min(length, chunk.size());
+                                std::memcpy(chunk.data(), data, taken);
+                                f(chunk.data(), chunk.data(), taken);
+                                out = std::copy(chunk.begin(), chunk.begin() + taken, out);
+                                data += taken;
+                                length -= taken;
+                            }
+                        });
+                        return out;
+                    }
+                }
+            }    // namespace detail
+        }    // namespace modes
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MODES_DETAIL_BYTE_CHUNKS_HPP
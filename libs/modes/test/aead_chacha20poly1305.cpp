@@ -34,6 +34,8 @@
 #include <array>
 #include <cctype>
 #include <cstdint>
+#include <list>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -188,6 +190,36 @@ namespace {
     aead_type::tag_type rfc8439_decryption_tag() {
         return array_from_hex<aead_type::tag_size>("eead9d67890cbb22392336fea1851f38");
     }
+
+    std::vector<std::uint8_t> patterned_bytes(std::size_t size, std::uint8_t seed) {
+        std::vector<std::uint8_t> out(size);
+        for (std::size_t i = 0; i != size; ++i) {
+            out[i] = static_cast<std::uint8_t>(i * 29 + seed);
+        }
+        return out;
+    }
+
+    // Two-pass construction straight from RFC 8439, section 2.8, used as an independent reference.
+    aead_type::tag_type reference_seal(const std::vector<std::uint8_t> &plaintext, const std::vector<std::uint8_t> &aad,
+                                       const aead_type::key_type &key, const aead_type::nonce_type &nonce,
+                                       std::vector<std::uint8_t> &ciphertext) {
+        ciphertext.resize(plaintext.size());
+        stream::chacha20_cipher cipher(key, nonce, 1);
+        cipher.process(plaintext.begin(), plaintext.end(), ciphertext.begin());
+
+        std::vector<std::uint8_t> mac_data(aad.begin(), aad.end());
+        mac_data.resize((mac_data.size() + 15) / 16 * 16, 0);
+        mac_data.insert(mac_data.end(), ciphertext.begin(), ciphertext.end());
+        mac_data.resize((mac_data.size() + 15) / 16 * 16, 0);
+        for (std::uint64_t length : {std::uint64_t(aad.size()), std::uint64_t(ciphertext.size())}) {
+            for (std::size_t i = 0; i != 8; ++i) {
+                mac_data.push_back(static_cast<std::uint8_t>(length >> (8 * i)));
+            }
+        }
+
+        const mac::mac_key<mac::poly1305> poly1305_key(aead_type::poly1305_key_gen(key, nonce));
+        return compute<mac::poly1305>(mac_data, poly1305_key);
+    }
 }    // namespace
 
 BOOST_AUTO_TEST_SUITE(chacha20poly1305_mode_test_suite)
@@ -278,4 +310,132 @@ BOOST_AUTO_TEST_CASE(encrypt_supports_in_place_operation) {
     BOOST_TEST(std::equal(buffer.begin(), buffer.end(), expected_plaintext.begin()));
 }
 
+BOOST_AUTO_TEST_CASE(streaming_matches_reference_across_chunk_boundaries) {
+    const aead_type::key_type key = rfc8439_aead_key();
+    const aead_type::nonce_type nonce = rfc8439_aead_nonce();
+
+    for (std::size_t size : {0, 1, 63, 64, 65, 511, 512, 513, 1100, 4096 + 77}) {
+        const std::vector<std::uint8_t> plaintext = patterned_bytes(size, 3);
+        const std::vector<std::uint8_t> aad = patterned_bytes(size % 37, 11);
+
+        std::vector<std::uint8_t> expected_ciphertext;
+        const aead_type::tag_type expected_tag = reference_seal(plaintext, aad, key, nonce, expected_ciphertext);
+
+        for (std::size_t step : {std::size_t(1), std::size_t(17), std::size_t(512), std::size_t(100000)}) {
+            std::vector<std::uint8_t> buffer = plaintext;
+            aead_type::encryptor_type encryptor(key, nonce);
+            encryptor.update_aad(std::span<const std::uint8_t>(aad.data(), aad.size() / 2));
+            encryptor.update_aad(aad.begin() + aad.size() / 2, aad.end());
+            for (std::size_t offset = 0; offset < size; offset += step) {
+                encryptor.update(std::span<std::uint8_t>(buffer).subspan(offset, std::min(step, size - offset)));
+            }
+            const aead_type::tag_type tag = encryptor.finalize();
+
+            BOOST_TEST(buffer == expected_ciphertext);
+            BOOST_TEST(std::equal(tag.begin(), tag.end(), expected_tag.begin()));
+
+            std::vector<std::uint8_t> decrypted(size);
+            aead_type::decryptor_type decryptor(key, nonce);
+            decryptor.update_aad(aad);
+            for (std::size_t offset = 0; offset < size; offset += step) {
+                const std::size_t length = std::min(step, size - offset);
+                decryptor.update(std::span<const std::uint8_t>(buffer).subspan(offset, length),
+                                 std::span<std::uint8_t>(decrypted).subspan(offset, length));
+            }
+            BOOST_TEST(decryptor.finalize(expected_tag));
+            BOOST_TEST(decrypted == plaintext);
+        }
+
+        const std::list<std::uint8_t> listed_plaintext(plaintext.begin(), plaintext.end());
+        const std::list<std::uint8_t> listed_aad(aad.begin(), aad.end());
+        std::list<std::uint8_t> listed_ciphertext;
+        const aead_type::tag_type listed_tag =
+            aead_type::encrypt(listed_plaintext, listed_aad, key, nonce, std::back_inserter(listed_ciphertext));
+        BOOST_TEST(std::equal(listed_ciphertext.begin(), listed_ciphertext.end(), expected_ciphertext.begin(),
+                              expected_ciphertext.end()));
+        BOOST_TEST(std::equal(listed_tag.begin(), listed_tag.end(), expected_tag.begin()));
+
+        std::vector<std::uint8_t> listed_decrypted(size);
+        BOOST_TEST(aead_type::decrypt(listed_ciphertext, listed_aad, expected_tag, key, nonce,
+                                      listed_decrypted.begin()));
+        BOOST_TEST(listed_decrypted == plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(contiguous_input_into_back_inserter_matches_reference) {
+    const aead_type::key_type key = rfc8439_aead_key();
+    const aead_type::nonce_type nonce = rfc8439_aead_nonce();
+
+    // Contiguous input arrives as one piece while the output is staged through the chunk buffer.
+    for (std::size_t size : {0, 1, 511, 512, 513, 1024, 4096 + 77}) {
+        const std::vector<std::uint8_t> plaintext = patterned_bytes(size, 5);
+        const std::vector<std::uint8_t> aad = patterned_bytes(size % 29, 13);
+
+        std::vector<std::uint8_t> expected_ciphertext;
+        const aead_type::tag_type expected_tag = reference_seal(plaintext, aad, key, nonce, expected_ciphertext);
+
+        std::vector<std::uint8_t> ciphertext;
+        const aead_type::tag_type tag =
+            aead_type::encrypt(plaintext, aad, key, nonce, std::back_inserter(ciphertext));
+        BOOST_TEST(ciphertext == expected_ciphertext);
+        BOOST_TEST(std::equal(tag.begin(), tag.end(), expected_tag.begin()));
+
+        std::vector<std::uint8_t> decrypted;
+        BOOST_TEST(aead_type::decrypt(ciphertext, aad, tag, key, nonce, std::back_inserter(decrypted)));
+        BOOST_TEST(decrypted == plaintext);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(streaming_decrypt_rejects_modified_ciphertext) {
+    std::vector<std::uint8_t> ciphertext = rfc8439_aead_ciphertext();
+    const std::vector<std::uint8_t> aad = rfc8439_aead_aad();
+    ciphertext[7] ^= 0x40;
+
+    aead_type::decryptor_type decryptor(rfc8439_aead_key(), rfc8439_aead_nonce());
+    decryptor.update_aad(aad);
+    decryptor.update(ciphertext);
+    BOOST_TEST(!decryptor.finalize(rfc8439_aead_tag()));
+}
+
+BOOST_AUTO_TEST_CASE(streaming_rejects_aad_after_payload) {
+    const std::vector<std::uint8_t> aad = rfc8439_aead_aad();
+    std::vector<std::uint8_t> buffer = rfc8439_aead_plaintext();
+
+    aead_type::encryptor_type encryptor(rfc8439_aead_key(), rfc8439_aead_nonce());
+    encryptor.update(buffer);
+    BOOST_CHECK_THROW(encryptor.update_aad(aad), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(seal_batch_matches_single_messages) {
+    const aead_type::key_type key = rfc8439_aead_key();
+
+    std::vector<std::vector<std::uint8_t>> payloads;
+    std::vector<std::vector<std::uint8_t>> aads;
+    std::vector<aead_type::packet> packets;
+    for (std::size_t i = 0; i != 16; ++i) {
+        payloads.push_back(patterned_bytes(i * 13, static_cast<std::uint8_t>(i)));
+        aads.push_back(patterned_bytes(i % 5, static_cast<std::uint8_t>(i + 100)));
+    }
+    for (std::size_t i = 0; i != payloads.size(); ++i) {
+        aead_type::packet p;
+        p.nonce = rfc8439_aead_nonce();
+        p.nonce[0] = static_cast<std::uint8_t>(i);
+        p.aad = aads[i];
+        p.data = payloads[i];
+        packets.push_back(p);
+    }
+
+    const std::vector<std::vector<std::uint8_t>> plaintexts = payloads;
+    aead_type::seal_batch(packets, key);
+
+    for (std::size_t i = 0; i != packets.size(); ++i) {
+        std::vector<std::uint8_t> expected_ciphertext;
+        const aead_type::tag_type expected_tag =
+            reference_seal(plaintexts[i], aads[i], key, packets[i].nonce, expected_ciphertext);
+
+        BOOST_TEST(payloads[i] == expected_ciphertext);
+        BOOST_TEST(std::equal(packets[i].tag.begin(), packets[i].tag.end(), expected_tag.begin()));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,325 @@
+//---------------------------------------------------------------------------//
+//
+// Copyright (c) 2018-2020 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE aead_gcm_test
+
+#include <nil/crypto3/block/aes.hpp>
+
+#include <nil/crypto3/mac/detail/ghash.hpp>
+
+#include <nil/crypto3/modes/aead/gcm.hpp>
+#include <nil/crypto3/modes/ctr.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace nil::crypto3;
+
+namespace {
+    std::vector<std::uint8_t> hex_to_bytes(const std::string &hex) {
+        std::vector<std::uint8_t> out;
+        int high_nibble = -1;
+
+        for (char c : hex) {
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                continue;
+            }
+
+            int value = -1;
+            if (c >= '0' && c <= '9') {
+                value = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                value = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                value = c - 'A' + 10;
+            } else {
+                throw std::invalid_argument("invalid hex character");
+            }
+
+            if (high_nibble < 0) {
+                high_nibble = value;
+            } else {
+                out.push_back(static_cast<std::uint8_t>((high_nibble << 4) | value));
+                high_nibble = -1;
+            }
+        }
+
+        if (high_nibble >= 0) {
+            throw std::invalid_argument("odd hex length");
+        }
+        return out;
+    }
+
+    template<std::size_t Size>
+    std::array<std::uint8_t, Size> array_from_hex(const std::string &hex) {
+        const std::vector<std::uint8_t> bytes = hex_to_bytes(hex);
+        if (bytes.size() != Size) {
+            throw std::invalid_argument("hex vector has unexpected size");
+        }
+
+        std::array<std::uint8_t, Size> out = {0};
+        std::copy(bytes.begin(), bytes.end(), out.begin());
+        return out;
+    }
+
+    std::vector<std::uint8_t> patterned_bytes(std::size_t size, std::uint8_t seed) {
+        std::vector<std::uint8_t> out(size);
+        for (std::size_t i = 0; i != size; ++i) {
+            out[i] = static_cast<std::uint8_t>(i * 29 + seed);
+        }
+        return out;
+    }
+
+    // Test cases from the GCM specification (McGrew, Viega), also used by NIST CAVP.
+    struct gcm_vector {
+        std::string key;
+        std::string iv;
+        std::string plaintext;
+        std::string aad;
+        std::string ciphertext;
+        std::string tag;
+    };
+
+    const std::string gcm_spec_key = "feffe9928665731c6d6a8f9467308308";
+    const std::string gcm_spec_plaintext =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+        "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255";
+    const std::string gcm_spec_plaintext_60 =
+        "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+        "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+    const std::string gcm_spec_aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+
+    const std::vector<gcm_vector> aes128_vectors = {
+        {"00000000000000000000000000000000", "000000000000000000000000", "", "", "",
+         "58e2fccefa7e3061367f1d57a4e7455a"},
+        {"00000000000000000000000000000000", "000000000000000000000000", "00000000000000000000000000000000", "",
+         "0388dace60b6a392f328c2b971b2fe78", "ab6e47d42cec13bdf53a67b21257bddf"},
+        {gcm_spec_key, "cafebabefacedbaddecaf888", gcm_spec_plaintext, "",
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+         "4d5c2af327cd64a62cf35abd2ba6fab4"},
+        {gcm_spec_key, "cafebabefacedbaddecaf888", gcm_spec_plaintext_60, gcm_spec_aad,
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+         "5bc94fbc3221a5db94fae95ae7121a47"},
+        {gcm_spec_key, "cafebabefacedbad", gcm_spec_plaintext_60, gcm_spec_aad,
+         "61353b4c2806934a777ff51fa22a4755699b2a714fcdc6f83766e5f97b6c7423"
+         "73806900e49f24b22b097544d4896b424989b5e1ebac0f07c23f4598",
+         "3612d2e79e3b0785561be14aaca2fccb"},
+        {gcm_spec_key,
+         "9313225df88406e555909c5aff5269aa6a7a9538534f7da1e4c303d2a318a728"
+         "c3c0c95156809539fcf0e2429a6b525416aedbf5a0de6a57a637b39b",
+         gcm_spec_plaintext_60, gcm_spec_aad,
+         "8ce24998625615b603a033aca13fb894be9112a5c3a211a8ba262a3cca7e2ca7"
+         "01e4a9a4fba43c90ccdcb281d48c7c6fd62875d2aca417034c34aee5",
+         "619cc5aefffe0bfa462af43c1699d050"},
+    };
+
+    const std::vector<gcm_vector> aes256_vectors = {
+        {"0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000", "", "", "",
+         "530f8afbc74536b9a963b4f1c4cb738b"},
+        {"0000000000000000000000000000000000000000000000000000000000000000", "000000000000000000000000",
+         "00000000000000000000000000000000", "", "cea7403d4d606b6e074ec5d3baf39d18",
+         "d0d1c8a799996bf0265b98b5d48ab919"},
+        {gcm_spec_key + gcm_spec_key, "cafebabefacedbaddecaf888", gcm_spec_plaintext_60, gcm_spec_aad,
+         "522dc1f099567d07f47f37a32a84427d643a8cdcbfe5c0c97598a2bd2555d1aa"
+         "8cb08e48590dbb3da7b08b1056828838c5f61e6393ba7a0abcc9f662",
+         "76fc6ece0f4e1768cddf8853bb2d551b"},
+    };
+
+    template<typename Aead>
+    void check_vectors(const std::vector<gcm_vector> &vectors) {
+        for (const gcm_vector &v : vectors) {
+            const typename Aead::key_type key = array_from_hex<Aead::key_size>(v.key);
+            const std::vector<std::uint8_t> iv = hex_to_bytes(v.iv);
+            const std::vector<std::uint8_t> plaintext = hex_to_bytes(v.plaintext);
+            const std::vector<std::uint8_t> aad = hex_to_bytes(v.aad);
+            const std::vector<std::uint8_t> expected_ciphertext = hex_to_bytes(v.ciphertext);
+            const typename Aead::tag_type expected_tag = array_from_hex<Aead::tag_size>(v.tag);
+
+            std::vector<std::uint8_t> ciphertext;
+            const typename Aead::tag_type tag =
+                Aead::encrypt(plaintext, aad, key, iv, std::back_inserter(ciphertext));
+            BOOST_CHECK(ciphertext == expected_ciphertext);
+            BOOST_CHECK(tag == expected_tag);
+
+            std::vector<std::uint8_t> decrypted;
+            BOOST_CHECK(Aead::decrypt(ciphertext, aad, expected_tag, key, iv, std::back_inserter(decrypted)));
+            BOOST_CHECK(decrypted == plaintext);
+        }
+    }
+
+    typedef modes::aead::gcm<block::aes<128>> aes128_gcm;
+    typedef modes::aead::gcm<block::aes<256>> aes256_gcm;
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(aead_gcm_test_suite)
+
+BOOST_AUTO_TEST_CASE(aes128_gcm_spec_vectors) {
+    check_vectors<aes128_gcm>(aes128_vectors);
+}
+
+BOOST_AUTO_TEST_CASE(aes256_gcm_spec_vectors) {
+    check_vectors<aes256_gcm>(aes256_vectors);
+}
+
+BOOST_AUTO_TEST_CASE(gcm_streaming_matches_one_shot_for_any_split) {
+    const aes128_gcm::key_type key = array_from_hex<aes128_gcm::key_size>(gcm_spec_key);
+    const std::vector<std::uint8_t> iv = hex_to_bytes("cafebabefacedbaddecaf888");
+    const std::vector<std::uint8_t> aad = patterned_bytes(37, 3);
+    const std::vector<std::uint8_t> plaintext = patterned_bytes(4099, 11);
+
+    std::vector<std::uint8_t> expected;
+    const aes128_gcm::tag_type expected_tag =
+        aes128_gcm::encrypt(plaintext, aad, key, iv, std::back_inserter(expected));
+
+    aes128_gcm::encryptor_type encryptor(key);
+    aes128_gcm::decryptor_type decryptor(key);
+    for (std::size_t step : {1, 15, 16, 17, 127, 128, 129, 1000}) {
+        encryptor.init(iv);
+        decryptor.init(iv);
+        encryptor.update_aad(std::span<const std::uint8_t>(aad.data(), 5));
+        encryptor.update_aad(aad.begin() + 5, aad.end());
+        decryptor.update_aad(aad);
+
+        std::vector<std::uint8_t> ciphertext(plaintext.size());
+        std::vector<std::uint8_t> decrypted(plaintext.size());
+        for (std::size_t offset = 0; offset < plaintext.size(); offset += step) {
+            const std::size_t length = std::min(step, plaintext.size() - offset);
+            encryptor.update(std::span<const std::uint8_t>(plaintext.data() + offset, length),
+                             std::span<std::uint8_t>(ciphertext.data() + offset, length));
+            decryptor.update(std::span<const std::uint8_t>(ciphertext.data() + offset, length),
+                             std::span<std::uint8_t>(decrypted.data() + offset, length));
+        }
+
+        BOOST_CHECK(ciphertext == expected);
+        BOOST_CHECK(encryptor.finalize() == expected_tag);
+        BOOST_CHECK(decryptor.finalize(expected_tag));
+        BOOST_CHECK(decrypted == plaintext);
+    }
+
+    // Non-contiguous input goes through the staging path.
+    const std::list<std::uint8_t> listed(plaintext.begin(), plaintext.end());
+    std::vector<std::uint8_t> from_list;
+    BOOST_CHECK(aes128_gcm::encrypt(listed, aad, key, iv, std::back_inserter(from_list)) == expected_tag);
+    BOOST_CHECK(from_list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(gcm_rejects_forged_messages) {
+    const aes256_gcm::key_type key = array_from_hex<aes256_gcm::key_size>(gcm_spec_key + gcm_spec_key);
+    const std::vector<std::uint8_t> iv = hex_to_bytes("cafebabefacedbaddecaf888");
+    const std::vector<std::uint8_t> aad = hex_to_bytes(gcm_spec_aad);
+    const std::vector<std::uint8_t> plaintext = patterned_bytes(300, 7);
+
+    std::vector<std::uint8_t> ciphertext;
+    const aes256_gcm::tag_type tag = aes256_gcm::encrypt(plaintext, aad, key, iv, std::back_inserter(ciphertext));
+
+    std::vector<std::uint8_t> tampered = ciphertext;
+    tampered[200] ^= 0x01;
+    std::vector<std::uint8_t> out;
+    BOOST_CHECK(!aes256_gcm::decrypt(tampered, aad, tag, key, iv, std::back_inserter(out)));
+    BOOST_CHECK(out.empty());
+
+    aes256_gcm::tag_type bad_tag = tag;
+    bad_tag[15] ^= 0x80;
+    BOOST_CHECK(!aes256_gcm::decrypt(ciphertext, aad, bad_tag, key, iv, std::back_inserter(out)));
+    BOOST_CHECK(out.empty());
+
+    aes256_gcm::decryptor_type decryptor(key, iv);
+    decryptor.update_aad(aad);
+    std::vector<std::uint8_t> streamed(ciphertext.size());
+    decryptor.update(ciphertext, streamed);
+    BOOST_CHECK_THROW(decryptor.update_aad(aad), std::logic_error);
+    BOOST_CHECK(!decryptor.finalize(bad_tag));
+}
+
+BOOST_AUTO_TEST_CASE(ctr_sp800_38a_vectors) {
+    // NIST SP 800-38A, F.5.1 CTR-AES128.Encrypt
+    const block::aes<128> cipher(array_from_hex<16>("2b7e151628aed2a6abf7158809cf4f3c"));
+    const std::vector<std::uint8_t> plaintext = hex_to_bytes(
+        "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+        "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710");
+    const std::vector<std::uint8_t> expected = hex_to_bytes(
+        "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+        "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee");
+
+    modes::ctr<block::aes<128>> ctr(cipher, array_from_hex<16>("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"));
+    std::vector<std::uint8_t> ciphertext;
+    ctr.process(plaintext, std::back_inserter(ciphertext));
+    BOOST_CHECK(ciphertext == expected);
+
+    // The keystream continues across calls of any size and a 32-bit counter wraps without carrying.
+    const std::array<std::uint8_t, 16> near_wrap = array_from_hex<16>("000102030405060708090a0bfffffffe");
+    const std::vector<std::uint8_t> data = patterned_bytes(200, 5);
+    std::vector<std::uint8_t> whole(data.size()), pieces(data.size());
+    modes::ctr<block::aes<128>, 32>(cipher, near_wrap).process(data.data(), whole.data(), data.size());
+
+    modes::ctr<block::aes<128>, 32> split(cipher, near_wrap);
+    split.process(data.data(), pieces.data(), 3);
+    split.process(data.data() + 3, pieces.data() + 3, data.size() - 3);
+    BOOST_CHECK(whole == pieces);
+
+    std::array<std::uint8_t, 16> wrapped = array_from_hex<16>("000102030405060708090a0b00000000");
+    const std::array<std::uint8_t, 16> third_block = cipher.encrypt(wrapped);
+    for (std::size_t i = 0; i != 16; ++i) {
+        BOOST_CHECK_EQUAL(whole[32 + i], data[32 + i] ^ third_block[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ghash_multipliers_match_bit_serial_reference) {
+    namespace ghash = mac::detail::ghash;
+
+    const ghash::block_type h = array_from_hex<16>("66e94bd4ef8a2c3b884cfa59ca342b2e");
+    const std::vector<std::uint8_t> data = patterned_bytes(16 * 21, 9);
+
+    ghash::block_type expected = ghash::zero_block();
+    for (std::size_t i = 0; i != data.size(); i += 16) {
+        ghash::block_type block;
+        std::copy(data.begin() + i, data.begin() + i + 16, block.begin());
+        ghash::xor_block(expected, block);
+        expected = ghash::multiply(expected, h);
+    }
+
+    ghash::block_type table_value = ghash::zero_block();
+    ghash::table_multiplier(h).process_blocks(table_value, data.data(), data.size() / 16);
+    BOOST_CHECK(table_value == expected);
+
+    ghash::state state(h);
+    state.update(data.data(), 7);
+    state.update(data.begin() + 7, data.end());
+    BOOST_CHECK(state.digest() == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,10 @@
 #ifndef CRYPTO3_MULTIPRECISION_EVAL_JACOBI_HPP
 #define CRYPTO3_MULTIPRECISION_EVAL_JACOBI_HPP
 
+#include <array>
+#include <bit>
+#include <cstddef>
+
 #include <boost/multiprecision/detail/default_ops.hpp>
 
 #include <nil/crypto3/multiprecision/modular/modular_functions_fixed.hpp>
@@ -73,6 +77,108 @@ namespace boost {
                 }
                 return J;
             }
+
+            // Binary Jacobi symbol on the limbs of fixed-size backends. Only subtractions and shifts are used, no
+            // division: with x, y odd and x >= y, (x / y) = ((x - y) / y), swapping x and y flips the sign when
+            // both are 3 mod 4, and every factor 2 taken out of x flips it when y is 3 or 5 mod 8. The loops only
+            // run over the limbs still in use, which shrink as the values do. Runs in variable time.
+            template<unsigned Bits>
+            BOOST_MP_CXX14_CONSTEXPR
+                typename std::enable_if<!is_trivial_cpp_int_modular<cpp_int_modular_backend<Bits>>::value, int>::type
+                eval_jacobi(const cpp_int_modular_backend<Bits> &a, const cpp_int_modular_backend<Bits> &n) {
+                using default_ops::eval_lt;
+                using default_ops::eval_modulus;
+
+                typedef cpp_int_modular_backend<Bits> Backend;
+                constexpr std::size_t N = Backend::internal_limb_count;
+                constexpr unsigned limb_bits = Backend::limb_bits;
+
+                BOOST_ASSERT((n.limbs()[0] & 1u) != 0);
+
+                Backend a_reduced = a;
+                if (!eval_lt(a_reduced, n)) {
+                    eval_modulus(a_reduced, n);
+                }
+
+                std::array<limb_type, N> x = {}, y = {};
+                for (std::size_t i = 0; i < N; ++i) {
+                    x[i] = a_reduced.limbs()[i];
+                    y[i] = n.limbs()[i];
+                }
+                std::size_t size = N;
+                while (size > 1 && x[size - 1] == 0 && y[size - 1] == 0) {
+                    --size;
+                }
+
+                int J = 1;
+                for (;;) {
+                    std::size_t zero_limbs = 0;
+                    while (zero_limbs < size && x[zero_limbs] == 0) {
+                        ++zero_limbs;
+                    }
+                    if (zero_limbs == size) {
+                        break;
+                    }
+
+                    // x = x / 2^shift with x becoming odd.
+                    const unsigned bit_shift = std::countr_zero(x[zero_limbs]);
+                    if (zero_limbs != 0 || bit_shift != 0) {
+                        for (std::size_t i = 0; i + zero_limbs < size; ++i) {
+                            limb_type value = x[i + zero_limbs] >> bit_shift;
+                            if (bit_shift != 0 && i + zero_limbs + 1 < size) {
+                                value |= x[i + zero_limbs + 1] << (limb_bits - bit_shift);
+                            }
+                            x[i] = value;
+                        }
+                        for (std::size_t i = size - zero_limbs; i < size; ++i) {
+                            x[i] = 0;
+                        }
+                        const std::size_t shift = zero_limbs * limb_bits + bit_shift;
+                        const limb_type y_mod_8 = y[0] & 7u;
+                        if ((shift & 1u) != 0 && (y_mod_8 == 3 || y_mod_8 == 5)) {
+                            J = -J;
+                        }
+                    }
+
+                    // Keep x >= y.
+                    std::size_t i = size;
+                    while (i > 1 && x[i - 1] == y[i - 1]) {
+                        --i;
+                    }
+                    if (x[i - 1] < y[i - 1]) {
+                        for (std::size_t k = 0; k < size; ++k) {
+                            const limb_type tmp = x[k];
+                            x[k] = y[k];
+                            y[k] = tmp;
+                        }
+                        if ((x[0] & 3u) == 3 && (y[0] & 3u) == 3) {
+                            J = -J;
+                        }
+                    }
+
+                    limb_type borrow = 0;
+                    for (std::size_t k = 0; k < size; ++k) {
+                        const limb_type difference = x[k] - y[k] - borrow;
+                        borrow = (x[k] < y[k]) || (x[k] == y[k] && borrow != 0) ? 1u : 0u;
+                        x[k] = difference;
+                    }
+
+                    while (size > 1 && x[size - 1] == 0 && y[size - 1] == 0) {
+                        --size;
+                    }
+                }
+
+                // x is zero now and y = gcd(a, n).
+                if (y[0] != 1) {
+                    return 0;
+                }
+                for (std::size_t k = 1; k < size; ++k) {
+                    if (y[k] != 0) {
+                        return 0;
+                    }
+                }
+                return J;
+            }
         }    // namespace backends
     }    // namespace multiprecision
 }    // namespace boost
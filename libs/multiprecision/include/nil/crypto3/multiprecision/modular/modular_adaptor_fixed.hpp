@@ -316,6 +316,11 @@ namespace boost {
                 o.mod_data().mod_mul(result.base_data(), o.base_data());
             }
 
+            template<unsigned Bits, typename StorageType>
+            BOOST_MP_CXX14_CONSTEXPR void eval_square(modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result) {
+                result.mod_data().mod_square(result.base_data());
+            }
+
             template<unsigned Bits, typename Backend, typename T, typename StorageType>
             BOOST_MP_CXX14_CONSTEXPR void eval_powm(modular_adaptor<cpp_int_modular_backend<Bits>, StorageType> &result,
                                                     const modular_adaptor<Backend, StorageType> &b, const T &e) {
@@ -341,6 +346,16 @@ namespace boost {
                 using Backend = cpp_int_modular_backend<Bits>;
                 using Backend_padded_limbs = typename modular_params<Backend>::policy_type::Backend_padded_limbs;
 
+                // Odd moduli are inverted in Montgomery form by divsteps, in constant time and without leaving the
+                // fixed-size limbs.
+                if constexpr (modular_functions_fixed<Backend>::has_montgomery_inverse) {
+                    if (input.mod_data().get_is_odd_mod()) {
+                        result = input;
+                        result.mod_data().mod_inverse(result.base_data());
+                        return;
+                    }
+                }
+
                 Backend_padded_limbs new_base, res, tmp = input.mod_data().get_mod();
 
                 input.mod_data().adjust_regular(new_base, input.base_data());
@@ -17,9 +17,20 @@
 #include <boost/mpl/if.hpp>
 
 #include <array>
+#include <bit>
 #include <type_traits>
 #include <utility>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(BOOST_MP_NO_CONSTEXPR_DETECTION)
+#include <nil/crypto3/multiprecision/modular/montgomery_mulx.hpp>
+#define CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+#endif
+
+#if defined(BOOST_HAS_INT128)
+#include <nil/crypto3/multiprecision/modular/safegcd_inverse.hpp>
+#define CRYPTO3_MULTIPRECISION_SAFEGCD_INVERSE_SELECTED
+#endif
+
 namespace boost {
     namespace multiprecision {
         namespace backends {
@@ -253,6 +264,13 @@ namespace boost {
                 }
 
             public:
+#ifdef CRYPTO3_MULTIPRECISION_SAFEGCD_INVERSE_SELECTED
+                constexpr static const bool has_montgomery_inverse =
+                    !is_trivial_cpp_int_modular<Backend>::value && limb_bits == 64;
+#else
+                constexpr static const bool has_montgomery_inverse = false;
+#endif
+
                 BOOST_MP_CXX14_CONSTEXPR auto &get_mod() {
                     return m_mod;
                 }
@@ -439,6 +457,9 @@ namespace boost {
                 BOOST_MP_CXX14_CONSTEXPR void montgomery_mul(Backend &result, const Backend &y,
                                                              std::integral_constant<bool, false> const &) const {
 
+                    if (montgomery_mul_mulx(result, y)) {
+                        return;
+                    }
                     if (m_no_carry_montgomery_mul_allowed)
                         montgomery_mul_no_carry_impl(result, y);
                     else
@@ -450,17 +471,41 @@ namespace boost {
                     montgomery_mul_CIOS_impl(result, y, std::integral_constant<bool, true>());
                 }
 
+                // Delegates Montgomery squaring to one of corresponding algorithms.
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_square(Backend &result,
+                                                                std::integral_constant<bool, false> const &) const {
+                    if (montgomery_square_mulx(result)) {
+                        return;
+                    }
+                    montgomery_square_SOS_impl(result);
+                }
+
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_square(Backend &result,
+                                                                std::integral_constant<bool, true> const &) const {
+                    montgomery_mul_CIOS_impl(result, result, std::integral_constant<bool, true>());
+                }
+
+                // Constant-time inversion of a Montgomery residue: x * R becomes x^-1 * R, zero stays zero. Only
+                // available when has_montgomery_inverse is set and the modulus is odd.
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_inverse(Backend &result) const {
+                    static_assert(has_montgomery_inverse, "Divsteps inversion needs 64-bit limbs and int128.");
+#ifdef CRYPTO3_MULTIPRECISION_SAFEGCD_INVERSE_SELECTED
+                    BOOST_ASSERT(eval_lt(result, m_mod));
+                    safegcd_inverse_impl<limbs_count>::inverse(result.limbs(), result.limbs(), m_mod.limbs(),
+                                                               static_cast<internal_limb_type>(0u) -
+                                                                   m_montgomery_p_dash);
+                    // (x * R)^-1 = x^-1 * R^-1, each multiplication by R^2 brings one factor of R back.
+                    montgomery_mul(result, m_montgomery_r2, std::integral_constant<bool, false>());
+                    montgomery_mul(result, m_montgomery_r2, std::integral_constant<bool, false>());
+#endif
+                }
+
                 /**
                  * Compute a sum of products of Montgomery residues with one Montgomery reduction.
                  *
-                 * Every input is a canonical residue in [0, modulus). Products are accumulated in a backend with
-                 * twice the operand limb count plus one extra limb. The extra limb can hold the growth from any
-                 * range whose length fits in std::size_t: a product occupies at most twice the operand limb count,
-                 * and the number of products contributes at most one limb of carry.
-                 *
-                 * The usual Montgomery reduction only needs one final subtraction for a single product. An
-                 * accumulated sum can produce a larger post-REDC quotient, so repeated modulus subtractions
-                 * canonicalize it before it is returned. Trivial single-limb backends use ordinary eager products.
+                 * Every input is a canonical residue in [0, modulus). Products are summed unreduced in a
+                 * montgomery_accumulator_type and reduced once by montgomery_reduce_accumulator. Trivial single-limb
+                 * backends use ordinary eager products.
                  */
                 template<typename InputIterator1, typename InputIterator2>
                 BOOST_MP_CXX14_CONSTEXPR void montgomery_inner_product(Backend &result, InputIterator1 first1,
@@ -494,83 +539,195 @@ namespace boost {
                     montgomery_inner_product_impl(Backend &result, InputIterator1 first1, InputIterator1 last1,
                                                   InputIterator2 first2,
                                                   std::integral_constant<bool, false> const &) const {
-                    static_assert(std::numeric_limits<std::size_t>::digits <= limb_bits,
-                                  "the accumulator needs one limb for the range length");
-                    constexpr std::size_t operand_limbs = Backend::internal_limb_count;
-                    constexpr std::size_t product_diagonals = 2 * operand_limbs - 1;
-                    constexpr std::size_t max_block_terms =
-                        std::numeric_limits<internal_limb_type>::max() / (2 * operand_limbs);
-
-                    Backend_doubled_padded_limbs accumulator(internal_limb_type(0u));
-                    while (first1 != last1) {
-                        std::array<internal_limb_type, product_diagonals> diagonal_low = {};
-                        std::array<internal_limb_type, product_diagonals> diagonal_middle = {};
-                        std::array<internal_limb_type, product_diagonals> diagonal_high = {};
-
-                        std::size_t block_terms = 0;
-                        for (; first1 != last1 && block_terms < max_block_terms; ++first1, ++first2, ++block_terms) {
-                            BOOST_ASSERT(eval_lt(*first1, m_mod) && eval_lt(*first2, m_mod));
-                            const internal_limb_type *left_limbs = (*first1).limbs();
-                            const internal_limb_type *right_limbs = (*first2).limbs();
-
-                            // Comba accumulation keeps the independent product diagonals separate. Carries are
-                            // propagated only after the block instead of forming a dependency chain in every product.
-                            for (std::size_t i = 0; i < operand_limbs; ++i) {
-                                for (std::size_t j = 0; j < operand_limbs; ++j) {
-                                    const std::size_t diagonal = i + j;
-                                    const internal_double_limb_type product =
-                                        static_cast<internal_double_limb_type>(left_limbs[i]) * right_limbs[j];
-
-                                    internal_double_limb_type partial =
-                                        static_cast<internal_double_limb_type>(diagonal_low[diagonal]) +
-                                        static_cast<internal_limb_type>(product);
-                                    diagonal_low[diagonal] = static_cast<internal_limb_type>(partial);
-                                    const internal_limb_type carry =
-                                        static_cast<internal_limb_type>(partial >> limb_bits);
-
-                                    partial = static_cast<internal_double_limb_type>(diagonal_middle[diagonal]) +
-                                              static_cast<internal_limb_type>(product >> limb_bits) + carry;
-                                    diagonal_middle[diagonal] = static_cast<internal_limb_type>(partial);
-                                    diagonal_high[diagonal] += static_cast<internal_limb_type>(partial >> limb_bits);
-                                }
-                            }
+                    montgomery_accumulator_type accumulator;
+                    for (; first1 != last1; ++first1, ++first2) {
+                        montgomery_accumulate(accumulator, *first1, *first2);
+                    }
+                    montgomery_reduce_accumulator(result, accumulator);
+                }
+
+                /**
+                 * Unreduced sum of Montgomery products, see montgomery_accumulate. The limb above the double-width
+                 * product holds the carries of up to max(internal_limb_type) terms.
+                 */
+                struct montgomery_accumulator_type {
+                    std::array<internal_limb_type, 2 * limbs_count + 1> limbs = {};
+                };
+
+                /**
+                 * accumulator += x * y without any reduction, x and y being canonical residues.
+                 */
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_accumulate(montgomery_accumulator_type &accumulator,
+                                                                    const Backend &x, const Backend &y) const {
+                    BOOST_ASSERT(eval_lt(x, m_mod) && eval_lt(y, m_mod));
+#ifdef CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+                    if constexpr (limb_bits == 64 && montgomery_mulx_impl::has_kernel<limbs_count>()) {
+                        if (!BOOST_MP_IS_CONST_EVALUATED(x.limbs()[0]) && montgomery_mulx_impl::is_supported()) {
+                            montgomery_mulx_impl::accumulate<limbs_count>(accumulator.limbs.data(), x.limbs(),
+                                                                          y.limbs());
+                            return;
                         }
+                    }
+#endif
+                    internal_limb_type *acc = accumulator.limbs.data();
+                    const internal_limb_type *x_limbs = x.limbs();
+                    const internal_limb_type *y_limbs = y.limbs();
+
+                    // The carry out of every row goes to the next row, the last one to the spare limb.
+                    internal_limb_type row_carry = 0;
+                    for (std::size_t i = 0; i < limbs_count; ++i) {
+                        internal_limb_type carry = 0;
+                        for (std::size_t j = 0; j < limbs_count; ++j) {
+                            const internal_double_limb_type t =
+                                static_cast<internal_double_limb_type>(x_limbs[i]) * y_limbs[j] + acc[i + j] + carry;
+                            acc[i + j] = static_cast<internal_limb_type>(t);
+                            carry = static_cast<internal_limb_type>(t >> limb_bits);
+                        }
+                        const internal_double_limb_type t =
+                            static_cast<internal_double_limb_type>(acc[i + limbs_count]) + carry + row_carry;
+                        acc[i + limbs_count] = static_cast<internal_limb_type>(t);
+                        row_carry = static_cast<internal_limb_type>(t >> limb_bits);
+                    }
+                    acc[2 * limbs_count] += row_carry;
+                }
 
-                        Backend_doubled_padded_limbs block_product(internal_limb_type(0u));
-                        internal_limb_type *block_limbs = block_product.limbs();
-                        internal_limb_type carry_low = 0;
-                        internal_limb_type carry_high = 0;
-                        for (std::size_t diagonal = 0; diagonal < product_diagonals; ++diagonal) {
-                            internal_double_limb_type partial =
-                                static_cast<internal_double_limb_type>(diagonal_low[diagonal]) + carry_low;
-                            block_limbs[diagonal] = static_cast<internal_limb_type>(partial);
-                            const internal_limb_type low_overflow =
-                                static_cast<internal_limb_type>(partial >> limb_bits);
-
-                            partial = static_cast<internal_double_limb_type>(diagonal_middle[diagonal]) + carry_high +
-                                      low_overflow;
-                            carry_low = static_cast<internal_limb_type>(partial);
-                            const internal_limb_type middle_overflow =
-                                static_cast<internal_limb_type>(partial >> limb_bits);
-
-                            partial = static_cast<internal_double_limb_type>(diagonal_high[diagonal]) + middle_overflow;
-                            carry_high = static_cast<internal_limb_type>(partial);
-                            BOOST_ASSERT((partial >> limb_bits) == 0);
+                /**
+                 * accumulator += x * 2^(limb_bits * limbs_count), so that the residue x comes out of the final
+                 * reduction as itself, next to the products.
+                 */
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_accumulate(montgomery_accumulator_type &accumulator,
+                                                                    const Backend &x) const {
+                    BOOST_ASSERT(eval_lt(x, m_mod));
+                    internal_limb_type *acc = accumulator.limbs.data() + limbs_count;
+                    const internal_limb_type *x_limbs = x.limbs();
+
+                    internal_limb_type carry = 0;
+                    for (std::size_t i = 0; i < limbs_count; ++i) {
+                        const internal_double_limb_type t =
+                            static_cast<internal_double_limb_type>(acc[i]) + x_limbs[i] + carry;
+                        acc[i] = static_cast<internal_limb_type>(t);
+                        carry = static_cast<internal_limb_type>(t >> limb_bits);
+                    }
+                    acc[limbs_count] += carry;
+                }
+
+                /**
+                 * result = accumulator / 2^(limb_bits * limbs_count) mod modulus, canonical.
+                 *
+                 * The accumulator is split as high * R + low. low / R takes one Montgomery reduction, which leaves
+                 * the sum below high + modulus, so sums of a few products, the usual case, need at most seven
+                 * subtractions and only large sums go through Barrett reduction.
+                 */
+                BOOST_MP_CXX14_CONSTEXPR void
+                    montgomery_reduce_accumulator(Backend &result,
+                                                  const montgomery_accumulator_type &accumulator) const {
+                    std::array<internal_limb_type, limbs_count + 1> value;
+                    montgomery_reduce_low(value, accumulator);
+
+                    const internal_limb_type *mod_limbs = m_mod.limbs();
+                    const std::size_t mod_msb = eval_msb(m_mod);
+                    bool large = false;
+                    for (std::size_t i = limbs_count + 1; i-- > 0;) {
+                        if (value[i] != 0) {
+                            // Below 2^(msb + 3), that is 8 * modulus, the subtractions are cheaper than Barrett.
+                            large = i * limb_bits + limb_bits - 1 - std::countl_zero(value[i]) > mod_msb + 2;
+                            break;
                         }
-                        block_limbs[2 * operand_limbs - 1] = carry_low;
-                        block_limbs[2 * operand_limbs] = carry_high;
-                        eval_add(accumulator, block_product);
+                    }
+                    if (large) {
+                        Backend_doubled_padded_limbs wide(internal_limb_type(0u));
+                        for (std::size_t i = 0; i <= limbs_count; ++i) {
+                            wide.limbs()[i] = value[i];
+                        }
+                        barrett_reduce(wide);
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            value[i] = wide.limbs()[i];
+                        }
+                        value[limbs_count] = 0;
                     }
 
-                    montgomery_reduce(accumulator);
+                    // Subtract the modulus until the difference borrows.
+                    for (;;) {
+                        std::array<internal_limb_type, limbs_count + 1> difference;
+                        internal_limb_type borrow = 0;
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            const internal_double_limb_type t =
+                                static_cast<internal_double_limb_type>(value[i]) - mod_limbs[i] - borrow;
+                            difference[i] = static_cast<internal_limb_type>(t);
+                            borrow = static_cast<internal_limb_type>(t >> limb_bits) & 1u;
+                        }
+                        if (value[limbs_count] < borrow) {
+                            break;
+                        }
+                        difference[limbs_count] = value[limbs_count] - borrow;
+                        value = difference;
+                    }
 
-                    // REDC is congruent for the accumulated value, but its single final subtraction only
-                    // canonicalizes a single product. Finish reducing the larger quotient with cheap subtractions.
-                    const Backend_doubled_padded_limbs modulus(m_mod);
-                    while (!eval_lt(accumulator, modulus)) {
-                        eval_subtract(accumulator, modulus);
+                    internal_limb_type *result_limbs = result.limbs();
+                    for (std::size_t i = 0; i < limbs_count; ++i) {
+                        result_limbs[i] = value[i];
                     }
-                    result = accumulator;
+                }
+
+                // value = high + low / R mod modulus for the accumulator high * R + low, with low / R reduced to
+                // [0, modulus].
+                BOOST_MP_CXX14_CONSTEXPR void
+                    montgomery_reduce_low(std::array<internal_limb_type, limbs_count + 1> &value,
+                                          const montgomery_accumulator_type &accumulator) const {
+                    const internal_limb_type *acc = accumulator.limbs.data();
+                    std::array<internal_limb_type, limbs_count> low;
+                    for (std::size_t i = 0; i < limbs_count; ++i) {
+                        low[i] = acc[i];
+                    }
+
+                    bool reduced = false;
+#ifdef CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+                    if constexpr (limb_bits == 64 && montgomery_mulx_impl::has_kernel<limbs_count>()) {
+                        if (!BOOST_MP_IS_CONST_EVALUATED(acc[0]) && montgomery_mulx_impl::is_supported()) {
+                            // low * 1 < modulus * R keeps the kernel within its bounds even for low >= modulus.
+                            std::array<internal_limb_type, limbs_count> one = {1u};
+                            montgomery_mulx_impl::mul<limbs_count>(low.data(), one.data(), m_mod.limbs(),
+                                                                   m_montgomery_p_dash);
+                            reduced = true;
+                        }
+                    }
+#endif
+                    if (!reduced) {
+                        // Word-by-word REDC of low, the result lands in the upper half of t.
+                        const internal_limb_type *mod_limbs = m_mod.limbs();
+                        std::array<internal_limb_type, 2 * limbs_count + 1> t = {};
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            t[i] = low[i];
+                        }
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            const internal_limb_type m = t[i] * m_montgomery_p_dash;
+                            internal_limb_type carry = 0;
+                            for (std::size_t j = 0; j < limbs_count; ++j) {
+                                const internal_double_limb_type z =
+                                    static_cast<internal_double_limb_type>(m) * mod_limbs[j] + t[i + j] + carry;
+                                t[i + j] = static_cast<internal_limb_type>(z);
+                                carry = static_cast<internal_limb_type>(z >> limb_bits);
+                            }
+                            for (std::size_t j = i + limbs_count; carry != 0; ++j) {
+                                const internal_double_limb_type z = static_cast<internal_double_limb_type>(t[j]) + carry;
+                                t[j] = static_cast<internal_limb_type>(z);
+                                carry = static_cast<internal_limb_type>(z >> limb_bits);
+                            }
+                        }
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            low[i] = t[limbs_count + i];
+                        }
+                        BOOST_ASSERT(t[2 * limbs_count] == 0);
+                    }
+
+                    internal_limb_type carry = 0;
+                    for (std::size_t i = 0; i < limbs_count; ++i) {
+                        const internal_double_limb_type z =
+                            static_cast<internal_double_limb_type>(acc[limbs_count + i]) + low[i] + carry;
+                        value[i] = static_cast<internal_limb_type>(z);
+                        carry = static_cast<internal_limb_type>(z >> limb_bits);
+                    }
+                    value[limbs_count] = acc[2 * limbs_count] + carry;
                 }
 
                 // Given a value represented in 'double_limb_type', decomposes it into
@@ -607,6 +764,115 @@ namespace boost {
                     return false;
                 }
 
+                // Runs the mulx/adx kernel when the CPU has one for this limb count. Returns false when the caller
+                // has to use the portable code, which is always the case during constant evaluation.
+                BOOST_MP_CXX14_CONSTEXPR bool montgomery_mul_mulx(Backend &result, const Backend &y) const {
+#ifdef CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+                    if constexpr (limb_bits == 64 && montgomery_mulx_impl::has_kernel<limbs_count>()) {
+                        if (!BOOST_MP_IS_CONST_EVALUATED(result.limbs()[0]) && montgomery_mulx_impl::is_supported()) {
+                            BOOST_ASSERT(eval_lt(result, m_mod) && eval_lt(y, m_mod));
+                            montgomery_mulx_impl::mul<limbs_count>(result.limbs(), y.limbs(), m_mod.limbs(),
+                                                                   m_montgomery_p_dash);
+                            return true;
+                        }
+                    }
+#endif
+                    return false;
+                }
+
+                // Squaring counterpart of montgomery_mul_mulx, the kernel takes every cross product once.
+                BOOST_MP_CXX14_CONSTEXPR bool montgomery_square_mulx(Backend &result) const {
+#ifdef CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+                    if constexpr (limb_bits == 64 && montgomery_mulx_impl::has_kernel<limbs_count>()) {
+                        if (!BOOST_MP_IS_CONST_EVALUATED(result.limbs()[0]) && montgomery_mulx_impl::is_supported()) {
+                            BOOST_ASSERT(eval_lt(result, m_mod));
+                            montgomery_mulx_impl::square<limbs_count>(result.limbs(), m_mod.limbs(),
+                                                                      m_montgomery_p_dash);
+                            return true;
+                        }
+                    }
+#endif
+                    return false;
+                }
+
+                // Montgomery squaring with separated operand scanning. Each cross product a[i] * a[j], i < j, is
+                // computed once and the sum is doubled with a shift before the limb squares are added on the
+                // diagonal, so the square takes N * (N + 1) / 2 limb products instead of N * N. The double-width
+                // square is then reduced limb by limb.
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void montgomery_square_SOS_impl(Backend1 &result) const {
+                    BOOST_ASSERT(eval_lt(result, m_mod));
+
+                    constexpr std::size_t N = Backend1::internal_limb_count;
+                    const internal_limb_type *a = result.limbs();
+                    const internal_limb_type *mod_limbs = m_mod.limbs();
+                    std::array<internal_limb_type, 2 * N> t = {};
+
+                    // Cross products, a[0] * a[0] row excluded.
+                    for (std::size_t i = 0; i + 1 < N; ++i) {
+                        internal_limb_type carry = 0;
+                        for (std::size_t j = i + 1; j < N; ++j) {
+                            const internal_double_limb_type z =
+                                static_cast<internal_double_limb_type>(a[i]) * a[j] + t[i + j] + carry;
+                            t[i + j] = static_cast<internal_limb_type>(z);
+                            carry = static_cast<internal_limb_type>(z >> limb_bits);
+                        }
+                        t[i + N] = carry;
+                    }
+
+                    // The cross sum is below a^2 / 2, so doubling it cannot overflow 2 * N limbs.
+                    for (std::size_t i = 2 * N - 1; i > 0; --i) {
+                        t[i] = (t[i] << 1) | (t[i - 1] >> (limb_bits - 1));
+                    }
+                    t[0] <<= 1;
+
+                    internal_limb_type carry = 0;
+                    for (std::size_t i = 0; i < N; ++i) {
+                        const internal_double_limb_type square = static_cast<internal_double_limb_type>(a[i]) * a[i];
+                        internal_double_limb_type z =
+                            static_cast<internal_double_limb_type>(t[2 * i]) + static_cast<internal_limb_type>(square) +
+                            carry;
+                        t[2 * i] = static_cast<internal_limb_type>(z);
+                        z = static_cast<internal_double_limb_type>(t[2 * i + 1]) +
+                            static_cast<internal_limb_type>(square >> limb_bits) + (z >> limb_bits);
+                        t[2 * i + 1] = static_cast<internal_limb_type>(z);
+                        carry = static_cast<internal_limb_type>(z >> limb_bits);
+                    }
+
+                    // Montgomery reduction. The carry out of round i lands in limb i + N + 1, which is exactly where
+                    // round i + 1 adds its own carry, so a single pending limb is enough.
+                    internal_limb_type pending = 0;
+                    for (std::size_t i = 0; i < N; ++i) {
+                        const internal_limb_type m = t[i] * m_montgomery_p_dash;
+                        internal_limb_type k = 0;
+                        for (std::size_t j = 0; j < N; ++j) {
+                            const internal_double_limb_type z =
+                                static_cast<internal_double_limb_type>(m) * mod_limbs[j] + t[i + j] + k;
+                            t[i + j] = static_cast<internal_limb_type>(z);
+                            k = static_cast<internal_limb_type>(z >> limb_bits);
+                        }
+                        const internal_double_limb_type z =
+                            static_cast<internal_double_limb_type>(t[i + N]) + k + pending;
+                        t[i + N] = static_cast<internal_limb_type>(z);
+                        pending = static_cast<internal_limb_type>(z >> limb_bits);
+                    }
+
+                    // The reduced value is below 2 * mod, with its top bit in pending.
+                    std::array<internal_limb_type, N> difference = {};
+                    internal_limb_type borrow = 0;
+                    for (std::size_t i = 0; i < N; ++i) {
+                        const internal_double_limb_type z = static_cast<internal_double_limb_type>(t[i + N]) -
+                                                            mod_limbs[i] - borrow;
+                        difference[i] = static_cast<internal_limb_type>(z);
+                        borrow = static_cast<internal_limb_type>(z >> limb_bits) & 1u;
+                    }
+                    const bool subtract = pending != 0 || borrow == 0;
+                    internal_limb_type *result_limbs = result.limbs();
+                    for (std::size_t i = 0; i < N; ++i) {
+                        result_limbs[i] = subtract ? difference[i] : t[i + N];
+                    }
+                }
+
                 // Non-carry implementation of Montgomery multiplication.
                 // Implemented from pseudo-code at
                 //   "https://hackmd.io/@gnark/modular_multiplication".
@@ -936,8 +1202,8 @@ namespace boost {
                                 break;
                             }
                         }
-                        montgomery_mul(base, base,
-                                       std::integral_constant<bool, is_trivial_cpp_int_modular<Backend>::value>());
+                        montgomery_square(base,
+                                          std::integral_constant<bool, is_trivial_cpp_int_modular<Backend>::value>());
                     }
                     result = R_mod_m;
                 }
@@ -134,6 +134,23 @@ namespace boost {
                     }
                 }
 
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_square(Backend1 &result) const {
+                    if (is_odd_mod) {
+                        m_mod_obj.montgomery_square(
+                            result, std::integral_constant<bool, is_trivial_cpp_int_modular<Backend1>::value>());
+                    } else {
+                        m_mod_obj.regular_mul(result, result);
+                    }
+                }
+
+                // Inverts a Montgomery residue in place, see modular_functions_fixed::montgomery_inverse.
+                template<typename Backend1>
+                BOOST_MP_CXX14_CONSTEXPR void mod_inverse(Backend1 &result) const {
+                    BOOST_ASSERT(is_odd_mod);
+                    m_mod_obj.montgomery_inverse(result);
+                }
+
                 template<typename Backend1, typename Backend2>
                 BOOST_MP_CXX14_CONSTEXPR void mod_add(Backend1 &result, const Backend2 &y) const {
                     m_mod_obj.regular_add(result, y);
@@ -0,0 +1,380 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_IFMA_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_IFMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define CRYPTO3_IFMA_TARGET __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+// The digit loops have to be unrolled for the accumulators to stay in registers.
+#define CRYPTO3_IFMA_UNROLL _Pragma("GCC unroll 16")
+#endif
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            /*!
+             * @brief Montgomery multiplication of 8 independent residues at once with AVX-512 IFMA.
+             *
+             * Residues are stored as in modular_functions_fixed: LimbsCount 64-bit limbs in Montgomery form with
+             * R = 2^(64 * LimbsCount). The kernels load them into digits of 52 bits, one element per vector
+             * lane, and run CIOS on vpmadd52luq/vpmadd52huq with unnormalized accumulators, so only the lowest
+             * accumulator word is carried per round. The Montgomery radix of d 52-bit digits is
+             * 2^(64 * LimbsCount + shift); the second multiplicand is loaded shifted left by shift bits, which
+             * makes the products come out in the same representation as the scalar code without a correction.
+             *
+             * Operands are addressed through the limbs of their first element and the distance in 64-bit words
+             * between consecutive elements, 0 for one value broadcast to every lane. Results are canonical.
+             * Callers have to check is_supported() before using the kernels.
+             */
+            struct montgomery_ifma_impl {
+                constexpr static const std::size_t lanes = 8;
+
+                template<std::size_t LimbsCount>
+                constexpr static bool has_kernel() {
+                    return LimbsCount >= 4 && LimbsCount <= 6;
+                }
+
+                static bool is_supported() {
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+                    return true;
+#elif defined(CRYPTO3_MULTIPRECISION_IFMA_KERNELS)
+                    static const bool supported = detect();
+                    return supported;
+#else
+                    return false;
+#endif
+                }
+
+                template<std::size_t LimbsCount>
+                struct params {
+                    constexpr static const std::size_t digits = (64 * LimbsCount + 51) / 52;
+                    constexpr static const std::size_t shift = 52 * digits - 64 * LimbsCount;
+
+                    std::uint64_t mod[digits];
+                    // -mod^-1 mod 2^52
+                    std::uint64_t p_dash;
+
+                    template<typename LimbType>
+                    explicit params(const LimbType *m) {
+                        static_assert(sizeof(LimbType) == 8, "The IFMA Montgomery kernels work on 64-bit limbs.");
+                        for (std::size_t j = 0; j < digits; ++j) {
+                            const std::size_t bit = 52 * j, word = bit / 64, offset = bit % 64;
+                            std::uint64_t digit = static_cast<std::uint64_t>(m[word]) >> offset;
+                            if (offset > 12 && word + 1 < LimbsCount) {
+                                digit |= static_cast<std::uint64_t>(m[word + 1]) << (64 - offset);
+                            }
+                            mod[j] = digit & digit_mask;
+                        }
+                        // Newton iteration, every step doubles the number of correct low bits.
+                        std::uint64_t inv = m[0];
+                        for (std::size_t i = 0; i < 5; ++i) {
+                            inv *= 2 - m[0] * inv;
+                        }
+                        p_dash = (0 - inv) & digit_mask;
+                    }
+                };
+
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+                /*!
+                 * @brief r[i] = a[i] * b[i] for i < n. r may alias a or b.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                __attribute__((target("avx512f,avx512ifma"))) static void
+                    mul_n(LimbType *r, std::size_t r_stride, const LimbType *a, std::size_t a_stride,
+                          const LimbType *b, std::size_t b_stride, std::size_t n,
+                          const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    __m512i x[D], y[D], t[D];
+                    for (std::size_t i = 0; i < n; i += lanes) {
+                        const __mmask8 mask = lanes_mask(n - i);
+                        load<LimbsCount>(x, a + i * a_stride, a_stride, mask, 0);
+                        load<LimbsCount>(y, b + i * b_stride, b_stride, mask, params<LimbsCount>::shift);
+                        mul<LimbsCount>(t, x, y, p);
+                        store<LimbsCount>(r + i * r_stride, r_stride, mask, t);
+                    }
+                }
+
+                /*!
+                 * @brief r[i] += a[i] * b[i] for i < n. r may alias a or b.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                __attribute__((target("avx512f,avx512ifma"))) static void
+                    fma_n(LimbType *r, std::size_t r_stride, const LimbType *a, std::size_t a_stride,
+                          const LimbType *b, std::size_t b_stride, std::size_t n,
+                          const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    __m512i x[D], y[D], t[D];
+                    for (std::size_t i = 0; i < n; i += lanes) {
+                        const __mmask8 mask = lanes_mask(n - i);
+                        load<LimbsCount>(x, a + i * a_stride, a_stride, mask, 0);
+                        load<LimbsCount>(y, b + i * b_stride, b_stride, mask, params<LimbsCount>::shift);
+                        mul<LimbsCount>(t, x, y, p);
+                        load<LimbsCount>(x, r + i * r_stride, r_stride, mask, 0);
+                        add<LimbsCount>(y, x, t, p);
+                        store<LimbsCount>(r + i * r_stride, r_stride, mask, y);
+                    }
+                }
+
+                /*!
+                 * @brief Radix-2 butterfly (u[i], v[i]) = (u[i] + v[i] * w[i], u[i] - v[i] * w[i]) for i < n.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                __attribute__((target("avx512f,avx512ifma"))) static void
+                    butterfly_n(LimbType *u, std::size_t u_stride, LimbType *v, std::size_t v_stride,
+                                const LimbType *w, std::size_t w_stride, std::size_t n,
+                                const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    __m512i x[D], y[D], t[D];
+                    for (std::size_t i = 0; i < n; i += lanes) {
+                        const __mmask8 mask = lanes_mask(n - i);
+                        load<LimbsCount>(x, v + i * v_stride, v_stride, mask, 0);
+                        load<LimbsCount>(y, w + i * w_stride, w_stride, mask, params<LimbsCount>::shift);
+                        mul<LimbsCount>(t, x, y, p);
+                        load<LimbsCount>(x, u + i * u_stride, u_stride, mask, 0);
+                        add<LimbsCount>(y, x, t, p);
+                        store<LimbsCount>(u + i * u_stride, u_stride, mask, y);
+                        sub<LimbsCount>(y, x, t, p);
+                        store<LimbsCount>(v + i * v_stride, v_stride, mask, y);
+                    }
+                }
+
+            private:
+                constexpr static const std::uint64_t digit_mask = (std::uint64_t(1) << 52) - 1;
+
+                static __mmask8 lanes_mask(std::size_t remaining) {
+                    return remaining >= lanes ? __mmask8(0xFF) : __mmask8((1u << remaining) - 1);
+                }
+
+                static bool detect() {
+                    unsigned int eax, ebx, ecx, edx;
+                    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_OSXSAVE) == 0) {
+                        return false;
+                    }
+                    // The OS has to save the SSE, AVX and the three AVX-512 register states.
+                    std::uint32_t xcr0_low, xcr0_high;
+                    __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+                    if ((xcr0_low & 0xE6) != 0xE6) {
+                        return false;
+                    }
+                    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                        return false;
+                    }
+                    return (ebx & bit_AVX512F) != 0 && (ebx & bit_AVX512IFMA) != 0;
+                }
+
+                // Shifts every lane left by count bits, right for a negative count. Counts of 64 or more give 0.
+                CRYPTO3_IFMA_TARGET static __m512i shift_lanes(__m512i x, int count) {
+                    return count >= 0 ? _mm512_sllv_epi64(x, _mm512_set1_epi64(count)) :
+                                        _mm512_srlv_epi64(x, _mm512_set1_epi64(-count));
+                }
+
+                CRYPTO3_IFMA_TARGET static __m512i lane_indices(std::size_t stride) {
+                    const long long s = static_cast<long long>(stride);
+                    return _mm512_set_epi64(7 * s, 6 * s, 5 * s, 4 * s, 3 * s, 2 * s, s, 0);
+                }
+
+                // Loads the element values times 2^shift into 52-bit digits.
+                template<std::size_t LimbsCount, typename LimbType>
+                CRYPTO3_IFMA_TARGET static void load(__m512i *x, const LimbType *limbs, std::size_t stride,
+                                                     __mmask8 mask, std::size_t shift) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i index = lane_indices(stride);
+                    __m512i words[LimbsCount];
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t l = 0; l < LimbsCount; ++l) {
+                        words[l] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask,
+                                                               _mm512_add_epi64(index, _mm512_set1_epi64(l)),
+                                                               static_cast<const void *>(limbs), 8);
+                    }
+                    const __m512i digit_mask_v = _mm512_set1_epi64(digit_mask);
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        // Digit j holds the bits [52 * j - shift, 52 * j - shift + 52) of the value.
+                        const int bit = static_cast<int>(52 * j) - static_cast<int>(shift);
+                        __m512i digit = _mm512_setzero_si512();
+                        CRYPTO3_IFMA_UNROLL
+                        for (std::size_t l = 0; l < LimbsCount; ++l) {
+                            const int word_bit = static_cast<int>(64 * l);
+                            if (word_bit < bit + 52 && word_bit + 64 > bit) {
+                                digit = _mm512_or_si512(digit, shift_lanes(words[l], word_bit - bit));
+                            }
+                        }
+                        x[j] = _mm512_and_si512(digit, digit_mask_v);
+                    }
+                }
+
+                template<std::size_t LimbsCount, typename LimbType>
+                CRYPTO3_IFMA_TARGET static void store(LimbType *limbs, std::size_t stride, __mmask8 mask,
+                                                      const __m512i *x) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i index = lane_indices(stride);
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t l = 0; l < LimbsCount; ++l) {
+                        const int word_bit = static_cast<int>(64 * l);
+                        __m512i word = _mm512_setzero_si512();
+                        CRYPTO3_IFMA_UNROLL
+                        for (std::size_t j = 0; j < D; ++j) {
+                            const int bit = static_cast<int>(52 * j);
+                            if (bit < word_bit + 64 && bit + 52 > word_bit) {
+                                word = _mm512_or_si512(word, shift_lanes(x[j], bit - word_bit));
+                            }
+                        }
+                        _mm512_mask_i64scatter_epi64(static_cast<void *>(limbs), mask,
+                                                     _mm512_add_epi64(index, _mm512_set1_epi64(l)), word, 8);
+                    }
+                }
+
+                // r = x - mod if that does not borrow, x otherwise. x has normalized digits.
+                template<std::size_t LimbsCount>
+                CRYPTO3_IFMA_TARGET static void reduce_once(__m512i *r, const __m512i *x,
+                                                            const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i digit_mask_v = _mm512_set1_epi64(digit_mask);
+                    __m512i borrow = _mm512_setzero_si512();
+                    __m512i d[D];
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        d[j] = _mm512_sub_epi64(_mm512_sub_epi64(x[j], _mm512_set1_epi64(p.mod[j])), borrow);
+                        borrow = _mm512_srli_epi64(d[j], 63);
+                        d[j] = _mm512_and_si512(d[j], digit_mask_v);
+                    }
+                    const __mmask8 keep = _mm512_test_epi64_mask(borrow, borrow);
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        r[j] = _mm512_mask_blend_epi64(keep, d[j], x[j]);
+                    }
+                }
+
+                // r = x * y / 2^(52 * digits) mod mod, for x < mod and y < 2^shift * mod.
+                template<std::size_t LimbsCount>
+                CRYPTO3_IFMA_TARGET static void mul(__m512i *r, const __m512i *x, const __m512i *y,
+                                                    const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i zero = _mm512_setzero_si512();
+                    const __m512i p_dash = _mm512_set1_epi64(p.p_dash);
+                    __m512i mod[D];
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        mod[j] = _mm512_set1_epi64(p.mod[j]);
+                    }
+
+                    // Every word gets less than 4 * 2^52 per round, so D rounds fit into 64 bits.
+                    __m512i t[D + 1];
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j <= D; ++j) {
+                        t[j] = zero;
+                    }
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t i = 0; i < D; ++i) {
+                        CRYPTO3_IFMA_UNROLL
+                        for (std::size_t j = 0; j < D; ++j) {
+                            t[j] = _mm512_madd52lo_epu64(t[j], x[i], y[j]);
+                            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[i], y[j]);
+                        }
+                        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], p_dash);
+                        CRYPTO3_IFMA_UNROLL
+                        for (std::size_t j = 0; j < D; ++j) {
+                            t[j] = _mm512_madd52lo_epu64(t[j], m, mod[j]);
+                            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, mod[j]);
+                        }
+                        // The low 52 bits of t[0] are zero now.
+                        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+                        CRYPTO3_IFMA_UNROLL
+                        for (std::size_t j = 0; j < D; ++j) {
+                            t[j] = t[j + 1];
+                        }
+                        t[D] = zero;
+                    }
+
+                    // t < 2 * mod
+                    const __m512i digit_mask_v = _mm512_set1_epi64(digit_mask);
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j + 1 < D; ++j) {
+                        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+                        t[j] = _mm512_and_si512(t[j], digit_mask_v);
+                    }
+                    reduce_once<LimbsCount>(r, t, p);
+                }
+
+                // r = x + y mod mod, for x, y < mod. 2 * mod fits into the digits since shift > 0.
+                template<std::size_t LimbsCount>
+                CRYPTO3_IFMA_TARGET static void add(__m512i *r, const __m512i *x, const __m512i *y,
+                                                    const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i digit_mask_v = _mm512_set1_epi64(digit_mask);
+                    __m512i s[D];
+                    __m512i carry = _mm512_setzero_si512();
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        s[j] = _mm512_add_epi64(_mm512_add_epi64(x[j], y[j]), carry);
+                        carry = _mm512_srli_epi64(s[j], 52);
+                        s[j] = _mm512_and_si512(s[j], digit_mask_v);
+                    }
+                    reduce_once<LimbsCount>(r, s, p);
+                }
+
+                // r = x - y mod mod, for x, y < mod.
+                template<std::size_t LimbsCount>
+                CRYPTO3_IFMA_TARGET static void sub(__m512i *r, const __m512i *x, const __m512i *y,
+                                                    const params<LimbsCount> &p) {
+                    constexpr std::size_t D = params<LimbsCount>::digits;
+                    const __m512i digit_mask_v = _mm512_set1_epi64(digit_mask);
+                    __m512i borrow = _mm512_setzero_si512();
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        r[j] = _mm512_sub_epi64(_mm512_sub_epi64(x[j], y[j]), borrow);
+                        borrow = _mm512_srli_epi64(r[j], 63);
+                        r[j] = _mm512_and_si512(r[j], digit_mask_v);
+                    }
+                    // Add the modulus back in the lanes that borrowed.
+                    const __mmask8 wrapped = _mm512_test_epi64_mask(borrow, borrow);
+                    __m512i carry = _mm512_setzero_si512();
+                    CRYPTO3_IFMA_UNROLL
+                    for (std::size_t j = 0; j < D; ++j) {
+                        r[j] = _mm512_add_epi64(_mm512_mask_add_epi64(r[j], wrapped, r[j], _mm512_set1_epi64(p.mod[j])),
+                                                carry);
+                        carry = _mm512_srli_epi64(r[j], 52);
+                        r[j] = _mm512_and_si512(r[j], digit_mask_v);
+                    }
+                }
+#endif
+            };
+        }    // namespace backends
+    }    // namespace multiprecision
+}    // namespace boost
+
+#undef CRYPTO3_IFMA_TARGET
+#undef CRYPTO3_IFMA_UNROLL
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_IFMA_HPP
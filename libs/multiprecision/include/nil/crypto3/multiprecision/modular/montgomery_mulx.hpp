@@ -0,0 +1,359 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MULX_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MULX_HPP
+
+#include <cstddef>
+
+#include <boost/preprocessor/arithmetic/add.hpp>
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/arithmetic/mod.hpp>
+#include <boost/preprocessor/arithmetic/mul.hpp>
+#include <boost/preprocessor/comparison/less.hpp>
+#include <boost/preprocessor/control/iif.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/repetition/repeat_from_to.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/tuple/elem.hpp>
+
+#include <cpuid.h>
+
+// clang-format off
+
+#define CRYPTO3_MULX_PTR(REGNAME, I) BOOST_PP_STRINGIZE(I) "*8(%[" BOOST_PP_STRINGIZE(REGNAME) "])"
+
+// Register of the accumulator word J in round I. The N + 2 accumulator words live in a rotating window, so
+// the one word shift at the end of every round is free.
+#define CRYPTO3_MULX_T(N, I, J) "%[t" BOOST_PP_STRINGIZE(BOOST_PP_MOD(BOOST_PP_ADD(I, J), BOOST_PP_ADD(N, 2))) "]"
+
+// t += x[j] * rdx, products low halves on the OF chain and high halves on the CF chain.
+#define CRYPTO3_MULX_MAC_STEP(z, J, DATA)                                                              \
+    "mulxq " CRYPTO3_MULX_PTR(BOOST_PP_TUPLE_ELEM(3, 2, DATA), J) ", %[lo], %[hi]\n"                   \
+    "adoxq %[lo], " CRYPTO3_MULX_T(BOOST_PP_TUPLE_ELEM(3, 0, DATA), BOOST_PP_TUPLE_ELEM(3, 1, DATA), J) "\n" \
+    "adcxq %[hi], " CRYPTO3_MULX_T(BOOST_PP_TUPLE_ELEM(3, 0, DATA), BOOST_PP_TUPLE_ELEM(3, 1, DATA),        \
+                                   BOOST_PP_ADD(J, 1)) "\n"
+
+// Both chains end in the two top accumulator words.
+#define CRYPTO3_MULX_MAC(N, I, SRC)                                 \
+    "xorq %[lo], %[lo]\n"                                           \
+    BOOST_PP_REPEAT(N, CRYPTO3_MULX_MAC_STEP, (N, I, SRC))          \
+    "movq $0, %[lo]\n"                                              \
+    "adoxq %[lo], " CRYPTO3_MULX_T(N, I, N) "\n"                    \
+    "adcxq %[lo], " CRYPTO3_MULX_T(N, I, BOOST_PP_ADD(N, 1)) "\n"   \
+    "adoxq %[lo], " CRYPTO3_MULX_T(N, I, BOOST_PP_ADD(N, 1)) "\n"
+
+// One CIOS round: t += x * y[i], then t = (t + m * mod) / 2^64 with m = t[0] * p_dash.
+#define CRYPTO3_MULX_ROUND(z, I, N)                  \
+    "movq " CRYPTO3_MULX_PTR(y, I) ", %%rdx\n"       \
+    CRYPTO3_MULX_MAC(N, I, x)                        \
+    "movq " CRYPTO3_MULX_T(N, I, 0) ", %%rdx\n"      \
+    "imulq %[p_dash], %%rdx\n"                       \
+    CRYPTO3_MULX_MAC(N, I, mod)
+
+#define CRYPTO3_MULX_ZERO(z, J, DATA) "xorq %[t" BOOST_PP_STRINGIZE(J) "], %[t" BOOST_PP_STRINGIZE(J) "]\n"
+
+#define CRYPTO3_MULX_SUBTRACT(z, J, N) \
+    "sbbq " CRYPTO3_MULX_PTR(mod, J) ", " CRYPTO3_MULX_T(N, N, J) "\n"
+
+// Adds the modulus back when the subtraction borrowed. Only CF is touched by adcx, so ZF still holds the
+// borrow test for every cmov.
+#define CRYPTO3_MULX_ADD_BACK(z, J, N)                        \
+    "movq $0, %[lo]\n"                                        \
+    "cmovnzq " CRYPTO3_MULX_PTR(mod, J) ", %[lo]\n"           \
+    "adcxq %[lo], " CRYPTO3_MULX_T(N, N, J) "\n"              \
+    "movq " CRYPTO3_MULX_T(N, N, J) ", " CRYPTO3_MULX_PTR(x, J) "\n"
+
+#define CRYPTO3_MULX_OUTPUT(z, J, DATA) [t##J] "=&r"(t[J])
+
+#define CRYPTO3_MULX_MONTGOMERY_MUL(N)                                                         \
+    LimbType t[N + 2];                                                                         \
+    LimbType lo, hi;                                                                           \
+    asm volatile(                                                                              \
+        BOOST_PP_REPEAT(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_ZERO, _)                              \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_ROUND, N)                                              \
+        /* t < 2 * mod, subtract mod in place */                                               \
+        "subq " CRYPTO3_MULX_PTR(mod, 0) ", " CRYPTO3_MULX_T(N, N, 0) "\n"                     \
+        BOOST_PP_REPEAT_FROM_TO(1, N, CRYPTO3_MULX_SUBTRACT, N)                                \
+        "sbbq $0, " CRYPTO3_MULX_T(N, N, N) "\n"                                               \
+        "sbbq %[hi], %[hi]\n"                                                                  \
+        "clc\n"                                                                                \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_ADD_BACK, N)                                           \
+        : BOOST_PP_ENUM(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_OUTPUT, _),                           \
+          [lo] "=&r"(lo),                                                                      \
+          [hi] "=&r"(hi)                                                                       \
+        : [x] "r"(x),                                                                          \
+          [y] "r"(y),                                                                          \
+          [mod] "r"(mod),                                                                      \
+          [p_dash] "m"(p_dash)                                                                 \
+        : "rdx", "cc", "memory");
+
+// One schoolbook round of acc += x * y: t += x * y[i], then the finished product word i goes to the low
+// buffer and its register is cleared for the next top word.
+#define CRYPTO3_MULX_PRODUCT_ROUND(z, I, N)                                  \
+    "movq " CRYPTO3_MULX_PTR(y, I) ", %%rdx\n"                               \
+    CRYPTO3_MULX_MAC(N, I, x)                                                \
+    "movq " CRYPTO3_MULX_T(N, I, 0) ", " BOOST_PP_STRINGIZE(I) "*8+%[low]\n" \
+    "xorq " CRYPTO3_MULX_T(N, I, 0) ", " CRYPTO3_MULX_T(N, I, 0) "\n"
+
+#define CRYPTO3_MULX_ADD_LOW(z, I, DATA)                       \
+    "movq " BOOST_PP_STRINGIZE(I) "*8+%[low], %[lo]\n"         \
+    "adcq %[lo], " CRYPTO3_MULX_PTR(acc, I) "\n"
+
+#define CRYPTO3_MULX_ADD_HIGH(z, J, N) \
+    "adcq " CRYPTO3_MULX_T(N, N, J) ", " CRYPTO3_MULX_PTR(acc, BOOST_PP_ADD(N, J)) "\n"
+
+#define CRYPTO3_MULX_ACCUMULATE(N)                                                             \
+    LimbType t[N + 2];                                                                         \
+    LimbType low[N];                                                                           \
+    LimbType lo, hi;                                                                           \
+    asm volatile(                                                                              \
+        BOOST_PP_REPEAT(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_ZERO, _)                              \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_PRODUCT_ROUND, N)                                      \
+        /* the product is low and the first N words of t, add it to acc */                     \
+        "clc\n"                                                                                \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_ADD_LOW, _)                                            \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_ADD_HIGH, N)                                           \
+        "adcq $0, " CRYPTO3_MULX_PTR(acc, BOOST_PP_ADD(N, N)) "\n"                            \
+        : BOOST_PP_ENUM(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_OUTPUT, _),                           \
+          [low] "=m"(low),                                                                     \
+          [lo] "=&r"(lo),                                                                      \
+          [hi] "=&r"(hi)                                                                       \
+        : [acc] "r"(acc),                                                                      \
+          [x] "r"(x),                                                                          \
+          [y] "r"(y)                                                                           \
+        : "rdx", "cc", "memory");
+
+// One row of the cross products of a square: t += x[j] * x[i] for i < j, with rdx = x[i]. Row i starts at word
+// 2 * i + 1, so it has N - 1 - i products, and the finished word i goes to the square buffer.
+#define CRYPTO3_MULX_CROSS_ROUND(z, I, N)                                                      \
+    "movq " CRYPTO3_MULX_PTR(x, I) ", %%rdx\n"                                                 \
+    "xorq %[lo], %[lo]\n"                                                                      \
+    BOOST_PP_REPEAT_FROM_TO(BOOST_PP_INC(I), N, CRYPTO3_MULX_MAC_STEP, (N, I, x))              \
+    "movq $0, %[lo]\n"                                                                         \
+    "adoxq %[lo], " CRYPTO3_MULX_T(N, I, N) "\n"                                               \
+    "adcxq %[lo], " CRYPTO3_MULX_T(N, I, BOOST_PP_ADD(N, 1)) "\n"                              \
+    "adoxq %[lo], " CRYPTO3_MULX_T(N, I, BOOST_PP_ADD(N, 1)) "\n"                              \
+    "movq " CRYPTO3_MULX_T(N, I, 0) ", " BOOST_PP_STRINGIZE(I) "*8+%[square]\n"                \
+    "xorq " CRYPTO3_MULX_T(N, I, 0) ", " CRYPTO3_MULX_T(N, I, 0) "\n"
+
+// After the last cross product row, words N - 1 to 2 * N - 1 are still in registers.
+#define CRYPTO3_MULX_CROSS_STORE(z, J, N) \
+    "movq " CRYPTO3_MULX_T(N, BOOST_PP_DEC(N), J) ", " BOOST_PP_STRINGIZE(BOOST_PP_ADD(BOOST_PP_DEC(N), J)) "*8+%[square]\n"
+
+// Word K of the square is 2 * square[K] + DIAGONAL, doubled on the CF chain and the diagonal added on the OF chain.
+// The low half stays in registers for the reduction, t[N] serves as scratch for the high half.
+#define CRYPTO3_MULX_DOUBLE_ADD_LOW(N, K, DIAGONAL)              \
+    "movq " BOOST_PP_STRINGIZE(K) "*8+%[square], %[t" BOOST_PP_STRINGIZE(K) "]\n" \
+    "adcxq %[t" BOOST_PP_STRINGIZE(K) "], %[t" BOOST_PP_STRINGIZE(K) "]\n"        \
+    "adoxq " DIAGONAL ", %[t" BOOST_PP_STRINGIZE(K) "]\n"
+
+#define CRYPTO3_MULX_DOUBLE_ADD_HIGH(N, K, DIAGONAL)             \
+    "movq " BOOST_PP_STRINGIZE(K) "*8+%[square], %[t" BOOST_PP_STRINGIZE(N) "]\n" \
+    "adcxq %[t" BOOST_PP_STRINGIZE(N) "], %[t" BOOST_PP_STRINGIZE(N) "]\n"        \
+    "adoxq " DIAGONAL ", %[t" BOOST_PP_STRINGIZE(N) "]\n"                         \
+    "movq %[t" BOOST_PP_STRINGIZE(N) "], " BOOST_PP_STRINGIZE(K) "*8+%[square]\n"
+
+#define CRYPTO3_MULX_DOUBLE_ADD(N, K, DIAGONAL) \
+    BOOST_PP_IIF(BOOST_PP_LESS(K, N), CRYPTO3_MULX_DOUBLE_ADD_LOW, CRYPTO3_MULX_DOUBLE_ADD_HIGH)(N, K, DIAGONAL)
+
+#define CRYPTO3_MULX_DIAGONAL(z, I, N)                                       \
+    "movq " CRYPTO3_MULX_PTR(x, I) ", %%rdx\n"                               \
+    "mulxq %%rdx, %[lo], %[hi]\n"                                            \
+    CRYPTO3_MULX_DOUBLE_ADD(N, BOOST_PP_MUL(I, 2), "%[lo]")                  \
+    CRYPTO3_MULX_DOUBLE_ADD(N, BOOST_PP_INC(BOOST_PP_MUL(I, 2)), "%[hi]")
+
+// Montgomery reduction round of the low half: t = (t + m * mod) / 2^64 with m = t[0] * p_dash.
+#define CRYPTO3_MULX_REDUCE_ROUND(z, I, N)           \
+    "movq " CRYPTO3_MULX_T(N, I, 0) ", %%rdx\n"      \
+    "imulq %[p_dash], %%rdx\n"                       \
+    CRYPTO3_MULX_MAC(N, I, mod)
+
+#define CRYPTO3_MULX_ADD_SQUARE_HIGH(z, J, N) \
+    "adcq " BOOST_PP_STRINGIZE(BOOST_PP_ADD(N, J)) "*8+%[square], " CRYPTO3_MULX_T(N, N, J) "\n"
+
+// The square is built in a 2 * N word buffer: the cross products once, then doubled with the diagonal added.
+// Reducing the low half gives a value of at most mod, and the high half of x^2 < mod^2 is below mod, so their sum
+// needs the same single conditional subtraction as the product.
+#define CRYPTO3_MULX_MONTGOMERY_SQUARE(N)                                                      \
+    LimbType t[N + 2];                                                                         \
+    LimbType square[2 * N];                                                                    \
+    LimbType lo, hi;                                                                           \
+    asm volatile(                                                                              \
+        BOOST_PP_REPEAT(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_ZERO, _)                              \
+        BOOST_PP_REPEAT(BOOST_PP_DEC(N), CRYPTO3_MULX_CROSS_ROUND, N)                          \
+        BOOST_PP_REPEAT(BOOST_PP_INC(N), CRYPTO3_MULX_CROSS_STORE, N)                          \
+        /* the cross sum is below x^2 / 2, neither chain carries out of the top word */        \
+        "xorq %[lo], %[lo]\n"                                                                  \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_DIAGONAL, N)                                           \
+        CRYPTO3_MULX_ZERO(_, N, _)                                                             \
+        CRYPTO3_MULX_ZERO(_, BOOST_PP_INC(N), _)                                               \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_REDUCE_ROUND, N)                                       \
+        "addq " BOOST_PP_STRINGIZE(N) "*8+%[square], " CRYPTO3_MULX_T(N, N, 0) "\n"            \
+        BOOST_PP_REPEAT_FROM_TO(1, N, CRYPTO3_MULX_ADD_SQUARE_HIGH, N)                         \
+        "adcq $0, " CRYPTO3_MULX_T(N, N, N) "\n"                                               \
+        /* t < 2 * mod, subtract mod in place */                                               \
+        "subq " CRYPTO3_MULX_PTR(mod, 0) ", " CRYPTO3_MULX_T(N, N, 0) "\n"                     \
+        BOOST_PP_REPEAT_FROM_TO(1, N, CRYPTO3_MULX_SUBTRACT, N)                                \
+        "sbbq $0, " CRYPTO3_MULX_T(N, N, N) "\n"                                               \
+        "sbbq %[hi], %[hi]\n"                                                                  \
+        "clc\n"                                                                                \
+        BOOST_PP_REPEAT(N, CRYPTO3_MULX_ADD_BACK, N)                                           \
+        : BOOST_PP_ENUM(BOOST_PP_ADD(N, 2), CRYPTO3_MULX_OUTPUT, _),                           \
+          [square] "=m"(square),                                                               \
+          [lo] "=&r"(lo),                                                                      \
+          [hi] "=&r"(hi)                                                                       \
+        : [x] "r"(x),                                                                          \
+          [mod] "r"(mod),                                                                      \
+          [p_dash] "m"(p_dash)                                                                 \
+        : "rdx", "cc", "memory");
+
+// clang-format on
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            /*!
+             * @brief Montgomery multiplication on x86-64 with the BMI2 mulx and the ADX adcx/adox instructions.
+             *
+             * The kernels run CIOS with the whole accumulator kept in registers. Each round adds the partial
+             * product low halves on the OF carry chain and the high halves on the CF carry chain, so the two
+             * chains of additions overlap. Any odd modulus of the limb count is supported, including moduli
+             * using the top bit of the last limb. The final reduction is branch-free.
+             *
+             * The instructions are emitted from inline assembly and need no build flags, so callers have to
+             * check is_supported() before using the kernels.
+             */
+            struct montgomery_mulx_impl {
+                template<std::size_t LimbsCount>
+                constexpr static bool has_kernel() {
+                    return LimbsCount >= 4 && LimbsCount <= 6;
+                }
+
+                static bool is_supported() {
+#if defined(__BMI2__) && defined(__ADX__)
+                    return true;
+#else
+                    static const bool supported = detect();
+                    return supported;
+#endif
+                }
+
+                /*!
+                 * @brief x = x * y / 2^(64 * LimbsCount) mod mod.
+                 *
+                 * Both operands have to be below the modulus and p_dash is -mod^-1 mod 2^64. y may alias x.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                static void mul(LimbType *x, const LimbType *y, const LimbType *mod, LimbType p_dash) {
+                    static_assert(has_kernel<LimbsCount>(), "No mulx Montgomery kernel for this limb count.");
+                    static_assert(sizeof(LimbType) == 8, "The mulx Montgomery kernels work on 64-bit limbs.");
+                    if constexpr (LimbsCount == 4) {
+                        CRYPTO3_MULX_MONTGOMERY_MUL(4)
+                    } else if constexpr (LimbsCount == 5) {
+                        CRYPTO3_MULX_MONTGOMERY_MUL(5)
+                    } else {
+                        CRYPTO3_MULX_MONTGOMERY_MUL(6)
+                    }
+                }
+
+                /*!
+                 * @brief x = x * x / 2^(64 * LimbsCount) mod mod.
+                 *
+                 * Takes the cross products x[i] * x[j], i < j, once and doubles them before adding the limb squares,
+                 * so the square needs N * (N + 1) / 2 limb products instead of N * N before the reduction.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                static void square(LimbType *x, const LimbType *mod, LimbType p_dash) {
+                    static_assert(has_kernel<LimbsCount>(), "No mulx Montgomery kernel for this limb count.");
+                    static_assert(sizeof(LimbType) == 8, "The mulx Montgomery kernels work on 64-bit limbs.");
+                    if constexpr (LimbsCount == 4) {
+                        CRYPTO3_MULX_MONTGOMERY_SQUARE(4)
+                    } else if constexpr (LimbsCount == 5) {
+                        CRYPTO3_MULX_MONTGOMERY_SQUARE(5)
+                    } else {
+                        CRYPTO3_MULX_MONTGOMERY_SQUARE(6)
+                    }
+                }
+
+                /*!
+                 * @brief acc += x * y without reduction, acc having 2 * LimbsCount + 1 limbs.
+                 *
+                 * The carry out of the top limb is dropped, so the caller bounds the number of products. x and y
+                 * may alias each other but not acc.
+                 */
+                template<std::size_t LimbsCount, typename LimbType>
+                static void accumulate(LimbType *acc, const LimbType *x, const LimbType *y) {
+                    static_assert(has_kernel<LimbsCount>(), "No mulx Montgomery kernel for this limb count.");
+                    static_assert(sizeof(LimbType) == 8, "The mulx Montgomery kernels work on 64-bit limbs.");
+                    if constexpr (LimbsCount == 4) {
+                        CRYPTO3_MULX_ACCUMULATE(4)
+                    } else if constexpr (LimbsCount == 5) {
+                        CRYPTO3_MULX_ACCUMULATE(5)
+                    } else {
+                        CRYPTO3_MULX_ACCUMULATE(6)
+                    }
+                }
+
+            private:
+                static bool detect() {
+                    unsigned int eax, ebx, ecx, edx;
+                    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                        return false;
+                    }
+                    return (ebx & bit_BMI2) != 0 && (ebx & bit_ADX) != 0;
+                }
+            };
+        }    // namespace backends
+    }    // namespace multiprecision
+}    // namespace boost
+
+#undef CRYPTO3_MULX_PTR
+#undef CRYPTO3_MULX_T
+#undef CRYPTO3_MULX_MAC_STEP
+#undef CRYPTO3_MULX_MAC
+#undef CRYPTO3_MULX_ROUND
+#undef CRYPTO3_MULX_ZERO
+#undef CRYPTO3_MULX_SUBTRACT
+#undef CRYPTO3_MULX_ADD_BACK
+#undef CRYPTO3_MULX_OUTPUT
+#undef CRYPTO3_MULX_MONTGOMERY_MUL
+#undef CRYPTO3_MULX_PRODUCT_ROUND
+#undef CRYPTO3_MULX_ADD_LOW
+#undef CRYPTO3_MULX_ADD_HIGH
+#undef CRYPTO3_MULX_ACCUMULATE
+#undef CRYPTO3_MULX_CROSS_ROUND
+#undef CRYPTO3_MULX_CROSS_STORE
+#undef CRYPTO3_MULX_DOUBLE_ADD_LOW
+#undef CRYPTO3_MULX_DOUBLE_ADD_HIGH
+#undef CRYPTO3_MULX_DOUBLE_ADD
+#undef CRYPTO3_MULX_DIAGONAL
+#undef CRYPTO3_MULX_REDUCE_ROUND
+#undef CRYPTO3_MULX_ADD_SQUARE_HIGH
+#undef CRYPTO3_MULX_MONTGOMERY_SQUARE
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_MONTGOMERY_MULX_HPP
@@ -0,0 +1,276 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MULTIPRECISION_MODULAR_SAFEGCD_INVERSE_HPP
+#define CRYPTO3_MULTIPRECISION_MODULAR_SAFEGCD_INVERSE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/config.hpp>
+
+namespace boost {
+    namespace multiprecision {
+        namespace backends {
+            /*!
+             * @brief Constant-time modular inversion by divsteps.
+             *
+             * Bernstein-Yang "Fast constant-time gcd computation and modular inversion"
+             * (https://eprint.iacr.org/2019/266), in the batched form of libsecp256k1: 62 divsteps at a time run on
+             * the low 64 bits of f and g and produce a 2x2 transition matrix, which is then applied to the full
+             * f, g and to the Bezout coefficients d, e. Numbers are kept in signed 62-bit limbs so the matrix
+             * application fits 128-bit accumulators and d, e are divided by 2^62 modulo the modulus exactly.
+             *
+             * The number of divsteps is the worst-case bound of the paper for the limb width, so the running
+             * time does not depend on the input.
+             */
+            template<std::size_t LimbsCount>
+            struct safegcd_inverse_impl {
+                typedef std::uint64_t limb_type;
+                typedef std::int64_t signed62_limb_type;
+                typedef boost::int128_type signed_double_limb_type;
+
+                constexpr static const std::size_t bits = LimbsCount * 64;
+                // Enough for any value in (-2 * mod, 2 * mod) in two's complement.
+                constexpr static const std::size_t signed62_limbs_count = bits / 62 + 1;
+                constexpr static const std::size_t divsteps = bits >= 46 ? (49 * bits + 57) / 17 : (49 * bits + 80) / 17;
+                constexpr static const std::size_t batches = (divsteps + 61) / 62;
+
+                constexpr static const signed62_limb_type mask62 = (signed62_limb_type(1) << 62) - 1;
+
+                typedef std::array<signed62_limb_type, signed62_limbs_count> signed62_type;
+
+                struct transition_matrix {
+                    signed62_limb_type u, v, q, r;
+                };
+
+                /*!
+                 * @brief Sets result to x^-1 mod mod, or to zero if x is not invertible.
+                 * @param mod Odd modulus.
+                 * @param mod_inverse mod^-1 mod 2^64.
+                 * x must be below mod and result may alias x.
+                 */
+                template<typename LimbType>
+                constexpr static void inverse(LimbType *result, const LimbType *x, const LimbType *mod,
+                                              LimbType mod_inverse) {
+                    static_assert(sizeof(LimbType) == sizeof(limb_type), "Divsteps inversion needs 64-bit limbs.");
+
+                    const signed62_type m = to_signed62(mod);
+                    const signed62_limb_type m_inverse62 = static_cast<signed62_limb_type>(mod_inverse) & mask62;
+                    signed62_type f = m, g = to_signed62(x), d = {}, e = {};
+                    e[0] = 1;
+                    signed62_limb_type delta = 1;
+
+                    for (std::size_t i = 0; i < batches; ++i) {
+                        const transition_matrix t = divsteps_62(delta, low_bits(f), low_bits(g));
+                        update_fg(f, g, t);
+                        update_de(d, e, t, m, m_inverse62);
+                    }
+
+                    // Now f = +-gcd(x, mod) and d * x = f modulo mod. Bring d from (-2 * mod, mod) to [0, mod)
+                    // with the sign of f applied.
+                    const signed62_limb_type f_sign = f[signed62_limbs_count - 1] >> 63;
+                    conditional_add(d, m, d[signed62_limbs_count - 1] >> 63);
+                    conditional_negate(d, f_sign);
+                    conditional_add(d, m, d[signed62_limbs_count - 1] >> 63);
+
+                    // Non-invertible input leaves |f| > 1, the result is zeroed then.
+                    conditional_negate(f, f_sign);
+                    signed62_limb_type not_one = f[0] ^ 1;
+                    for (std::size_t i = 1; i < signed62_limbs_count; ++i) {
+                        not_one |= f[i];
+                    }
+                    const signed62_limb_type keep = ((not_one | -not_one) >> 63) ^ -1;
+                    for (std::size_t i = 0; i < signed62_limbs_count; ++i) {
+                        d[i] &= keep;
+                    }
+
+                    from_signed62(result, d);
+                }
+
+            private:
+                template<typename LimbType>
+                constexpr static signed62_type to_signed62(const LimbType *a) {
+                    signed62_type out = {};
+                    for (std::size_t i = 0; i < signed62_limbs_count; ++i) {
+                        const std::size_t bit = 62 * i, limb = bit / 64, shift = bit % 64;
+                        limb_type value = limb < LimbsCount ? static_cast<limb_type>(a[limb]) >> shift : 0;
+                        if (shift > 2 && limb + 1 < LimbsCount) {
+                            value |= static_cast<limb_type>(a[limb + 1]) << (64 - shift);
+                        }
+                        out[i] = static_cast<signed62_limb_type>(value) & mask62;
+                    }
+                    return out;
+                }
+
+                // a must be normalized and non-negative.
+                template<typename LimbType>
+                constexpr static void from_signed62(LimbType *out, const signed62_type &a) {
+                    for (std::size_t limb = 0; limb < LimbsCount; ++limb) {
+                        const std::size_t bit = 64 * limb, i = bit / 62, shift = bit % 62;
+                        limb_type value = static_cast<limb_type>(a[i]) >> shift;
+                        if (i + 1 < signed62_limbs_count) {
+                            value |= static_cast<limb_type>(a[i + 1]) << (62 - shift);
+                        }
+                        if (shift > 60 && i + 2 < signed62_limbs_count) {
+                            value |= static_cast<limb_type>(a[i + 2]) << (124 - shift);
+                        }
+                        out[limb] = static_cast<LimbType>(value);
+                    }
+                }
+
+                constexpr static limb_type low_bits(const signed62_type &a) {
+                    return static_cast<limb_type>(a[0]) | (static_cast<limb_type>(a[1]) << 62);
+                }
+
+                // 62 divsteps on the low bits of f and g. Each step is
+                //   delta > 0 and g odd: (delta, f, g) = (1 - delta, g, (g - f) / 2),
+                //   otherwise:            (delta, f, g) = (1 + delta, f, (g + (g mod 2) * f) / 2),
+                // with the rows of the matrix doubled instead of halved so that its entries stay integers.
+                constexpr static transition_matrix divsteps_62(signed62_limb_type &delta, limb_type f, limb_type g) {
+                    signed62_limb_type u = 1, v = 0, q = 0, r = 1;
+                    for (std::size_t i = 0; i < 62; ++i) {
+                        const signed62_limb_type g_odd = -static_cast<signed62_limb_type>(g & 1);
+                        const signed62_limb_type swap = (-delta >> 63) & g_odd;
+
+                        // (f, g, u, v, q, r, delta) = (g, -f, q, r, -u, -v, -delta)
+                        const limb_type fg = (f ^ g) & static_cast<limb_type>(swap);
+                        f ^= fg;
+                        g ^= fg;
+                        g = (g ^ static_cast<limb_type>(swap)) - static_cast<limb_type>(swap);
+                        const signed62_limb_type uq = (u ^ q) & swap, vr = (v ^ r) & swap;
+                        u ^= uq;
+                        q ^= uq;
+                        v ^= vr;
+                        r ^= vr;
+                        q = (q ^ swap) - swap;
+                        r = (r ^ swap) - swap;
+                        delta = (delta ^ swap) - swap;
+
+                        g += f & static_cast<limb_type>(g_odd);
+                        q += u & g_odd;
+                        r += v & g_odd;
+
+                        g >>= 1;
+                        u *= 2;
+                        v *= 2;
+                        ++delta;
+                    }
+                    return {u, v, q, r};
+                }
+
+                // (f, g) = t * (f, g) / 2^62, the division is exact.
+                constexpr static void update_fg(signed62_type &f, signed62_type &g, const transition_matrix &t) {
+                    signed_double_limb_type cf = static_cast<signed_double_limb_type>(t.u) * f[0] +
+                                                 static_cast<signed_double_limb_type>(t.v) * g[0];
+                    signed_double_limb_type cg = static_cast<signed_double_limb_type>(t.q) * f[0] +
+                                                 static_cast<signed_double_limb_type>(t.r) * g[0];
+                    cf >>= 62;
+                    cg >>= 62;
+                    for (std::size_t i = 1; i < signed62_limbs_count; ++i) {
+                        cf += static_cast<signed_double_limb_type>(t.u) * f[i] +
+                              static_cast<signed_double_limb_type>(t.v) * g[i];
+                        cg += static_cast<signed_double_limb_type>(t.q) * f[i] +
+                              static_cast<signed_double_limb_type>(t.r) * g[i];
+                        f[i - 1] = static_cast<signed62_limb_type>(cf) & mask62;
+                        g[i - 1] = static_cast<signed62_limb_type>(cg) & mask62;
+                        cf >>= 62;
+                        cg >>= 62;
+                    }
+                    f[signed62_limbs_count - 1] = static_cast<signed62_limb_type>(cf);
+                    g[signed62_limbs_count - 1] = static_cast<signed62_limb_type>(cg);
+                }
+
+                // (d, e) = t * (d, e) / 2^62 modulo m. A multiple of m is added to make the division exact; its
+                // choice keeps d and e in (-2 * m, m) when they start there.
+                constexpr static void update_de(signed62_type &d, signed62_type &e, const transition_matrix &t,
+                                                const signed62_type &m, signed62_limb_type m_inverse62) {
+                    const signed62_limb_type d_sign = d[signed62_limbs_count - 1] >> 63;
+                    const signed62_limb_type e_sign = e[signed62_limbs_count - 1] >> 63;
+                    signed62_limb_type md = (t.u & d_sign) + (t.v & e_sign);
+                    signed62_limb_type me = (t.q & d_sign) + (t.r & e_sign);
+
+                    signed_double_limb_type cd = static_cast<signed_double_limb_type>(t.u) * d[0] +
+                                                 static_cast<signed_double_limb_type>(t.v) * e[0];
+                    signed_double_limb_type ce = static_cast<signed_double_limb_type>(t.q) * d[0] +
+                                                 static_cast<signed_double_limb_type>(t.r) * e[0];
+                    md -= static_cast<signed62_limb_type>(
+                              (static_cast<limb_type>(m_inverse62) * static_cast<limb_type>(cd) +
+                               static_cast<limb_type>(md)) &
+                              static_cast<limb_type>(mask62));
+                    me -= static_cast<signed62_limb_type>(
+                              (static_cast<limb_type>(m_inverse62) * static_cast<limb_type>(ce) +
+                               static_cast<limb_type>(me)) &
+                              static_cast<limb_type>(mask62));
+                    cd += static_cast<signed_double_limb_type>(m[0]) * md;
+                    ce += static_cast<signed_double_limb_type>(m[0]) * me;
+                    cd >>= 62;
+                    ce >>= 62;
+                    for (std::size_t i = 1; i < signed62_limbs_count; ++i) {
+                        cd += static_cast<signed_double_limb_type>(t.u) * d[i] +
+                              static_cast<signed_double_limb_type>(t.v) * e[i] +
+                              static_cast<signed_double_limb_type>(m[i]) * md;
+                        ce += static_cast<signed_double_limb_type>(t.q) * d[i] +
+                              static_cast<signed_double_limb_type>(t.r) * e[i] +
+                              static_cast<signed_double_limb_type>(m[i]) * me;
+                        d[i - 1] = static_cast<signed62_limb_type>(cd) & mask62;
+                        e[i - 1] = static_cast<signed62_limb_type>(ce) & mask62;
+                        cd >>= 62;
+                        ce >>= 62;
+                    }
+                    d[signed62_limbs_count - 1] = static_cast<signed62_limb_type>(cd);
+                    e[signed62_limbs_count - 1] = static_cast<signed62_limb_type>(ce);
+                }
+
+                // a += m when mask is all ones, a is renormalized either way.
+                constexpr static void conditional_add(signed62_type &a, const signed62_type &m,
+                                                      signed62_limb_type mask) {
+                    for (std::size_t i = 0; i < signed62_limbs_count; ++i) {
+                        a[i] += m[i] & mask;
+                    }
+                    normalize(a);
+                }
+
+                // a = -a when mask is all ones, a is renormalized either way.
+                constexpr static void conditional_negate(signed62_type &a, signed62_limb_type mask) {
+                    for (std::size_t i = 0; i < signed62_limbs_count; ++i) {
+                        a[i] = (a[i] ^ mask) - mask;
+                    }
+                    normalize(a);
+                }
+
+                constexpr static void normalize(signed62_type &a) {
+                    for (std::size_t i = 0; i + 1 < signed62_limbs_count; ++i) {
+                        a[i + 1] += a[i] >> 62;
+                        a[i] &= mask62;
+                    }
+                }
+            };
+        }    // namespace backends
+    }    // namespace multiprecision
+}    // namespace boost
+
+#endif    // CRYPTO3_MULTIPRECISION_MODULAR_SAFEGCD_INVERSE_HPP
@@ -81,6 +81,75 @@ BOOST_AUTO_TEST_CASE(modular_adaptor_montgomery_mult_perf_test) {
               << std::dec << elapsed.count() / SAMPLES << " ns" << std::endl;
 }
 
+// This directly calls montgomery_square from modular_functions_fixed.hpp.
+BOOST_AUTO_TEST_CASE(modular_adaptor_montgomery_square_perf_test) {
+    using Backend = cpp_int_modular_backend<256>;
+    using standart_number = boost::multiprecision::number<Backend>;
+    using params_safe_type = modular_params_rt<Backend>;
+    using modular_backend = modular_adaptor<Backend, params_safe_type>;
+    using modular_number = boost::multiprecision::number<modular_backend>;
+    constexpr standart_number modulus =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular256;
+    constexpr standart_number x_value =
+        0xb5d724ce6f44c3c587867bbcb417e9eb6fa05e7e2ef029166568f14eb3161387_cppui_modular256;
+    constexpr modular_number x(modular_backend(x_value.backend(), modulus.backend()));
+    auto x_modular = x.backend();
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+
+    int SAMPLES = 10000000;
+    auto mod_object = x_modular.mod_data().get_mod_obj();
+    auto base_data = x_modular.base_data();
+    for (int i = 0; i < SAMPLES; ++i) {
+        mod_object.montgomery_square(
+            base_data,
+            std::integral_constant<bool,
+                                   boost::multiprecision::backends::is_trivial_cpp_int_modular<Backend>::value>());
+    }
+
+    std::cout << base_data << std::endl;
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Squaring time (when montgomery_square is called directly): " << std::fixed << std::setprecision(3)
+              << std::dec << elapsed.count() / SAMPLES << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(modular_adaptor_backend_square_perf_test) {
+    using Backend = cpp_int_modular_backend<256>;
+    using standart_number = boost::multiprecision::number<Backend>;
+    using params_safe_type = modular_params_rt<Backend>;
+    using modular_backend = modular_adaptor<Backend, params_safe_type>;
+    using modular_number = boost::multiprecision::number<modular_backend>;
+    constexpr standart_number modulus =
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_cppui_modular256;
+    constexpr standart_number x_value =
+        0xb5d724ce6f44c3c587867bbcb417e9eb6fa05e7e2ef029166568f14eb3161387_cppui_modular256;
+    constexpr modular_number x(modular_backend(x_value.backend(), modulus.backend()));
+    auto x_square = x.backend();
+    auto x_multiply = x.backend();
+
+    int SAMPLES = 10000000;
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        eval_square(x_square);
+    }
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Squaring time (when called from modular adaptor): " << std::fixed << std::setprecision(3)
+              << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        eval_multiply(x_multiply, x_multiply);
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Squaring time (when eval_multiply(x, x) is called): " << std::fixed << std::setprecision(3)
+              << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(x_square.compare(x_multiply) == 0);
+    // Print something so the whole computation is not optimized out.
+    std::cout << x_square << std::endl;
+}
+
 BOOST_AUTO_TEST_CASE(modular_adaptor_backend_sub_perf_test) {
     using namespace boost::multiprecision::default_ops;
 
@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/multiprecision/cpp_int_modular/literals.hpp>
 
+#include <random>
+
 using namespace boost::multiprecision;
 
 template<typename T>
@@ -208,6 +210,68 @@ BOOST_AUTO_TEST_CASE(inverse_tests) {
     // test_inverse_extended_euclidean_algorithm<boost::multiprecision::cpp_int_modular>();
 }
 
+template<unsigned Bits>
+void test_modular_adaptor_fixed_inverse(const char *modulus_text) {
+    using T = cpp_int_modular_backend<Bits>;
+    using modular_backend = backends::modular_adaptor<T, backends::modular_params_rt<T>>;
+    using modular_number = number<modular_backend>;
+
+    const cpp_int modulus(modulus_text);
+    const number<T> modulus_number(modulus_text);
+    std::mt19937_64 rng(Bits);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        cpp_int x = 0;
+        for (std::size_t j = 0; j < T::internal_limb_count; ++j) {
+            x = (x << 64) + rng();
+        }
+        x %= modulus;
+        if (i < 3) {
+            x = i == 0 ? cpp_int(1) : modulus - i + 1;
+        }
+        const modular_number value(modular_backend(number<T>(x.str()).backend(), modulus_number.backend()));
+        number<T> inverse;
+        value.backend().mod_data().adjust_regular(inverse.backend(), inverse_mod(value).backend().base_data());
+        BOOST_CHECK_EQUAL((x * cpp_int(inverse.str())) % modulus, 1);
+    }
+
+    const modular_number zero(modular_backend(number<T>("0").backend(), modulus_number.backend()));
+    BOOST_CHECK_EQUAL(inverse_mod(zero), zero);
+}
+
+BOOST_AUTO_TEST_CASE(modular_adaptor_fixed_inverse_test) {
+    test_modular_adaptor_fixed_inverse<130>("0x3fffffffffffffffffffffffffffffffb");
+    test_modular_adaptor_fixed_inverse<255>(
+        "0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001");
+    test_modular_adaptor_fixed_inverse<256>(
+        "0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f");
+    test_modular_adaptor_fixed_inverse<381>(
+        "0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab");
+    test_modular_adaptor_fixed_inverse<521>(
+        "0x1fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+        "fffffffffffffffffffffffffffffffff");
+
+    // Elements sharing a factor with the modulus have no inverse.
+    using T = cpp_int_modular_backend<256>;
+    using modular_backend = backends::modular_adaptor<T, backends::modular_params_rt<T>>;
+    using modular_number = number<modular_backend>;
+    const number<T> modulus = 0x230000000000000023_cppui_modular256;    // 35 * (2^64 + 1)
+    const modular_number value(modular_backend((0x15_cppui_modular256).backend(), modulus.backend()));
+    BOOST_CHECK_EQUAL(inverse_mod(value), modular_number(modular_backend((0x0_cppui_modular256).backend(), modulus.backend())));
+}
+
+BOOST_AUTO_TEST_CASE(modular_adaptor_fixed_constexpr_inverse_test) {
+    using T = cpp_int_modular_backend<255>;
+    using modular_backend = backends::modular_adaptor<T, backends::modular_params_rt<T>>;
+    using modular_number = number<modular_backend>;
+
+    constexpr auto modulus = 0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001_cppui_modular255;
+    constexpr modular_number value(modular_backend((0x1234567890abcdef_cppui_modular255).backend(), modulus.backend()));
+    constexpr modular_number one(modular_backend((0x1_cppui_modular255).backend(), modulus.backend()));
+    constexpr modular_number inverse = inverse_mod(value);
+    static_assert(inverse * value == one, "inverse error");
+    BOOST_CHECK(inverse * value == one);
+}
+
 BOOST_AUTO_TEST_CASE(test_cpp_int_modular_backend_6_bits) {
     using namespace boost::multiprecision;
     using T = cpp_int_modular_backend<6>;
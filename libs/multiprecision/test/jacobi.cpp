@@ -21,6 +21,8 @@
 
 #include <nil/crypto3/multiprecision/jacobi.hpp>
 
+#include <random>
+
 template<typename T, std::size_t N>
 T decimal_number(const char (&decimal)[N]) {
     T result = 0u;
@@ -64,6 +66,30 @@ void test() {
         -1);
 }
 
+// The fixed-size backends have their own limb-level algorithm, check it against the cpp_int one.
+template<unsigned Bits>
+void test_fixed_against_cpp_int(const char *n_text) {
+    using namespace boost::multiprecision;
+    using T = number<backends::cpp_int_modular_backend<Bits>>;
+
+    const cpp_int n(n_text);
+    std::mt19937_64 rng(Bits);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        cpp_int a = 0;
+        for (std::size_t j = 0; j < Bits / 64 + 1; ++j) {
+            a = (a << 64) + rng();
+        }
+        a &= (cpp_int(1) << Bits) - 1;
+        if (i % 2 == 0) {
+            a %= n;
+        }
+        if (i % 5 == 0) {
+            a = (a * a) % n;
+        }
+        BOOST_CHECK_EQUAL(jacobi(T(a.str()), T(n_text)), jacobi(a, n));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(jacobi_tests)
 
 BOOST_AUTO_TEST_CASE(jacobi_test) {
@@ -76,4 +102,14 @@ BOOST_AUTO_TEST_CASE(jacobi_test) {
     static_assert(jacobi(a, b) == -1, "jacobi error");
 }
 
+BOOST_AUTO_TEST_CASE(jacobi_fixed_test) {
+    test_fixed_against_cpp_int<130>("0x3fffffffffffffffffffffffffffffffb");
+    test_fixed_against_cpp_int<256>("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f");
+    test_fixed_against_cpp_int<381>(
+        "0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaaab");
+    // Composite moduli give 0 on common factors.
+    test_fixed_against_cpp_int<256>("0x230000000000000023");
+    test_fixed_against_cpp_int<256>("0x1ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE montgomery_ifma_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <ios>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_ifma.hpp>
+
+#ifdef CRYPTO3_MULTIPRECISION_IFMA_KERNELS
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::limb_type;
+using boost::multiprecision::backends::cpp_int_modular_backend;
+using boost::multiprecision::backends::montgomery_ifma_impl;
+
+namespace {
+    cpp_int to_cpp_int(const limb_type *limbs, std::size_t limbs_count) {
+        cpp_int result = 0;
+        for (std::size_t i = limbs_count; i-- > 0;) {
+            result <<= 64;
+            result += limbs[i];
+        }
+        return result;
+    }
+
+    void from_cpp_int(limb_type *limbs, std::size_t limbs_count, const cpp_int &value) {
+        for (std::size_t i = 0; i < limbs_count; ++i) {
+            limbs[i] = static_cast<limb_type>(value >> (64 * i));
+        }
+    }
+
+    template<unsigned Bits>
+    void check_ifma(const char *modulus_text) {
+        constexpr std::size_t limbs = cpp_int_modular_backend<Bits>::internal_limb_count;
+        static_assert(montgomery_ifma_impl::has_kernel<limbs>());
+        // Elements are padded by one limb to check the strides, 203 leaves a partial block of lanes.
+        constexpr std::size_t stride = limbs + 1;
+        constexpr std::size_t n = 203;
+
+        const cpp_int modulus(modulus_text);
+        std::vector<limb_type> modulus_limbs(limbs);
+        from_cpp_int(modulus_limbs.data(), limbs, modulus);
+        const montgomery_ifma_impl::params<limbs> params(modulus_limbs.data());
+        const cpp_int r = cpp_int(1) << (64 * limbs);
+
+        std::mt19937_64 rng(Bits);
+        auto random_element = [&]() {
+            cpp_int value = 0;
+            for (std::size_t i = 0; i < limbs; ++i) {
+                value = (value << 64) + rng();
+            }
+            return cpp_int(value % modulus);
+        };
+
+        std::vector<cpp_int> a(n), b(n), c(n);
+        std::vector<limb_type> a_limbs(n * stride), b_limbs(n * stride), c_limbs(n * stride);
+        for (std::size_t i = 0; i < n; ++i) {
+            // Operands right below the modulus maximize every partial product.
+            a[i] = i % 10 == 0 ? cpp_int(modulus - 1 - i) : random_element();
+            b[i] = i % 10 == 1 ? cpp_int(modulus - 1) : random_element();
+            c[i] = i % 10 == 2 ? cpp_int(modulus - 1) : random_element();
+            from_cpp_int(&a_limbs[i * stride], limbs, a[i]);
+            from_cpp_int(&b_limbs[i * stride], limbs, b[i]);
+            from_cpp_int(&c_limbs[i * stride], limbs, c[i]);
+        }
+
+        std::vector<limb_type> result(n * stride);
+        montgomery_ifma_impl::mul_n<limbs>(result.data(), stride, a_limbs.data(), stride, b_limbs.data(), stride, n,
+                                           params);
+        for (std::size_t i = 0; i < n; ++i) {
+            const cpp_int product = to_cpp_int(&result[i * stride], limbs);
+            BOOST_CHECK(product < modulus);
+            BOOST_CHECK_EQUAL(product * r % modulus, a[i] * b[i] % modulus);
+        }
+
+        montgomery_ifma_impl::mul_n<limbs>(result.data(), stride, a_limbs.data(), stride, b_limbs.data(), 0, n,
+                                           params);
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_CHECK_EQUAL(to_cpp_int(&result[i * stride], limbs) * r % modulus, a[i] * b[0] % modulus);
+        }
+
+        result = c_limbs;
+        montgomery_ifma_impl::fma_n<limbs>(result.data(), stride, a_limbs.data(), stride, b_limbs.data(), stride, n,
+                                           params);
+        for (std::size_t i = 0; i < n; ++i) {
+            const cpp_int sum = to_cpp_int(&result[i * stride], limbs);
+            BOOST_CHECK(sum < modulus);
+            BOOST_CHECK_EQUAL((sum + modulus - c[i]) * r % modulus, a[i] * b[i] % modulus);
+        }
+
+        std::vector<limb_type> u_limbs = c_limbs, v_limbs = a_limbs;
+        montgomery_ifma_impl::butterfly_n<limbs>(u_limbs.data(), stride, v_limbs.data(), stride, b_limbs.data(),
+                                                 stride, n, params);
+        for (std::size_t i = 0; i < n; ++i) {
+            const cpp_int u = to_cpp_int(&u_limbs[i * stride], limbs);
+            const cpp_int v = to_cpp_int(&v_limbs[i * stride], limbs);
+            BOOST_CHECK(u < modulus && v < modulus);
+            BOOST_CHECK_EQUAL((u + modulus - c[i]) * r % modulus, a[i] * b[i] % modulus);
+            BOOST_CHECK_EQUAL((c[i] + modulus - v) * r % modulus, a[i] * b[i] % modulus);
+        }
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(montgomery_ifma_test_suite)
+
+BOOST_AUTO_TEST_CASE(four_limbs) {
+    if (!montgomery_ifma_impl::is_supported()) {
+        return;
+    }
+    check_ifma<254>("0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47");
+    check_ifma<256>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+}
+
+BOOST_AUTO_TEST_CASE(five_limbs) {
+    if (!montgomery_ifma_impl::is_supported()) {
+        return;
+    }
+    check_ifma<298>("0x3BCF7BCD473A266249DA7B0548ECAEEC9635D1330EA41A9E35E51200E12C90CD65A71660001");
+    check_ifma<320>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF3B");
+}
+
+BOOST_AUTO_TEST_CASE(six_limbs) {
+    if (!montgomery_ifma_impl::is_supported()) {
+        return;
+    }
+    check_ifma<381>("0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB");
+    check_ifma<384>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#else
+
+BOOST_AUTO_TEST_CASE(montgomery_ifma_not_selected) {
+    BOOST_TEST_MESSAGE("The IFMA Montgomery kernels are not available on this platform.");
+}
+
+#endif
@@ -12,6 +12,7 @@
 
 #include <cstddef>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <boost/multiprecision/number.hpp>
@@ -48,6 +49,38 @@ namespace {
         params.get_mod_obj().montgomery_inner_product(actual, left.begin(), left.end(), right.begin());
         BOOST_CHECK_EQUAL(actual.compare(expected), 0);
     }
+
+    template<unsigned Bits>
+    void check_accumulator(const char *modulus_text, std::size_t count) {
+        using backend_type = cpp_int_modular_backend<Bits>;
+        using number_type = boost::multiprecision::number<backend_type>;
+
+        const number_type modulus(modulus_text);
+        modular_params<backend_type> params(modulus.backend());
+        const auto &mod_obj = params.get_mod_obj();
+
+        typename std::decay_t<decltype(mod_obj)>::montgomery_accumulator_type accumulator;
+        backend_type expected;
+        for (std::size_t i = 0; i < count; ++i) {
+            const backend_type left = number_type(modulus - static_cast<std::size_t>(i % 13 + 1)).backend();
+            const backend_type right = number_type(modulus - static_cast<std::size_t>(i % 7 + 1)).backend();
+
+            mod_obj.montgomery_accumulate(accumulator, left, right);
+            backend_type product(left);
+            params.mod_mul(product, right);
+            params.mod_add(expected, product);
+
+            // Residues added as they are, as in a linear layer with a round constant.
+            if (i % 3 == 0) {
+                mod_obj.montgomery_accumulate(accumulator, left);
+                params.mod_add(expected, left);
+            }
+        }
+
+        backend_type actual;
+        mod_obj.montgomery_reduce_accumulator(actual, accumulator);
+        BOOST_CHECK_EQUAL(actual.compare(expected), 0);
+    }
 }    // namespace
 
 BOOST_AUTO_TEST_SUITE(montgomery_inner_product_test_suite)
@@ -76,4 +109,13 @@ BOOST_AUTO_TEST_CASE(trivial_backend_matches_eager_accumulation) {
     check_inner_product<31>("0x7FFFFFE7", 19);
 }
 
+BOOST_AUTO_TEST_CASE(accumulator_matches_eager_accumulation) {
+    check_accumulator<254>("0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47", 3);
+    check_accumulator<254>("0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47", 200);
+    check_accumulator<256>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF43", 16);
+    check_accumulator<381>(
+        "0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB", 12);
+    check_accumulator<130>("0x3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB", 40);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE montgomery_mulx_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <ios>
+#include <random>
+#include <string>
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_params_fixed.hpp>
+
+#ifdef CRYPTO3_MULTIPRECISION_MONTGOMERY_MULX_SELECTED
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::backends::cpp_int_modular_backend;
+using boost::multiprecision::backends::modular_params;
+using boost::multiprecision::backends::montgomery_mulx_impl;
+
+namespace {
+    template<unsigned Bits>
+    cpp_int to_cpp_int(const cpp_int_modular_backend<Bits> &value) {
+        cpp_int result = 0;
+        for (std::size_t i = value.size(); i-- > 0;) {
+            result <<= 64;
+            result += value.limbs()[i];
+        }
+        return result;
+    }
+
+    template<unsigned Bits>
+    cpp_int_modular_backend<Bits> from_cpp_int(const cpp_int &value) {
+        using number_type = boost::multiprecision::number<cpp_int_modular_backend<Bits>>;
+        return number_type("0x" + value.str(0, std::ios_base::hex)).backend();
+    }
+
+    template<unsigned Bits>
+    void check_mulx(const char *modulus_text) {
+        using backend_type = cpp_int_modular_backend<Bits>;
+        constexpr std::size_t limbs = backend_type::internal_limb_count;
+        static_assert(montgomery_mulx_impl::has_kernel<limbs>());
+
+        const cpp_int modulus(modulus_text);
+        const backend_type modulus_backend = from_cpp_int<Bits>(modulus);
+        modular_params<backend_type> params(modulus_backend);
+        const auto &mod_obj = params.get_mod_obj();
+        const cpp_int r = cpp_int(1) << (64 * limbs);
+
+        std::mt19937_64 rng(Bits);
+        auto random_element = [&]() {
+            cpp_int value = 0;
+            for (std::size_t i = 0; i < limbs; ++i) {
+                value = (value << 64) + rng();
+            }
+            return cpp_int(value % modulus);
+        };
+
+        for (std::size_t i = 0; i < 1000; ++i) {
+            // Operands right below the modulus maximize every partial product.
+            const cpp_int x = i % 10 == 0 ? cpp_int(modulus - 1 - i) : random_element();
+            const cpp_int y = i % 10 == 1 ? cpp_int(modulus - 1) : random_element();
+
+            backend_type product = from_cpp_int<Bits>(x);
+            const backend_type multiplier = from_cpp_int<Bits>(y);
+            montgomery_mulx_impl::mul<limbs>(product.limbs(), multiplier.limbs(), modulus_backend.limbs(),
+                                             mod_obj.get_p_dash());
+            const cpp_int result = to_cpp_int(product);
+            BOOST_CHECK(result < modulus);
+            BOOST_CHECK_EQUAL(result * r % modulus, x * y % modulus);
+
+            backend_type square = from_cpp_int<Bits>(x);
+            montgomery_mulx_impl::mul<limbs>(square.limbs(), square.limbs(), modulus_backend.limbs(),
+                                             mod_obj.get_p_dash());
+            BOOST_CHECK_EQUAL(to_cpp_int(square) * r % modulus, x * x % modulus);
+
+            backend_type kernel_square = from_cpp_int<Bits>(x);
+            montgomery_mulx_impl::square<limbs>(kernel_square.limbs(), modulus_backend.limbs(), mod_obj.get_p_dash());
+            BOOST_CHECK_EQUAL(to_cpp_int(kernel_square), to_cpp_int(square));
+        }
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(montgomery_mulx_test_suite)
+
+BOOST_AUTO_TEST_CASE(four_limbs_spare_bit) {
+    if (!montgomery_mulx_impl::is_supported()) {
+        return;
+    }
+    check_mulx<254>("0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47");
+}
+
+BOOST_AUTO_TEST_CASE(four_limbs_full_width) {
+    if (!montgomery_mulx_impl::is_supported()) {
+        return;
+    }
+    check_mulx<256>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+}
+
+BOOST_AUTO_TEST_CASE(five_limbs) {
+    if (!montgomery_mulx_impl::is_supported()) {
+        return;
+    }
+    check_mulx<298>("0x3BCF7BCD473A266249DA7B0548ECAEEC9635D1330EA41A9E35E51200E12C90CD65A71660001");
+    check_mulx<320>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF3B");
+}
+
+BOOST_AUTO_TEST_CASE(six_limbs) {
+    if (!montgomery_mulx_impl::is_supported()) {
+        return;
+    }
+    check_mulx<381>("0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB");
+    check_mulx<384>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF");
+}
+
+BOOST_AUTO_TEST_CASE(modular_params_use_mulx) {
+    // mod_mul and mod_square go through the kernels on capable CPUs and through the portable code otherwise, the
+    // results are the same.
+    using backend_type = cpp_int_modular_backend<256>;
+    const cpp_int modulus("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
+    modular_params<backend_type> params(from_cpp_int<256>(modulus));
+    const cpp_int x("0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798");
+    const cpp_int y("0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8");
+
+    backend_type x_montgomery = from_cpp_int<256>(x);
+    backend_type y_montgomery = from_cpp_int<256>(y);
+    params.adjust_modular(x_montgomery);
+    params.adjust_modular(y_montgomery);
+    backend_type x_square = x_montgomery;
+    params.mod_mul(x_montgomery, y_montgomery);
+    backend_type product;
+    params.adjust_regular(product, x_montgomery);
+    BOOST_CHECK_EQUAL(to_cpp_int(product), x * y % modulus);
+
+    params.mod_square(x_square);
+    backend_type square;
+    params.adjust_regular(square, x_square);
+    BOOST_CHECK_EQUAL(to_cpp_int(square), x * x % modulus);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#else
+
+BOOST_AUTO_TEST_CASE(montgomery_mulx_not_selected) {
+    BOOST_TEST_MESSAGE("The mulx Montgomery kernels are not available on this platform.");
+}
+
+#endif
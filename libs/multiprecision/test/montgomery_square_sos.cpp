@@ -0,0 +1,126 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE montgomery_square_sos_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <ios>
+#include <random>
+#include <string>
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_params_fixed.hpp>
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::backends::cpp_int_modular_backend;
+using boost::multiprecision::backends::modular_params;
+
+namespace {
+    template<unsigned Bits>
+    cpp_int to_cpp_int(const cpp_int_modular_backend<Bits> &value) {
+        cpp_int result = 0;
+        for (std::size_t i = value.size(); i-- > 0;) {
+            result <<= cpp_int_modular_backend<Bits>::limb_bits;
+            result += value.limbs()[i];
+        }
+        return result;
+    }
+
+    template<unsigned Bits>
+    cpp_int_modular_backend<Bits> from_cpp_int(const cpp_int &value) {
+        using number_type = boost::multiprecision::number<cpp_int_modular_backend<Bits>>;
+        return number_type("0x" + value.str(0, std::ios_base::hex)).backend();
+    }
+
+    // Squares through montgomery_square_SOS_impl directly, so the portable kernel is covered even where
+    // montgomery_square dispatches to the mulx one, and checks it against mod_mul(x, x) and x^2 / R mod p.
+    // Moduli up to the double limb width use the trivial backend, which never reaches this kernel.
+    template<unsigned Bits>
+    void check_square_sos(const char *modulus_text) {
+        using backend_type = cpp_int_modular_backend<Bits>;
+        constexpr std::size_t limbs = backend_type::internal_limb_count;
+
+        const cpp_int modulus(modulus_text);
+        modular_params<backend_type> params(from_cpp_int<Bits>(modulus));
+        const auto &mod_obj = params.get_mod_obj();
+        const cpp_int r = cpp_int(1) << (backend_type::limb_bits * limbs);
+
+        std::mt19937_64 rng(Bits);
+        auto random_element = [&]() {
+            cpp_int value = 0;
+            for (std::size_t i = 0; i < limbs; ++i) {
+                value = (value << backend_type::limb_bits) + rng();
+            }
+            return cpp_int(value % modulus);
+        };
+
+        for (std::size_t i = 0; i < 1000; ++i) {
+            // Operands right below the modulus maximize every cross product and the doubling carry.
+            const cpp_int x = i % 10 == 0 ? cpp_int(modulus - 1 - i) : i == 1 ? cpp_int(0) : random_element();
+            const backend_type operand = from_cpp_int<Bits>(x);
+
+            backend_type expected(operand);
+            params.mod_mul(expected, operand);
+
+            backend_type square(operand);
+            mod_obj.montgomery_square_SOS_impl(square);
+            BOOST_CHECK_EQUAL(square.compare(expected), 0);
+
+            const cpp_int result = to_cpp_int(square);
+            BOOST_CHECK(result < modulus);
+            BOOST_CHECK_EQUAL(result * r % modulus, x * x % modulus);
+        }
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(montgomery_square_sos_test_suite)
+
+BOOST_AUTO_TEST_CASE(square_sos_3_limbs) {
+    check_square_sos<192>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF13");
+    check_square_sos<130>("0x3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_4_limbs) {
+    check_square_sos<256>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF43");
+    check_square_sos<254>("0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD47");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_5_limbs) {
+    check_square_sos<320>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF3B");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_6_limbs) {
+    check_square_sos<384>(
+        "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF");
+    check_square_sos<381>(
+        "0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAB");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_7_limbs) {
+    check_square_sos<448>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                          "FFFFFFFFFF");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_8_limbs) {
+    check_square_sos<512>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                          "FFFFFFFFFFFFFFFFFFFFFFFFFFFDC7");
+}
+
+BOOST_AUTO_TEST_CASE(square_sos_9_limbs) {
+    check_square_sos<521>("0x1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                          "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    check_square_sos<576>("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"
+                          "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
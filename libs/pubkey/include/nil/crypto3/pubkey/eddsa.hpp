@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/detail/constant_time_scalar_mul.hpp>
 
 #include <nil/crypto3/hash/sha2.hpp>
 #include <nil/crypto3/hash/algorithm/hash.hpp>
@@ -324,7 +325,8 @@ namespace nil {
                     base_integral_type s = construct_scalar(h);
 
                     // 3.
-                    group_value_type sB = scalar_field_value_type(s) * group_value_type::one();
+                    group_value_type sB =
+                        algebra::curves::detail::fixed_base_mul<group_value_type>(scalar_field_value_type(s));
 
                     // 4.
                     marshalling_group_value_type marshalling_group_value(sB);
@@ -380,7 +382,7 @@ namespace nil {
                     scalar_field_value_type r_reduced(r_modular);
 
                     // 3.
-                    group_value_type rB = r_reduced * group_value_type::one();
+                    group_value_type rB = algebra::curves::detail::fixed_base_mul<group_value_type>(r_reduced);
                     marshalling_group_value_type marshalling_group_value(rB);
                     signature_type signature;
                     auto sig_iter_3 = std::begin(signature);
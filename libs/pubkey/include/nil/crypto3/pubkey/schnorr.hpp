@@ -30,6 +30,8 @@
 
 #include <nil/crypto3/random/rfc6979.hpp>
 
+#include <nil/crypto3/algebra/curves/detail/constant_time_scalar_mul.hpp>
+
 #include <nil/crypto3/pkpad/algorithms/encode.hpp>
 
 #include <nil/crypto3/pubkey/keys/private_key.hpp>
@@ -174,7 +176,7 @@ namespace nil {
                 }
 
                 static inline public_key_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_type::one();
+                    return algebra::curves::detail::fixed_base_mul<public_key_type>(key);
                 }
 
                 static inline void init_accumulator(accumulator_type &acc) {
@@ -206,10 +208,11 @@ namespace nil {
                     do {
                         while ((k = gen()).is_zero()) {
                         }
+                        g1_value_type kG = algebra::curves::detail::fixed_base_mul<g1_value_type>(k);
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
                         r = scalar_field_value_type(scalar_modular_type(typename scalar_modular_type::backend_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
+                            static_cast<base_integral_type>(kG.to_affine().X.data),
                             scalar_field_value_type::modulus)));
                         s = k.inversed() * (privkey * r + encoded_m);
                     } while (r.is_zero() || s.is_zero());
@@ -255,7 +258,7 @@ namespace nil {
                 }
 
                 static inline public_key_type generate_public_key(const private_key_type &key) {
-                    return key * public_key_type::one();
+                    return algebra::curves::detail::fixed_base_mul<public_key_type>(key);
                 }
 
                 static inline void init_accumulator(accumulator_type &acc) {
@@ -288,10 +291,11 @@ namespace nil {
                     do {
                         while ((k = gen()).is_zero()) {
                         }
+                        g1_value_type kG = algebra::curves::detail::fixed_base_mul<g1_value_type>(k);
                         // TODO: review converting of kG x-coordinate to r - in case of 2^n order (binary) fields
                         //  procedure seems not to be trivial
                         r = scalar_field_value_type(scalar_modular_type(typename scalar_modular_type::backend_type(
-                            static_cast<base_integral_type>((k * g1_value_type::one()).to_affine().X.data),
+                            static_cast<base_integral_type>(kG.to_affine().X.data),
                             scalar_field_value_type::modulus)));
                         s = (privkey * r + encoded_m) * k.inversed();
                     } while (r.is_zero() || s.is_zero());
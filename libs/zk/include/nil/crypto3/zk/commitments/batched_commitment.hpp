@@ -25,10 +25,12 @@
 #ifndef CRYPTO3_ZK_STUB_PLACEHOLDER_COMMITMENT_SCHEME_HPP
 #define CRYPTO3_ZK_STUB_PLACEHOLDER_COMMITMENT_SCHEME_HPP
 
+#include <array>
 #include <concepts>
 #include <map>
 #include <set>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -218,6 +220,11 @@ namespace nil {
                     template<typename T>
                     void eval_polys_impl(const std::map<std::size_t, std::vector<T>> &polys) {
                         TAGGED_PROFILE_SCOPE("{low level} poly eval", "LPC eval polys");
+                        // (batch, polynomial, point) positions of every evaluation, grouped by the point.
+                        std::vector<value_type> points;
+                        std::vector<std::vector<std::array<std::size_t, 3>>> positions;
+                        std::unordered_map<value_type, std::size_t> point_indices;
+
                         for (auto const &[batch_id, batch_polys] : polys) {
                             _z.set_batch_size(batch_id, batch_polys.size());
                             auto const &batch_points = _points.at(batch_id);
@@ -231,10 +238,28 @@ namespace nil {
                             for (std::size_t i = 0; i < batch_polys.size(); ++i) {
                                 for (std::size_t j = 0; j < batch_points[i].size(); j++) {
                                     const auto &point = batch_points[i][j];
-                                    _z.set(batch_id, i, j, batch_polys[i].evaluate(point));
+                                    if constexpr (std::is_same_v<T, math::polynomial_dfs<value_type>>) {
+                                        auto [it, inserted] = point_indices.emplace(point, points.size());
+                                        if (inserted) {
+                                            points.push_back(point);
+                                            positions.emplace_back();
+                                        }
+                                        positions[it->second].push_back({batch_id, i, j});
+                                    } else {
+                                        _z.set(batch_id, i, j, batch_polys[i].evaluate(point));
+                                    }
                                 }
                             }
                         }
+
+                        // Barycentric weights are shared by all the polynomials evaluated at the same point, across
+                        // all batches, and only one point's weights are alive at a time.
+                        for (std::size_t k = 0; k < points.size(); ++k) {
+                            math::polynomial_dfs_point_evaluator<value_type> evaluator(points[k]);
+                            for (auto const &[batch_id, i, j] : positions[k]) {
+                                _z.set(batch_id, i, j, evaluator(polys.at(batch_id)[i]));
+                            }
+                        }
                     }
 
                 public:
@@ -33,11 +33,19 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <memory>
 #include <unordered_map>
 #include <map>
 #include <random>
 
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
 #include <nil/crypto3/math/algorithms/calculate_domain_set.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
@@ -49,7 +57,9 @@
 
 #include <nil/crypto3/container/merkle/tree.hpp>
 #include <nil/crypto3/container/merkle/proof.hpp>
+#include <nil/crypto3/container/merkle/multiproof.hpp>
 
+#include <nil/crypto3/zk/snark/arithmetization/plonk/column_arena.hpp>
 #include <nil/crypto3/zk/transcript/fiat_shamir.hpp>
 
 #include <nil/crypto3/zk/commitments/type_traits.hpp>
@@ -81,13 +91,30 @@ namespace nil {
                      */
                     template<typename FieldType, typename MerkleTreeHashType, typename TranscriptHashType,
                              std::size_t M,
-                             typename GrindingType = nil::crypto3::zk::commitments::proof_of_work<TranscriptHashType>>
+                             typename GrindingType = nil::crypto3::zk::commitments::proof_of_work<TranscriptHashType>,
+                             std::size_t MerkleTreeArity = 2, bool UseMerkleMultiproofs = false,
+                             std::size_t MerkleCapHeight = 0>
                     struct basic_batched_fri {
                         BOOST_STATIC_ASSERT_MSG(M == 2, "unsupported m value!");
+                        BOOST_STATIC_ASSERT_MSG(MerkleTreeArity == 2 || MerkleTreeArity == 4 || MerkleTreeArity == 8,
+                                                "unsupported Merkle tree arity!");
+                        BOOST_STATIC_ASSERT_MSG(!UseMerkleMultiproofs || MerkleCapHeight == 0,
+                                                "Merkle multiproofs are checked against the roots, not caps!");
 
                         constexpr static const bool is_fri = true;
 
                         constexpr static const std::size_t m = M;
+                        // Arity of the Merkle trees over the FRI leaves. Wider trees make shorter proofs, and with
+                        // an algebraic hash whose rate fits all the children a node is a single permutation.
+                        // The number of leaves of a round does not have to be a power of the arity, the top node
+                        // of such a tree has default digests for its missing children, see merkle_tree_impl.
+                        constexpr static const std::size_t merkle_tree_arity = MerkleTreeArity;
+                        // Open all the queries of a tree with one merkle multiproof instead of one merkle proof per
+                        // query. This changes the proof type, so it is fixed at compile time.
+                        constexpr static const bool use_merkle_multiproofs = UseMerkleMultiproofs;
+                        // Height of the Merkle caps sent with the proof. The query proofs then stop that many layers
+                        // below the roots, at the cap, and each cap is checked against its root once.
+                        constexpr static const std::size_t merkle_cap_height = MerkleCapHeight;
                         using grinding_type = GrindingType;
 
                         typedef FieldType field_type;
@@ -107,8 +134,10 @@ namespace nil {
                             marshalling::types::field_element<nil::marshalling::field_type<Endianness>,
                                                               typename FieldType::value_type>;
 
-                        using merkle_tree_type = containers::merkle_tree<MerkleTreeHashType, 2>;
-                        using merkle_proof_type = typename containers::merkle_proof<MerkleTreeHashType, 2>;
+                        using merkle_tree_type = containers::merkle_tree<MerkleTreeHashType, MerkleTreeArity>;
+                        using merkle_proof_type = typename containers::merkle_proof<MerkleTreeHashType, MerkleTreeArity>;
+                        using merkle_multiproof_type =
+                            typename containers::merkle_multiproof<MerkleTreeHashType, MerkleTreeArity>;
                         using precommitment_type = merkle_tree_type;
                         using commitment_type = typename precommitment_type::value_type;
                         using transcript_type = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>;
@@ -117,8 +146,11 @@ namespace nil {
                         struct params_type {
 
                             using field_type = FieldType;
-                            using merkle_tree_type = containers::merkle_tree<MerkleTreeHashType, 2>;
-                            using merkle_proof_type = typename containers::merkle_proof<MerkleTreeHashType, 2>;
+                            using merkle_tree_type = containers::merkle_tree<MerkleTreeHashType, MerkleTreeArity>;
+                            using merkle_proof_type =
+                                typename containers::merkle_proof<MerkleTreeHashType, MerkleTreeArity>;
+                            using merkle_multiproof_type =
+                                typename containers::merkle_multiproof<MerkleTreeHashType, MerkleTreeArity>;
                             using precommitment_type = merkle_tree_type;
                             using commitment_type = typename precommitment_type::value_type;
                             using transcript_type = transcript::fiat_shamir_heuristic_sequential<TranscriptHashType>;
@@ -126,6 +158,9 @@ namespace nil {
                             // We need these constants duplicated here, so we can access them from marshalling easier.
                             // Everything that needs to be marshalled is a part of params_type.
                             using grinding_type = GrindingType;
+                            constexpr static std::size_t merkle_tree_arity = MerkleTreeArity;
+                            constexpr static bool use_merkle_multiproofs = UseMerkleMultiproofs;
+                            constexpr static std::size_t merkle_cap_height = MerkleCapHeight;
 
                             static std::vector<std::size_t> generate_random_step_list(const std::size_t r,
                                                                                       const int max_step) {
@@ -152,17 +187,18 @@ namespace nil {
 
                             params_type(std::size_t max_step, std::size_t degree_log, std::size_t lambda,
                                         std::size_t expand_factor, bool use_grinding = false,
-                                        std::size_t grinding_parameter = 16) :
+                                        std::size_t grinding_parameter = 16, std::size_t merkle_pruned_rows = 0) :
                                 lambda(lambda), use_grinding(use_grinding), grinding_parameter(grinding_parameter),
                                 max_degree((1 << degree_log) - 1),
                                 D(math::calculate_domain_set<FieldType>(degree_log + expand_factor, degree_log - 1)),
                                 r(degree_log - 1), step_list(generate_random_step_list(r, max_step)),
-                                expand_factor(expand_factor), max_step(max_step), degree_log(degree_log) {
+                                expand_factor(expand_factor), max_step(max_step), degree_log(degree_log),
+                                merkle_pruned_rows(merkle_pruned_rows) {
                             }
 
                             params_type(const std::vector<std::size_t> &step_list_in, std::size_t degree_log,
                                         std::size_t lambda, std::size_t expand_factor, bool use_grinding = false,
-                                        std::size_t grinding_parameter = 16) :
+                                        std::size_t grinding_parameter = 16, std::size_t merkle_pruned_rows = 0) :
                                 lambda(lambda), use_grinding(use_grinding), grinding_parameter(grinding_parameter),
                                 max_degree((1 << degree_log) - 1),
                                 D(math::calculate_domain_set<FieldType>(
@@ -171,7 +207,7 @@ namespace nil {
                                 r(std::accumulate(step_list_in.begin(), step_list_in.end(), 0)),
                                 step_list(step_list_in), expand_factor(expand_factor),
                                 max_step(std::accumulate(step_list_in.begin(), step_list_in.end(), 0)),
-                                degree_log(degree_log) {
+                                degree_log(degree_log), merkle_pruned_rows(merkle_pruned_rows) {
                             }
 
                             bool operator==(const params_type &rhs) const {
@@ -214,6 +250,11 @@ namespace nil {
                             const std::size_t expand_factor;
                             const std::size_t max_step;
                             const std::size_t degree_log;
+
+                            // Bottom rows not stored in the Merkle trees of the FRI rounds, their nodes are
+                            // recomputed from the folded polynomials for every query. Only the prover uses it, it
+                            // changes neither the commitments nor the proof.
+                            const std::size_t merkle_pruned_rows;
                         };
 
                         struct round_proof_type {
@@ -320,7 +361,10 @@ namespace nil {
                                 //                                    return false;
                                 //                                }
                                 return fri_roots == rhs.fri_roots && query_proofs == rhs.query_proofs &&
-                                       final_polynomial == rhs.final_polynomial;
+                                       final_polynomial == rhs.final_polynomial &&
+                                       initial_multiproofs == rhs.initial_multiproofs &&
+                                       round_multiproofs == rhs.round_multiproofs && initial_caps == rhs.initial_caps &&
+                                       round_caps == rhs.round_caps;
                             }
 
                             bool operator!=(const proof_type &rhs) const {
@@ -331,6 +375,23 @@ namespace nil {
                             math::polynomial<value_type> final_polynomial;
                             std::vector<query_proof_type> query_proofs;    // 0...lambda - 1
                             typename GrindingType::output_type proof_of_work;
+
+                            // Only used with use_merkle_multiproofs. The merkle proofs of the query proofs are left
+                            // empty then, all the queries of a tree being opened at once here.
+                            std::map<std::size_t, merkle_multiproof_type> initial_multiproofs;
+                            std::vector<merkle_multiproof_type> round_multiproofs;    // 0,..step_list.size()
+
+                            // Only used with merkle_cap_height > 0. The merkle proofs of the query proofs end at
+                            // these caps, which are checked against the commitments and fri_roots.
+                            std::map<std::size_t, std::vector<commitment_type>> initial_caps;
+                            std::vector<std::vector<commitment_type>> round_caps;    // 0,..step_list.size()
+                        };
+
+                        // Hashes of the leaves opened by one query, collected by the verifier to check them against
+                        // the merkle multiproofs of the proof after all the queries are done.
+                        struct query_leaf_hashes_type {
+                            std::map<std::size_t, commitment_type> initial;
+                            std::vector<commitment_type> rounds;
                         };
                     };
                 }    // namespace detail
@@ -349,7 +410,9 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                 static typename FRI::commitment_type commit(const typename FRI::precommitment_type &P) {
@@ -361,7 +424,9 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                 static std::array<typename FRI::commitment_type, list_size>
@@ -379,13 +444,90 @@ namespace nil {
                     return (x_index + domain_size / FRI::m) % domain_size;
                 }
 
+                /**
+                 * Writes the coset_size evaluation indices of FRI leaf x_index to s_indices, in the order they are
+                 * hashed.
+                 */
+                template<typename FRI>
+                static void get_coset_leaf_indices(const std::size_t x_index, const std::size_t domain_size,
+                                                   const std::size_t coset_size, std::size_t *s_indices) {
+                    s_indices[0] = x_index;
+                    s_indices[1] = get_paired_index<FRI>(x_index, domain_size);
+
+                    std::size_t base_index = domain_size / (FRI::m * FRI::m);
+                    std::size_t prev_half_size = 1;
+                    std::size_t i = 1;
+                    while (i < coset_size / FRI::m) {
+                        for (std::size_t j = 0; j < prev_half_size; j++) {
+                            s_indices[i * FRI::m] = (base_index + s_indices[j * FRI::m]) % domain_size;
+                            s_indices[i * FRI::m + 1] = get_paired_index<FRI>(s_indices[i * FRI::m], domain_size);
+                            i++;
+                        }
+                        base_index /= FRI::m;
+                        prev_half_size <<= 1;
+                    }
+                }
+
+                /**
+                 * Makes the leaf producer of the FRI Merkle tree over list_size polynomials of size domain_size,
+                 * get_polynomial(k) returning the k-th one, see containers::make_merkle_tree_streamed. Leaves are
+                 * serialized into a single field element consumer per call.
+                 */
+                template<typename FRI, typename PolynomialGetter>
+                static auto make_fri_leaf_producer(const std::size_t list_size, const std::size_t domain_size,
+                                                   const std::size_t fri_step, PolynomialGetter get_polynomial) {
+                    const std::size_t coset_size = 1 << fri_step;
+                    return [=](std::size_t first, std::size_t last, auto &&consume_leaf) {
+                        detail::fri_field_element_consumer<FRI> element_consumer(coset_size * list_size);
+                        std::vector<std::size_t> s_indices(coset_size);
+                        for (std::size_t x_index = first; x_index < last; ++x_index) {
+                            element_consumer.reset_cursor();
+                            get_coset_leaf_indices<FRI>(x_index, domain_size, coset_size, s_indices.data());
+                            for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
+                                const auto &f = get_polynomial(polynom_index);
+                                for (std::size_t i = 0; i < coset_size; ++i) {
+                                    element_consumer.consume(f[s_indices[i]]);
+                                }
+                            }
+                            consume_leaf(element_consumer);
+                        }
+                    };
+                }
+
+                /**
+                 * Builds the FRI Merkle tree over list_size polynomials of size domain_size, get_polynomial(k)
+                 * returning the k-th one. Leaves are serialized and hashed in parallel directly into the tree,
+                 * each thread reusing a single field element consumer. The bottom pruned_rows rows of the tree are
+                 * not stored.
+                 */
+                template<typename FRI, typename PolynomialGetter>
+                static typename FRI::precommitment_type precommit_leafs(const std::size_t list_size,
+                                                                        const std::size_t domain_size,
+                                                                        const std::size_t fri_step,
+                                                                        PolynomialGetter get_polynomial,
+                                                                        const std::size_t pruned_rows = 0) {
+                    const std::size_t leafs_number = domain_size >> fri_step;
+                    auto produce_leaves =
+                        make_fri_leaf_producer<FRI>(list_size, domain_size, fri_step, get_polynomial);
+
+                    if (pruned_rows != 0) {
+                        return containers::make_pruned_merkle_tree_streamed<typename FRI::merkle_tree_hash_type,
+                                                                            FRI::merkle_tree_arity>(
+                            leafs_number, pruned_rows, produce_leaves);
+                    }
+                    return containers::make_merkle_tree_streamed<typename FRI::merkle_tree_hash_type,
+                                                                 FRI::merkle_tree_arity>(leafs_number,
+                                                                                         produce_leaves);
+                }
+
                 template<typename FRI, typename polynomial_dfs_type>
                     requires(math::EvaluationPolynomial<polynomial_dfs_type> &&
                              algebra::is_field_element<typename polynomial_dfs_type::value_type>::value) &&
                             std::is_base_of_v<
                                 commitments::detail::basic_batched_fri<
                                     typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                    typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                    typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                    FRI::merkle_tree_arity, FRI::use_merkle_multiproofs, FRI::merkle_cap_height>,
                                 FRI>
                 static typename FRI::precommitment_type
                     precommit(const polynomial_dfs_type &f,
@@ -396,41 +538,8 @@ namespace nil {
                         throw std::runtime_error("Polynomial size does not match the domain size in FRI precommit.");
                     }
 
-                    std::size_t domain_size = D->size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number, detail::fri_field_element_consumer<FRI>(coset_size));
-
-                    for (std::size_t x_index = 0; x_index < leafs_number; x_index++) {
-                        std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                        s_indices[0][0] = x_index;
-                        s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                        auto &element_consumer = y_data[x_index].reset_cursor();
-                        element_consumer.consume(f[s_indices[0][0]]);
-                        element_consumer.consume(f[s_indices[0][1]]);
-
-                        std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                        std::size_t prev_half_size = 1;
-                        std::size_t i = 1;
-                        while (i < coset_size / FRI::m) {
-                            for (std::size_t j = 0; j < prev_half_size; j++) {
-                                s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-
-                                element_consumer.consume(f[s_indices[i][0]]);
-                                element_consumer.consume(f[s_indices[i][1]]);
-
-                                i++;
-                            }
-                            base_index /= FRI::m;
-                            prev_half_size <<= 1;
-                        }
-                    }
-
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                    return precommit_leafs<FRI>(
+                        1, D->size(), fri_step, [&f](std::size_t) -> const polynomial_dfs_type & { return f; });
                 }
 
                 template<
@@ -438,7 +547,9 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                 static typename FRI::precommitment_type
@@ -464,68 +575,84 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                     requires math::EvaluationPolynomial<typename ContainerType::value_type>
                 static typename FRI::precommitment_type
-                    precommit(ContainerType poly,
+                    precommit(const ContainerType &poly,
                               std::shared_ptr<math::evaluation_domain<typename FRI::field_type>>
                                   D,
                               const std::size_t fri_step) {
                     PROFILE_SCOPE("Basic FRI precommit");
 
-                    TAGGED_PROFILE_SCOPE("{low level} FFT", "Resize polynomials");
-                    for (std::size_t i = 0; i < poly.size(); ++i) {
-                        if (poly[i].size() != D->size()) {
-                            poly[i].resize(D->size());
-                        }
+                    using field_type = typename FRI::field_type;
+                    using value_type = typename field_type::value_type;
+                    using column_arena_type = snark::plonk_column_arena<field_type>;
+
+                    const bool resize_needed = std::any_of(poly.begin(), poly.end(), [&D](const auto &p) {
+                        return p.size() != D->size();
+                    });
+                    if (!resize_needed) {
+                        TAGGED_PROFILE_SCOPE("{low level} hash", "Precommit leafs");
+                        return precommit_leafs<FRI>(poly.size(), D->size(), fri_step,
+                                                    [&poly](std::size_t polynom_index) -> const auto & {
+                                                        return poly[polynom_index];
+                                                    });
                     }
-                    PROFILE_SCOPE_END();
 
-                    TAGGED_PROFILE_SCOPE("{low level} hash", "Create field element consumers");
-                    std::size_t domain_size = D->size();
-                    std::size_t list_size = poly.size();
-                    std::size_t coset_size = 1 << fri_step;
-                    std::size_t leafs_number = domain_size / coset_size;
-                    std::vector<detail::fri_field_element_consumer<FRI>> y_data(
-                        leafs_number, detail::fri_field_element_consumer<FRI>(coset_size * list_size));
-                    PROFILE_SCOPE_END();
-
-                    TAGGED_PROFILE_SCOPE("{low level} hash", "Precommit leafs");
-                    for (std::size_t x_index = 0; x_index < leafs_number; ++x_index) {
-                        auto &element_consumer = y_data[x_index].reset_cursor();
-                        for (std::size_t polynom_index = 0; polynom_index < list_size; polynom_index++) {
-                            std::vector<std::array<std::size_t, FRI::m>> s_indices(coset_size / FRI::m);
-                            s_indices[0][0] = x_index;
-                            s_indices[0][1] = get_paired_index<FRI>(x_index, domain_size);
-
-                            element_consumer.consume(poly[polynom_index][s_indices[0][0]]);
-                            element_consumer.consume(poly[polynom_index][s_indices[0][1]]);
-
-                            std::size_t base_index = domain_size / (FRI::m * FRI::m);
-                            std::size_t prev_half_size = 1;
-                            std::size_t i = 1;
-                            while (i < coset_size / FRI::m) {
-                                for (std::size_t j = 0; j < prev_half_size; j++) {
-                                    s_indices[i][0] = (base_index + s_indices[j][0]) % domain_size;
-                                    s_indices[i][1] = get_paired_index<FRI>(s_indices[i][0], domain_size);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][0]]);
-                                    element_consumer.consume(poly[polynom_index][s_indices[i][1]]);
-
-                                    i++;
-                                }
-                                base_index /= FRI::m;
-                                prev_half_size <<= 1;
+                    if constexpr (!std::is_same_v<typename ContainerType::value_type,
+                                                  math::polynomial_dfs<value_type>>) {
+                        ContainerType resized = poly;
+                        TAGGED_PROFILE_SCOPE("{low level} FFT", "Resize polynomials");
+                        for (std::size_t i = 0; i < resized.size(); ++i) {
+                            if (resized[i].size() != D->size()) {
+                                resized[i].resize(D->size());
                             }
                         }
-                    }
-                    PROFILE_SCOPE_END();
-
-                    TAGGED_PROFILE_SCOPE("{low level} hash", "Make merkle tree");
+                        PROFILE_SCOPE_END();
 
-                    return containers::make_merkle_tree<typename FRI::merkle_tree_hash_type, FRI::m>(y_data.begin(),
-                                                                                                     y_data.end());
+                        TAGGED_PROFILE_SCOPE("{low level} hash", "Precommit leafs");
+                        return precommit_leafs<FRI>(resized.size(), D->size(), fri_step,
+                                                    [&resized](std::size_t polynom_index) -> const auto & {
+                                                        return resized[polynom_index];
+                                                    });
+                    } else {
+                        // Extends the whole batch to D inside one arena instead of copying and resizing every
+                        // polynomial. As in polynomial_dfs::resize, a column of size n goes through the inverse
+                        // FFT of size n on its first n rows, the zero tail pads the coefficients, and the forward
+                        // FFT runs over the whole column.
+                        TAGGED_PROFILE_SCOPE("{low level} FFT", "Resize polynomials");
+                        column_arena_type arena(poly.size(), D->size(), true);
+                        std::map<std::size_t, std::vector<typename column_arena_type::column_view_type>>
+                            views_by_size;
+                        std::vector<typename column_arena_type::column_view_type> extended_views;
+                        for (std::size_t i = 0; i < poly.size(); ++i) {
+                            const std::size_t size = poly[i].size();
+                            if (size > D->size()) {
+                                throw std::runtime_error("Polynomial size exceeds the domain size in FRI precommit.");
+                            }
+                            arena.assign_column(i, poly[i]);
+                            if (size != D->size()) {
+                                views_by_size[size].push_back(arena.column(i).first(size));
+                                extended_views.push_back(arena.column(i));
+                            }
+                        }
+                        for (const auto &[size, views] : views_by_size) {
+                            math::make_evaluation_domain<field_type>(size)->batch_inverse_fft_views(views);
+                        }
+                        D->batch_fft_views(extended_views);
+                        PROFILE_SCOPE_END();
+
+                        TAGGED_PROFILE_SCOPE("{low level} hash", "Precommit leafs");
+                        const column_arena_type &columns = arena;
+                        return precommit_leafs<FRI>(poly.size(), D->size(), fri_step,
+                                                    [&columns](std::size_t polynom_index) {
+                                                        return columns.column(polynom_index);
+                                                    });
+                    }
                 }
 
                 template<
@@ -533,7 +660,9 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                     requires math::CoefficientPolynomial<typename ContainerType::value_type>
@@ -558,7 +687,34 @@ namespace nil {
                     make_proof_specialized(const std::size_t x_index, const std::size_t domain_size,
                                            const typename FRI::merkle_tree_type &tree) {
                     std::size_t min_x_index = std::min(x_index, get_paired_index<FRI>(x_index, domain_size));
-                    return typename FRI::merkle_proof_type(tree, min_x_index);
+                    return typename FRI::merkle_proof_type(tree, min_x_index, FRI::merkle_cap_height);
+                }
+
+                /**
+                 * Same as above for a tree with pruned rows, produce_leaves giving back its leaves, see
+                 * make_fri_leaf_producer.
+                 */
+                template<typename FRI, typename LeafProducer>
+                static inline typename FRI::merkle_proof_type
+                    make_proof_specialized(const std::size_t x_index, const std::size_t domain_size,
+                                           const typename FRI::merkle_tree_type &tree, LeafProducer produce_leaves) {
+                    std::size_t min_x_index = std::min(x_index, get_paired_index<FRI>(x_index, domain_size));
+                    return typename FRI::merkle_proof_type(tree, min_x_index, FRI::merkle_cap_height, produce_leaves);
+                }
+
+                /**
+                 * Number of bottom rows to prune from a FRI round tree of leafs_number leaves. The cap row and the
+                 * rows above it are always stored, and merkle multiproofs need the complete trees.
+                 */
+                template<typename FRI>
+                static inline std::size_t get_merkle_pruned_rows(const typename FRI::params_type &fri_params,
+                                                                 const std::size_t leafs_number) {
+                    if constexpr (FRI::use_merkle_multiproofs) {
+                        return 0;
+                    }
+                    const std::size_t row_count =
+                        containers::detail::merkle_tree_row_count(leafs_number, FRI::merkle_tree_arity);
+                    return std::min(fri_params.merkle_pruned_rows, row_count - 1 - FRI::merkle_cap_height);
                 }
 
                 template<typename FRI>
@@ -596,6 +752,16 @@ namespace nil {
                     if (fri_params.step_list.back() != 1) {
                         return false;
                     }
+                    std::size_t t = 0;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); ++i) {
+                        const std::size_t leafs_number = fri_params.D[t]->size() >> fri_params.step_list[i];
+                        if (containers::detail::merkle_tree_row_count(leafs_number, FRI::merkle_tree_arity) <=
+                            FRI::merkle_cap_height) {
+                            // Merkle cap is higher than the tree of the round
+                            return false;
+                        }
+                        t += fri_params.step_list[i];
+                    }
                     return true;
                 }
 
@@ -700,44 +866,78 @@ namespace nil {
                     std::vector<typename FRI::precommitment_type> fri_trees;
                     typename FRI::commitments_part_of_proof commitments_proof;
 
-                    auto f = combined_Q;
+                    fs.reserve(fri_params.step_list.size() + 1);
+                    fs.push_back(combined_Q);
                     auto precommitment = combined_Q_precommitment;
                     std::size_t t = 0;
 
+                    // Intermediate folds of a round ping-pong between these two buffers, only the last fold of the
+                    // round is moved into fs. The buffers keep their storage, so there is no allocation per step.
+                    std::array<math::polynomial_dfs<typename FRI::field_type::value_type>, 2> fold_buffers;
+
                     for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
-                        fs.push_back(f);
+                        BOOST_ASSERT(fri_params.step_list[i] > 0);
                         fri_trees.push_back(precommitment);
+                        if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
+                            // The tree of round 0 is a copy of the one the caller keeps, the others are built
+                            // pruned below.
+                            if (i == 0) {
+                                fri_trees.back().prune_rows(
+                                    get_merkle_pruned_rows<FRI>(fri_params, fri_trees.back().leaves()));
+                            }
+                        }
                         commitments_proof.fri_roots.push_back(commit<FRI>(precommitment));
                         transcript(commit<FRI>(precommitment));
-                        for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; ++step_i, ++t) {
-                            typename FRI::field_type::value_type alpha =
-                                transcript.template challenge<typename FRI::field_type>();
-                            // Calculate next f
-                            if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
-                                f = commitments::detail::fold_polynomial<typename FRI::field_type>(f, alpha,
-                                                                                                   fri_params.D[t]);
-                            } else {
+                        if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
+                            std::size_t current = 0;
+                            for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; ++step_i, ++t) {
+                                typename FRI::field_type::value_type alpha =
+                                    transcript.template challenge<typename FRI::field_type>();
+                                // Calculate next f
+                                if (step_i == 0) {
+                                    commitments::detail::fold_polynomial_into<typename FRI::field_type>(
+                                        fs.back(), alpha, fri_params.D[t], fold_buffers[current]);
+                                } else {
+                                    commitments::detail::fold_polynomial_into<typename FRI::field_type>(
+                                        fold_buffers[current ^ 1], alpha, fri_params.D[t], fold_buffers[current]);
+                                }
+                                current ^= 1;
+                            }
+                            fs.emplace_back(std::move(fold_buffers[current ^ 1]));
+                        } else {
+                            auto f = fs.back();
+                            for (std::size_t step_i = 0; step_i < fri_params.step_list[i]; ++step_i, ++t) {
+                                typename FRI::field_type::value_type alpha =
+                                    transcript.template challenge<typename FRI::field_type>();
+                                // Calculate next f
                                 f = commitments::detail::fold_polynomial<typename FRI::field_type>(f, alpha);
                             }
+                            fs.push_back(std::move(f));
                         }
                         if (i != fri_params.step_list.size() - 1) {
+                            auto &f = fs.back();
                             const auto &D = fri_params.D[t];
                             if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
                                 if (f.size() != D->size()) {
                                     PROFILE_SCOPE("Resize polynomial dfs before precommit");
                                     f.resize(D->size());
                                 }
+                                precommitment = precommit_leafs<FRI>(
+                                    1, D->size(), fri_params.step_list[i + 1],
+                                    [&f](std::size_t) -> const polynomial_dfs_type & { return f; },
+                                    get_merkle_pruned_rows<FRI>(fri_params,
+                                                                D->size() >> fri_params.step_list[i + 1]));
+                            } else {
+                                precommitment = precommit<FRI>(f, D, fri_params.step_list[i + 1]);
                             }
-                            precommitment = precommit<FRI>(f, D, fri_params.step_list[i + 1]);
                         }
                     }
-                    fs.push_back(f);
                     if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
                         PROFILE_SCOPE("Get final polynomial coefficients");
                         commitments_proof.final_polynomial =
-                            math::polynomial<typename FRI::field_type::value_type>(f.coefficients());
+                            math::polynomial<typename FRI::field_type::value_type>(fs.back().coefficients());
                     } else {
-                        commitments_proof.final_polynomial = f;
+                        commitments_proof.final_polynomial = fs.back();
                     }
 
                     return std::make_tuple(fs, fri_trees, commitments_proof);
@@ -844,9 +1044,20 @@ namespace nil {
                         domain_size = fri_params.D[t]->size();
                         x_index %= domain_size;
 
-                        round_proofs[i].p = make_proof_specialized<FRI>(
-                            get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]), domain_size,
-                            fri_trees[i]);
+                        const std::size_t folded_index =
+                            get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]);
+                        if (fri_trees[i].pruned_rows() == 0) {
+                            round_proofs[i].p = make_proof_specialized<FRI>(folded_index, domain_size, fri_trees[i]);
+                        } else if constexpr (math::EvaluationPolynomial<polynomial_dfs_type>) {
+                            // Only commit_phase prunes the trees, over the folded polynomials in dfs form.
+                            round_proofs[i].p = make_proof_specialized<FRI>(
+                                folded_index, domain_size, fri_trees[i],
+                                make_fri_leaf_producer<FRI>(
+                                    1, domain_size, fri_params.step_list[i],
+                                    [&f = fs[i]](std::size_t) -> const polynomial_dfs_type & { return f; }));
+                        } else {
+                            BOOST_ASSERT_MSG(false, "Pruned FRI round trees must be built over dfs polynomials");
+                        }
 
                         t += fri_params.step_list[i];
                         if (i < fri_params.step_list.size() - 1) {
@@ -898,6 +1109,35 @@ namespace nil {
                     return round_proofs;
                 }
 
+                /**
+                 * Runs build_query(query_id) for all the queries, in parallel under MULTICORE. An exception must not
+                 * leave the OpenMP region, so it is kept, the remaining queries are skipped and the exception of the
+                 * first failed query is rethrown once the loop is done.
+                 */
+                template<typename QueryBuilder>
+                static void build_queries(const std::size_t lambda, QueryBuilder build_query) {
+                    std::atomic<bool> failed = false;
+                    std::vector<std::exception_ptr> errors(lambda);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                    for (std::size_t query_id = 0; query_id < lambda; query_id++) {
+                        if (failed.load(std::memory_order_relaxed))
+                            continue;
+                        try {
+                            build_query(query_id);
+                        } catch (...) {
+                            errors[query_id] = std::current_exception();
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                    for (const auto &error : errors) {
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+                    }
+                }
+
                 template<typename FRI, typename polynomial_dfs_type>
                 static typename FRI::round_proofs_batch_type query_phase_round_proofs(
                     const typename FRI::params_type &fri_params,
@@ -908,19 +1148,18 @@ namespace nil {
                     BOOST_ASSERT(challenges.size() == fri_params.lambda);
 
                     typename FRI::round_proofs_batch_type proof;
+                    proof.round_proofs.resize(fri_params.lambda);
 
-                    for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                    // Queries only read the trees and the folded polynomials, so they are built independently.
+                    build_queries(fri_params.lambda, [&](std::size_t query_id) {
                         std::size_t domain_size = fri_params.D[0]->size();
                         std::uint64_t x_index = static_cast<std::uint64_t>(
                             challenges[query_id].binomial_extension_coefficient(0).to_integral() % domain_size);
 
                         // Fill round proofs
-                        std::vector<typename FRI::round_proof_type> round_proofs =
-                            build_round_proofs<FRI, polynomial_dfs_type>(fri_params, fri_trees, fs, final_polynomial,
-                                                                         x_index);
-
-                        proof.round_proofs.emplace_back(std::move(round_proofs));
-                    }
+                        proof.round_proofs[query_id] = build_round_proofs<FRI, polynomial_dfs_type>(
+                            fri_params, fri_trees, fs, final_polynomial, x_index);
+                    });
                     return proof;
                 }
 
@@ -940,7 +1179,7 @@ namespace nil {
 
                     TAGGED_PROFILE_SCOPE("{low level} poly eval", "Compute initial proofs of size {}",
                                          fri_params.lambda);
-                    for (std::size_t query_id = 0; query_id < fri_params.lambda; ++query_id) {
+                    build_queries(fri_params.lambda, [&](std::size_t query_id) {
                         std::size_t domain_size = fri_params.D[0]->size();
                         std::uint64_t x_index = static_cast<std::uint64_t>(
                             challenges[query_id].binomial_extension_coefficient(0).to_integral() % domain_size);
@@ -950,7 +1189,7 @@ namespace nil {
                                                                           x_index);
 
                         proof.initial_proofs[query_id] = std::move(initial_proof);
-                    }
+                    });
 
                     return proof;
                 }
@@ -1001,12 +1240,121 @@ namespace nil {
                         precommitments, fri_params, challenges, g, g_coeffs, fri_trees, fs, final_polynomial);
                 }
 
+                /**
+                 * Returns the leaf of every FRI round tree opened by the query on x_index, the same leaves
+                 * build_round_proofs makes merkle proofs for. The leaf of round 0 is also the one opened in the
+                 * initial trees.
+                 */
+                template<typename FRI>
+                static std::vector<std::size_t> get_query_leaf_indices(const typename FRI::params_type &fri_params,
+                                                                       std::uint64_t x_index) {
+                    std::vector<std::size_t> leaf_indices(fri_params.step_list.size());
+                    std::size_t t = 0;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        std::size_t domain_size = fri_params.D[t]->size();
+                        x_index %= domain_size;
+                        std::size_t folded_index =
+                            get_folded_index<FRI>(x_index, domain_size, fri_params.step_list[i]);
+                        leaf_indices[i] =
+                            std::min(folded_index, get_paired_index<FRI>(folded_index, domain_size));
+                        t += fri_params.step_list[i];
+                    }
+                    return leaf_indices;
+                }
+
+                /**
+                 * Returns, for every FRI round, the leaves opened by each of the queries in the order of the
+                 * challenges.
+                 */
+                template<typename FRI>
+                static std::vector<std::vector<std::size_t>>
+                    get_round_leaf_indices(const typename FRI::params_type &fri_params,
+                                           const std::vector<typename FRI::field_type::value_type> &challenges) {
+                    std::size_t domain_size = fri_params.D[0]->size();
+                    std::vector<std::vector<std::size_t>> round_leaf_indices(
+                        fri_params.step_list.size(), std::vector<std::size_t>(challenges.size()));
+                    for (std::size_t query_id = 0; query_id < challenges.size(); query_id++) {
+                        std::uint64_t x_index = static_cast<std::uint64_t>(
+                            challenges[query_id].binomial_extension_coefficient(0).to_integral() % domain_size);
+                        std::vector<std::size_t> leaf_indices = get_query_leaf_indices<FRI>(fri_params, x_index);
+                        for (std::size_t i = 0; i < leaf_indices.size(); i++) {
+                            round_leaf_indices[i][query_id] = leaf_indices[i];
+                        }
+                    }
+                    return round_leaf_indices;
+                }
+
+                /**
+                 * Replaces the merkle proofs of the query proofs by one merkle multiproof per committed tree. The
+                 * queries share most of the upper tree levels, which are then sent only once.
+                 */
+                template<typename FRI>
+                static void build_merkle_multiproofs(
+                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const typename FRI::params_type &fri_params,
+                    const std::vector<typename FRI::field_type::value_type> &challenges,
+                    const std::vector<typename FRI::precommitment_type> &fri_trees,
+                    typename FRI::proof_type &proof) {
+                    PROFILE_SCOPE("Basic FRI merkle multiproofs");
+                    std::vector<std::vector<std::size_t>> round_leaf_indices =
+                        get_round_leaf_indices<FRI>(fri_params, challenges);
+
+                    proof.initial_multiproofs.clear();
+                    if (!proof.query_proofs.empty()) {
+                        for (const auto &it : proof.query_proofs[0].initial_proof) {
+                            proof.initial_multiproofs.emplace(
+                                it.first,
+                                typename FRI::merkle_multiproof_type(precommitments.at(it.first), round_leaf_indices[0]));
+                        }
+                    }
+
+                    proof.round_multiproofs.clear();
+                    proof.round_multiproofs.reserve(fri_params.step_list.size());
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        proof.round_multiproofs.emplace_back(fri_trees[i], round_leaf_indices[i]);
+                    }
+
+                    for (auto &query_proof : proof.query_proofs) {
+                        for (auto &it : query_proof.initial_proof) {
+                            it.second.p = typename FRI::merkle_proof_type();
+                        }
+                        for (auto &round_proof : query_proof.round_proofs) {
+                            round_proof.p = typename FRI::merkle_proof_type();
+                        }
+                    }
+                }
+
+                /**
+                 * Fills the Merkle caps of the committed trees the query proofs end at, see merkle_cap_height.
+                 */
+                template<typename FRI>
+                static void build_merkle_caps(
+                    const std::map<std::size_t, typename FRI::precommitment_type> &precommitments,
+                    const std::vector<typename FRI::precommitment_type> &fri_trees,
+                    typename FRI::proof_type &proof) {
+                    proof.initial_caps.clear();
+                    if (!proof.query_proofs.empty()) {
+                        for (const auto &it : proof.query_proofs[0].initial_proof) {
+                            proof.initial_caps.emplace(it.first,
+                                                       precommitments.at(it.first).cap(FRI::merkle_cap_height));
+                        }
+                    }
+
+                    proof.round_caps.clear();
+                    proof.round_caps.reserve(fri_trees.size());
+                    for (const auto &tree : fri_trees) {
+                        proof.round_caps.emplace_back(tree.cap(FRI::merkle_cap_height));
+                    }
+                }
+
                 template<
                     typename FRI,
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                 static typename FRI::grinding_type::output_type
@@ -1025,7 +1373,9 @@ namespace nil {
                         math::EvaluationPolynomial<polynomial_dfs_type> &&
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value)
                 static typename FRI::proof_type proof_eval(
                     const std::map<std::size_t, std::vector<polynomial_dfs_type>> &g,
@@ -1061,9 +1411,20 @@ namespace nil {
                     proof.proof_of_work = run_grinding<FRI>(fri_params, transcript);
 
                     // Query phase
-                    proof.query_proofs =
-                        query_phase<FRI, polynomial_dfs_type>(precommitments, fri_params, transcript, g, g_coeffs,
-                                                              fri_trees, fs, commitments_proof.final_polynomial);
+                    std::vector<typename FRI::field_type::value_type> challenges =
+                        transcript.template challenges<typename FRI::field_type>(fri_params.lambda);
+                    {
+                        PROFILE_SCOPE("Basic FRI query phase");
+                        proof.query_proofs = query_phase_with_challenges<FRI, polynomial_dfs_type>(
+                            precommitments, fri_params, challenges, g, g_coeffs, fri_trees, fs,
+                            commitments_proof.final_polynomial);
+                    }
+                    if constexpr (FRI::use_merkle_multiproofs) {
+                        build_merkle_multiproofs<FRI>(precommitments, fri_params, challenges, fri_trees, proof);
+                    }
+                    if constexpr (FRI::merkle_cap_height != 0) {
+                        build_merkle_caps<FRI>(precommitments, fri_trees, proof);
+                    }
 
                     proof.fri_roots = std::move(commitments_proof.fri_roots);
                     proof.final_polynomial = std::move(commitments_proof.final_polynomial);
@@ -1093,10 +1454,14 @@ namespace nil {
                     verify_initial_proof(const std::map<std::size_t, typename FRI::initial_proof_type> &initial_proof,
                                          const std::map<std::size_t, typename FRI::commitment_type> &commitments,
                                          const std::vector<std::pair<std::size_t, std::size_t>> &correct_order_idx,
-                                         std::size_t coset_size) {
+                                         std::size_t coset_size,
+                                         std::map<std::size_t, typename FRI::commitment_type> *leaf_hashes = nullptr,
+                                         const std::map<std::size_t, std::vector<typename FRI::commitment_type>>
+                                             *caps = nullptr) {
                     for (auto const &it : initial_proof) {
                         auto k = it.first;
-                        if (initial_proof.at(k).p.root() != commitments.at(k)) {
+                        if (leaf_hashes == nullptr && caps == nullptr &&
+                            initial_proof.at(k).p.root() != commitments.at(k)) {
                             BOOST_LOG_TRIVIAL(info)
                                 << "FRI verification failed: Wrong initial proof, commitment does not match.";
                             return false;
@@ -1111,6 +1476,21 @@ namespace nil {
                                 leaf_data.consume(initial_proof.at(k).values[i][idx][1]);
                             }
                         }
+                        // The leaves are then checked against the initial merkle multiproofs of the proof.
+                        if (leaf_hashes != nullptr) {
+                            (*leaf_hashes)[k] = static_cast<typename FRI::commitment_type>(
+                                crypto3::hash<typename FRI::merkle_tree_hash_type>(leaf_data));
+                            continue;
+                        }
+                        // The caps are checked against the commitments once for all the queries.
+                        if (caps != nullptr) {
+                            auto cap = caps->find(k);
+                            if (cap == caps->end() || !initial_proof.at(k).p.validate(leaf_data, cap->second)) {
+                                BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong initial proof.";
+                                return false;
+                            }
+                            continue;
+                        }
                         if (!initial_proof.at(k).p.validate(leaf_data)) {
                             BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong initial proof.";
                             return false;
@@ -1162,10 +1542,72 @@ namespace nil {
                     return y;
                 }
 
+                /**
+                 * The queries are verified in parallel and read the query proofs with operator[], so the shape of
+                 * the proof is checked before.
+                 */
+                template<typename FRI>
+                static bool check_query_proof_sizes(
+                    const typename FRI::proof_type &proof,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>> &poly_ids) {
+                    if (proof.fri_roots.size() != fri_params.step_list.size() ||
+                        proof.query_proofs.size() != fri_params.lambda) {
+                        BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong number of query proofs.";
+                        return false;
+                    }
+
+                    const std::size_t initial_values_size = (std::size_t(1) << fri_params.step_list[0]) / FRI::m;
+                    for (const auto &query_proof : proof.query_proofs) {
+                        if (query_proof.round_proofs.size() != fri_params.step_list.size()) {
+                            BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong number of round proofs.";
+                            return false;
+                        }
+                        for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                            // The last round proof holds the two values of the final polynomial.
+                            const std::size_t values_size =
+                                i + 1 < fri_params.step_list.size() ? (1 << fri_params.step_list[i + 1]) / FRI::m : 1;
+                            if (query_proof.round_proofs[i].y.size() != values_size) {
+                                BOOST_LOG_TRIVIAL(info)
+                                    << "FRI verification failed: Wrong size of round proof " << i << ".";
+                                return false;
+                            }
+                        }
+
+                        for (const auto &it : query_proof.initial_proof) {
+                            if (commitments.find(it.first) == commitments.end()) {
+                                BOOST_LOG_TRIVIAL(info)
+                                    << "FRI verification failed: Wrong initial proof, no such commitment.";
+                                return false;
+                            }
+                            for (const auto &values : it.second.values) {
+                                if (values.size() != initial_values_size) {
+                                    BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong size of initial proof.";
+                                    return false;
+                                }
+                            }
+                        }
+                        for (const auto &batch_poly_ids : poly_ids) {
+                            for (const auto &poly_id : batch_poly_ids) {
+                                auto initial_proof = query_proof.initial_proof.find(std::get<0>(poly_id));
+                                if (initial_proof == query_proof.initial_proof.end() ||
+                                    std::get<1>(poly_id) >= initial_proof->second.values.size()) {
+                                    BOOST_LOG_TRIVIAL(info)
+                                        << "FRI verification failed: Missing polynomial in initial proof.";
+                                    return false;
+                                }
+                            }
+                        }
+                    }
+                    return true;
+                }
+
                 template<typename FRI>
                 static bool check_argument_sizes(
                     const typename FRI::proof_type &proof,
                     const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments,
                     const std::vector<typename FRI::field_type::value_type> &combined_U,
                     const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>> &poly_ids,
                     const std::vector<math::polynomial<typename FRI::field_type::value_type>> &denominators) {
@@ -1173,14 +1615,12 @@ namespace nil {
                     BOOST_ASSERT(combined_U.size() == denominators.size());
                     BOOST_ASSERT(combined_U.size() == poly_ids.size());
 
-                    // TODO: Add size correctness checks.
-
                     if (proof.final_polynomial.degree() >
                         std::pow(2, std::log2(fri_params.max_degree + 1) - fri_params.r + 1) - 1) {
                         BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong argument sizes.";
                         return false;
                     }
-                    return true;
+                    return check_query_proof_sizes<FRI>(proof, fri_params, commitments, poly_ids);
                 }
 
                 /**
@@ -1196,9 +1636,11 @@ namespace nil {
                                                size_t i,
                                                std::uint64_t &x_index,
                                                std::size_t &domain_size,
-                                               std::size_t &t) {
+                                               std::size_t &t,
+                                               typename FRI::commitment_type *leaf_hash = nullptr,
+                                               const std::vector<typename FRI::commitment_type> *cap = nullptr) {
                     size_t coset_size = 1 << fri_params.step_list[i];
-                    if (round_proof.p.root() != fri_root) {
+                    if (leaf_hash == nullptr && cap == nullptr && round_proof.p.root() != fri_root) {
                         BOOST_LOG_TRIVIAL(info)
                             << "FRI verification failed: wrong FRI root on round proof " << i << ".";
                         return false;
@@ -1213,7 +1655,11 @@ namespace nil {
                         leaf_data.consume(y[idx][0]);
                         leaf_data.consume(y[idx][1]);
                     }
-                    if (!round_proof.p.validate(leaf_data)) {
+                    if (leaf_hash != nullptr) {
+                        *leaf_hash = static_cast<typename FRI::commitment_type>(
+                            crypto3::hash<typename FRI::merkle_tree_hash_type>(leaf_data));
+                    } else if (cap != nullptr ? !round_proof.p.validate(leaf_data, *cap)
+                                              : !round_proof.p.validate(leaf_data)) {
                         BOOST_LOG_TRIVIAL(info) << "Wrong round merkle proof on " << i << "-th round";
                         return false;
                     }
@@ -1321,9 +1767,34 @@ namespace nil {
                     typename FRI::polynomial_values_type &combined_Q_y_out,
                     typename FRI::field_type::value_type &x_out,
                     std::uint64_t &x_index_out) {
-                    typename FRI::field_type::value_type x_challenge =
-                        transcript.template challenge<typename FRI::field_type>();
+                    return verify_initial_proof_and_return_combined_Q_values<FRI>(
+                        initial_proof, combined_U, poly_ids, denominators, fri_params, commitments, theta, coset_size,
+                        domain_size, starting_index, transcript.template challenge<typename FRI::field_type>(),
+                        combined_Q_y_out, x_out, x_index_out);
+                }
 
+                /**
+                 * Same as above, with the query challenge already drawn from the transcript. Does not touch any
+                 * shared state, so the queries of a proof can be checked concurrently.
+                 */
+                template<typename FRI>
+                static bool verify_initial_proof_and_return_combined_Q_values(
+                    const std::map<std::size_t, typename FRI::initial_proof_type> &initial_proof,
+                    const std::vector<typename FRI::field_type::value_type> &combined_U,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>> &poly_ids,
+                    const std::vector<math::polynomial<typename FRI::field_type::value_type>> &denominators,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments,
+                    const typename FRI::field_type::value_type &theta,
+                    const std::size_t coset_size,
+                    std::size_t domain_size,
+                    size_t starting_index,
+                    const typename FRI::field_type::value_type &x_challenge,
+                    typename FRI::polynomial_values_type &combined_Q_y_out,
+                    typename FRI::field_type::value_type &x_out,
+                    std::uint64_t &x_index_out,
+                    std::map<std::size_t, typename FRI::commitment_type> *leaf_hashes = nullptr,
+                    const std::map<std::size_t, std::vector<typename FRI::commitment_type>> *caps = nullptr) {
                     x_index_out = static_cast<std::uint64_t>(
                         x_challenge.binomial_extension_coefficient(0).to_integral() % domain_size);
                     x_out = fri_params.D[0]->get_domain_element(x_index_out);
@@ -1333,7 +1804,8 @@ namespace nil {
                         get_correct_order<FRI>(x_index_out, domain_size, fri_params.step_list[0], s_indices);
 
                     // Check initial proof.
-                    if (!verify_initial_proof<FRI>(initial_proof, commitments, correct_order_idx, coset_size)) {
+                    if (!verify_initial_proof<FRI>(initial_proof, commitments, correct_order_idx, coset_size,
+                                                   leaf_hashes, caps)) {
                         BOOST_LOG_TRIVIAL(info) << "Initial FRI proof/consistency check verification failed.";
                         return false;
                     }
@@ -1383,6 +1855,30 @@ namespace nil {
                     const std::size_t coset_size,
                     std::size_t domain_size,
                     typename FRI::transcript_type &transcript) {
+                    return verify_query_proof<FRI>(query_proof, combined_U, poly_ids, denominators, fri_params,
+                                                   commitments, theta, alphas, fri_roots, final_polynomial, coset_size,
+                                                   domain_size,
+                                                   transcript.template challenge<typename FRI::field_type>());
+                }
+
+                template<typename FRI>
+                static bool verify_query_proof(
+                    const typename FRI::query_proof_type &query_proof,
+                    const std::vector<typename FRI::field_type::value_type> &combined_U,
+                    const std::vector<std::vector<std::tuple<std::size_t, std::size_t>>> &poly_ids,
+                    const std::vector<math::polynomial<typename FRI::field_type::value_type>> &denominators,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments,
+                    const typename FRI::field_type::value_type &theta,
+                    const std::vector<typename FRI::field_type::value_type> &alphas,
+                    const std::vector<typename FRI::commitment_type> &fri_roots,
+                    const math::polynomial<typename FRI::field_type::value_type> &final_polynomial,
+                    const std::size_t coset_size,
+                    std::size_t domain_size,
+                    const typename FRI::field_type::value_type &x_challenge,
+                    typename FRI::query_leaf_hashes_type *leaf_hashes = nullptr,
+                    const std::map<std::size_t, std::vector<typename FRI::commitment_type>> *initial_caps = nullptr,
+                    const std::vector<std::vector<typename FRI::commitment_type>> *round_caps = nullptr) {
                     typename FRI::field_type::value_type x;
                     std::uint64_t x_index;
                     // Combined Q values
@@ -1391,15 +1887,21 @@ namespace nil {
                     size_t starting_index = 0;
                     if (!verify_initial_proof_and_return_combined_Q_values<FRI>(
                             query_proof.initial_proof, combined_U, poly_ids, denominators, fri_params, commitments,
-                            theta, coset_size, domain_size, starting_index, transcript, y, x, x_index)) {
+                            theta, coset_size, domain_size, starting_index, x_challenge, y, x, x_index,
+                            leaf_hashes != nullptr ? &leaf_hashes->initial : nullptr, initial_caps)) {
                         return false;
                     }
 
                     // Check round proofs
+                    if (leaf_hashes != nullptr) {
+                        leaf_hashes->rounds.resize(fri_params.step_list.size());
+                    }
                     std::size_t t = 0;
                     for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
                         if (!verify_round_proof<FRI>(query_proof.round_proofs[i], y, fri_params, alphas, fri_roots[i],
-                                                     i, x_index, domain_size, t))
+                                                     i, x_index, domain_size, t,
+                                                     leaf_hashes != nullptr ? &leaf_hashes->rounds[i] : nullptr,
+                                                     round_caps != nullptr ? &(*round_caps)[i] : nullptr))
                             return false;
                     }
 
@@ -1409,6 +1911,115 @@ namespace nil {
                     return true;
                 }
 
+                /**
+                 * Checks the leaf hashes collected by the queries against the merkle multiproofs of the proof.
+                 */
+                template<typename FRI>
+                static bool verify_merkle_multiproofs(
+                    const typename FRI::proof_type &proof,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments,
+                    const std::vector<typename FRI::field_type::value_type> &challenges,
+                    const std::vector<typename FRI::query_leaf_hashes_type> &leaf_hashes) {
+                    if (proof.round_multiproofs.size() != fri_params.step_list.size() || leaf_hashes.empty() ||
+                        proof.initial_multiproofs.size() != leaf_hashes[0].initial.size()) {
+                        BOOST_LOG_TRIVIAL(info) << "FRI verification failed: wrong number of merkle multiproofs.";
+                        return false;
+                    }
+
+                    // The opened leaves, the roots and the tree sizes all come from the verifier's side, the
+                    // multiproofs only supply the missing nodes.
+                    std::vector<std::vector<std::size_t>> round_leaf_indices =
+                        get_round_leaf_indices<FRI>(fri_params, challenges);
+                    std::vector<typename FRI::commitment_type> hashes(leaf_hashes.size());
+
+                    const std::size_t initial_leafs_number = fri_params.D[0]->size() >> fri_params.step_list[0];
+                    for (const auto &[k, multiproof] : proof.initial_multiproofs) {
+                        auto commitment = commitments.find(k);
+                        if (commitment == commitments.end()) {
+                            BOOST_LOG_TRIVIAL(info)
+                                << "FRI verification failed: Wrong initial multiproof, no such commitment.";
+                            return false;
+                        }
+                        for (std::size_t query_id = 0; query_id < leaf_hashes.size(); query_id++) {
+                            auto leaf_hash = leaf_hashes[query_id].initial.find(k);
+                            if (leaf_hash == leaf_hashes[query_id].initial.end()) {
+                                return false;
+                            }
+                            hashes[query_id] = leaf_hash->second;
+                        }
+                        if (!multiproof.validate_leaf_hashes(commitment->second, initial_leafs_number,
+                                                             round_leaf_indices[0], hashes)) {
+                            BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong initial multiproof.";
+                            return false;
+                        }
+                    }
+
+                    std::size_t t = 0;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        for (std::size_t query_id = 0; query_id < leaf_hashes.size(); query_id++) {
+                            hashes[query_id] = leaf_hashes[query_id].rounds[i];
+                        }
+                        const std::size_t leafs_number = fri_params.D[t]->size() >> fri_params.step_list[i];
+                        if (!proof.round_multiproofs[i].validate_leaf_hashes(proof.fri_roots[i], leafs_number,
+                                                                             round_leaf_indices[i], hashes)) {
+                            BOOST_LOG_TRIVIAL(info) << "Wrong round merkle multiproof on " << i << "-th round";
+                            return false;
+                        }
+                        t += fri_params.step_list[i];
+                    }
+                    return true;
+                }
+
+                /**
+                 * Checks the Merkle caps of the proof against the commitments and the FRI roots, the query proofs
+                 * are then checked against the caps.
+                 */
+                template<typename FRI>
+                static bool verify_merkle_caps(
+                    const typename FRI::proof_type &proof,
+                    const typename FRI::params_type &fri_params,
+                    const std::map<std::size_t, typename FRI::commitment_type> &commitments) {
+                    if (proof.round_caps.size() != fri_params.step_list.size() ||
+                        proof.fri_roots.size() != fri_params.step_list.size()) {
+                        BOOST_LOG_TRIVIAL(info) << "FRI verification failed: wrong number of merkle caps.";
+                        return false;
+                    }
+
+                    // A cap of the wrong length could hash to the root of a smaller tree.
+                    auto check_cap = [](const std::vector<typename FRI::commitment_type> &cap,
+                                        const typename FRI::commitment_type &root, std::size_t leafs_number) {
+                        const std::size_t row_count =
+                            containers::detail::merkle_tree_row_count(leafs_number, FRI::merkle_tree_arity);
+                        return cap.size() == containers::detail::merkle_tree_row_length(
+                                                 leafs_number, FRI::merkle_tree_arity,
+                                                 row_count - 1 - FRI::merkle_cap_height) &&
+                               containers::merkle_cap_root<typename FRI::merkle_tree_hash_type,
+                                                           FRI::merkle_tree_arity>(cap) == root;
+                    };
+
+                    const std::size_t initial_leafs_number = fri_params.D[0]->size() >> fri_params.step_list[0];
+                    for (const auto &[k, cap] : proof.initial_caps) {
+                        auto commitment = commitments.find(k);
+                        if (commitment == commitments.end() ||
+                            !check_cap(cap, commitment->second, initial_leafs_number)) {
+                            BOOST_LOG_TRIVIAL(info) << "FRI verification failed: Wrong initial merkle cap.";
+                            return false;
+                        }
+                    }
+
+                    std::size_t t = 0;
+                    for (std::size_t i = 0; i < fri_params.step_list.size(); i++) {
+                        if (!check_cap(proof.round_caps[i], proof.fri_roots[i],
+                                       fri_params.D[t]->size() >> fri_params.step_list[i])) {
+                            BOOST_LOG_TRIVIAL(info) << "Wrong round merkle cap on " << i << "-th round";
+                            return false;
+                        }
+                        t += fri_params.step_list[i];
+                    }
+                    return true;
+                }
+
                 template<typename FRI>
                 static bool
                     verify_eval(const typename FRI::proof_type &proof,
@@ -1419,7 +2030,7 @@ namespace nil {
                                 const std::vector<typename FRI::field_type::value_type> &combined_U,
                                 const std::vector<math::polynomial<typename FRI::field_type::value_type>> &denominators,
                                 typename FRI::transcript_type &transcript) {
-                    if (!check_argument_sizes<FRI>(proof, fri_params, combined_U, poly_ids, denominators))
+                    if (!check_argument_sizes<FRI>(proof, fri_params, commitments, combined_U, poly_ids, denominators))
                         return false;
 
                     std::vector<typename FRI::field_type::value_type> alphas =
@@ -1430,16 +2041,49 @@ namespace nil {
                         return false;
                     }
 
+                    // With merkle caps the query proofs end at the caps, which are checked here once.
+                    constexpr bool use_merkle_caps = FRI::merkle_cap_height != 0;
+                    if (use_merkle_caps && !verify_merkle_caps<FRI>(proof, fri_params, commitments)) {
+                        return false;
+                    }
+
                     std::size_t domain_size = fri_params.D[0]->size();
                     std::size_t coset_size = 1 << fri_params.step_list[0];
 
-                    for (std::size_t query_id = 0; query_id < fri_params.lambda; query_id++) {
+                    // All the query challenges are drawn upfront, in the same order as the prover does, after which
+                    // the queries are verified independently.
+                    std::vector<typename FRI::field_type::value_type> challenges =
+                        transcript.template challenges<typename FRI::field_type>(fri_params.lambda);
+
+                    // With merkle multiproofs the queries only collect their leaf hashes, which are checked against the
+                    // multiproofs once all the queries are done.
+                    constexpr bool use_merkle_multiproofs = FRI::use_merkle_multiproofs;
+                    std::vector<typename FRI::query_leaf_hashes_type> leaf_hashes(
+                        use_merkle_multiproofs ? fri_params.lambda : 0);
+
+                    // The shape of the proof was checked by check_argument_sizes, so a query does not throw on a
+                    // malformed proof. Any other exception is rethrown once the queries are done.
+                    std::atomic<bool> verified = true;
+                    build_queries(fri_params.lambda, [&](std::size_t query_id) {
+                        if (!verified.load(std::memory_order_relaxed))
+                            return;
                         if (!verify_query_proof<FRI>(proof.query_proofs[query_id], combined_U, poly_ids, denominators,
                                                      fri_params, commitments, theta, alphas, proof.fri_roots,
-                                                     proof.final_polynomial, coset_size, domain_size, transcript))
-                            return false;
+                                                     proof.final_polynomial, coset_size, domain_size,
+                                                     challenges[query_id],
+                                                     use_merkle_multiproofs ? &leaf_hashes[query_id] : nullptr,
+                                                     use_merkle_caps ? &proof.initial_caps : nullptr,
+                                                     use_merkle_caps ? &proof.round_caps : nullptr))
+                            verified.store(false, std::memory_order_relaxed);
+                    });
+
+                    if (!verified.load()) {
+                        return false;
+                    }
+                    if constexpr (use_merkle_multiproofs) {
+                        return verify_merkle_multiproofs<FRI>(proof, fri_params, commitments, challenges,
+                                                              leaf_hashes);
                     }
-
                     return true;
                 }
             }    // namespace algorithms
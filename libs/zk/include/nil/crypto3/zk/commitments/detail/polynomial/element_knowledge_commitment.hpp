@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_ZK_KNOWLEDGE_COMMITMENT_ELEMENT_HPP
 #define CRYPTO3_ZK_KNOWLEDGE_COMMITMENT_ELEMENT_HPP
 
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <boost/multiprecision/number.hpp>
@@ -129,32 +130,20 @@ namespace nil {
                         }
 
                         static void batch_to_special_all_non_zeros(std::vector<element_kc> &vec) {
-                            // it is guaranteed that every vec[i] is non-zero,
-                            // but, for any i, *one* of vec[i].g and vec[i].h might still be zero,
-                            // so we still have to handle zeros separately
+                            // for any i, *one* of vec[i].g and vec[i].h might still be zero, batch_normalize
+                            // leaves those as they are
 
                             // we separately process g's first, then h's
                             // to lower memory consumption
                             std::vector<typename Type1::value_type> g_vec;
                             g_vec.reserve(vec.size());
-
                             for (std::size_t i = 0; i < vec.size(); ++i) {
-                                if (!vec[i].g.is_zero()) {
-                                    g_vec.emplace_back(vec[i].g);
-                                }
+                                g_vec.emplace_back(vec[i].g);
                             }
 
-                            Type1::value_type::batch_to_special_all_non_zeros(g_vec);
-                            auto g_it = g_vec.begin();
-                            typename Type1::value_type Type1_zero_special = Type1::value_type::zero().to_projective();
-
+                            algebra::batch_normalize(g_vec);
                             for (std::size_t i = 0; i < vec.size(); ++i) {
-                                if (!vec[i].g.is_zero()) {
-                                    vec[i].g = *g_it;
-                                    ++g_it;
-                                } else {
-                                    vec[i].g = Type1_zero_special;
-                                }
+                                vec[i].g = g_vec[i];
                             }
 
                             g_vec.clear();
@@ -162,24 +151,13 @@ namespace nil {
                             // exactly the same thing, but for h:
                             std::vector<typename Type2::value_type> h_vec;
                             h_vec.reserve(vec.size());
-
                             for (std::size_t i = 0; i < vec.size(); ++i) {
-                                if (!vec[i].h.is_zero()) {
-                                    h_vec.emplace_back(vec[i].h);
-                                }
+                                h_vec.emplace_back(vec[i].h);
                             }
 
-                            Type2::value_type::batch_to_special_all_non_zeros(h_vec);
-                            auto h_it = h_vec.begin();
-                            typename Type2::value_type Type2_zero_special = Type2::value_type::zero().to_projective();
-
+                            algebra::batch_normalize(h_vec);
                             for (std::size_t i = 0; i < vec.size(); ++i) {
-                                if (!vec[i].h.is_zero()) {
-                                    vec[i].h = *h_it;
-                                    ++h_it;
-                                } else {
-                                    vec[i].h = Type2_zero_special;
-                                }
+                                vec[i].h = h_vec[i];
                             }
 
                             h_vec.clear();
@@ -27,6 +27,15 @@
 #ifndef CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 #define CRYPTO3_ZK_COMMITMENTS_DETAIL_FOLD_POLYNOMIAL_HPP
 
+#include <algorithm>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <boost/assert.hpp>
+
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
@@ -66,33 +75,69 @@ namespace nil {
                         return f_folded;
                     }
 
+                    /**
+                     * Folds the evaluations of f on domain into f_folded, which ends up of size domain->size() / 2.
+                     * The storage of f_folded is reused, so one buffer serves all the folding steps of a round;
+                     * f_folded must not alias f. The codeword is split into contiguous chunks folded in parallel,
+                     * each chunk starting from its own power of omega^{-1}.
+                     */
+                    template<typename FieldType, typename PolynomialType>
+                    void fold_polynomial_into(const PolynomialType &f,
+                                              const typename FieldType::value_type &alpha,
+                                              std::shared_ptr<math::evaluation_domain<FieldType>>
+                                                  domain,
+                                              math::polynomial_dfs<typename FieldType::value_type> &f_folded) {
+                        typedef typename FieldType::value_type value_type;
+
+                        // codeword = [two.inverse() * ( (one + alpha / (offset * (omega^i)) ) * codeword[i]
+                        //  + (one - alpha / (offset * (omega^i)) ) * codeword[len(codeword)//2 + i] ) for i in
+                        //  range(len(codeword)//2)]
+                        // which is computed with three multiplications per point as
+                        //  (c[i] + c[n/2 + i]) / 2 + (alpha * omega^{-i} / 2) * (c[i] - c[n/2 + i]).
+                        const std::size_t half_size = domain->size() / 2;
+                        BOOST_ASSERT_MSG(f.size() >= domain->size(), "Polynomial is smaller than the folding domain");
+
+                        std::vector<value_type> folded = std::move(f_folded.get_storage());
+                        folded.resize(half_size);
+
+                        static const value_type two_inversed = value_type(2u).inversed();
+                        const value_type omega_inversed = domain->get_domain_element(domain->size() - 1);
+                        const value_type alpha_halved = alpha * two_inversed;
+
+#ifdef MULTICORE
+                        const std::size_t chunks =
+                            std::max<std::size_t>(1, std::min<std::size_t>(omp_get_max_threads(), half_size));
+#else
+                        const std::size_t chunks = 1;
+#endif
+                        const std::size_t chunk_size = (half_size + chunks - 1) / chunks;
+
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+                        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                            const std::size_t begin = std::min(chunk * chunk_size, half_size);
+                            const std::size_t end = std::min(begin + chunk_size, half_size);
+                            value_type acc = alpha_halved * omega_inversed.pow(begin);
+                            for (std::size_t i = begin; i < end; ++i) {
+                                const value_type lhs = f[i];
+                                const value_type rhs = f[half_size + i];
+                                folded[i] = two_inversed * (lhs + rhs) + acc * (lhs - rhs);
+                                acc *= omega_inversed;
+                            }
+                        }
+
+                        f_folded = math::polynomial_dfs<value_type>(half_size - 1, std::move(folded));
+                    }
+
                     template<typename FieldType>
                     math::polynomial_dfs<typename FieldType::value_type>
                         fold_polynomial(math::polynomial_dfs<typename FieldType::value_type> &f,
                                         const typename FieldType::value_type &alpha,
                                         std::shared_ptr<math::evaluation_domain<FieldType>>
                                             domain) {
-                        // codeword = [two.inverse() * ( (one + alpha / (offset * (omega^i)) ) * codeword[i]
-                        //  + (one - alpha / (offset * (omega^i)) ) * codeword[len(codeword)//2 + i] ) for i in
-                        //  range(len(codeword)//2)]
-                        math::polynomial_dfs<typename FieldType::value_type> f_folded(
-                            domain->size() / 2 - 1, domain->size() / 2, FieldType::value_type::zero());
-
-                        static const typename FieldType::value_type two_inversed =
-                            typename FieldType::value_type(2u).inversed();
-                        typename FieldType::value_type omega_inversed = domain->get_domain_element(domain->size() - 1);
-
-                        typename FieldType::value_type acc = alpha;
-
-                        for (std::size_t i = 0; i <= f_folded.degree(); i++) {
-                            size_t other_ix = domain->size() / 2 + i;
-                            // std::cout << "other_ix = " << other_ix << " f.degree() = " << f.degree() << std::endl;
-                            assert(other_ix < f.size());    // this must be true to avoid uninit reads
-                            f_folded[i] = two_inversed * ((FieldType::value_type::one() + acc) * f[i] +
-                                                          (FieldType::value_type::one() - acc) * f[other_ix]);
-                            acc *= omega_inversed;
-                        }
-
+                        math::polynomial_dfs<typename FieldType::value_type> f_folded;
+                        fold_polynomial_into<FieldType>(f, alpha, domain, f_folded);
                         return f_folded;
                     }
 
@@ -102,27 +147,8 @@ namespace nil {
                                         const typename FieldType::value_type &alpha,
                                         std::shared_ptr<math::evaluation_domain<FieldType>>
                                             domain) {
-                        // codeword = [two.inverse() * ( (one + alpha / (offset *
-                        // (omega^i)) ) * codeword[i]
-                        //  + (one - alpha / (offset * (omega^i)) ) *
-                        //  codeword[len(codeword)//2 + i] ) for i in
-                        //  range(len(codeword)//2)]
-                        math::polynomial_dfs<typename FieldType::value_type> f_folded(
-                            domain->size() / 2 - 1, domain->size() / 2, FieldType::value_type::zero());
-
-                        static const typename FieldType::value_type two_inversed =
-                            typename FieldType::value_type(2u).inversed();
-                        typename FieldType::value_type omega_inversed = domain->get_domain_element(domain->size() - 1);
-
-                        typename FieldType::value_type acc = alpha;
-
-                        for (std::size_t i = 0; i <= f_folded.degree(); i++) {
-                            f_folded[i] =
-                                two_inversed * ((FieldType::value_type::one() + acc) * f[i] +
-                                                (FieldType::value_type::one() - acc) * f[domain->size() / 2 + i]);
-                            acc *= omega_inversed;
-                        }
-
+                        math::polynomial_dfs<typename FieldType::value_type> f_folded;
+                        fold_polynomial_into<FieldType>(f, alpha, domain, f_folded);
                         return f_folded;
                     }
                 }    // namespace detail
@@ -59,12 +59,18 @@ namespace nil {
                  * <https://www.allocin.it/uploads/placeholder.pdf>
                  */
                 template<typename FieldType, typename MerkleTreeHashType, typename TranscriptHashType, std::size_t M,
-                         typename GrindingType = proof_of_work<TranscriptHashType>>
+                         typename GrindingType = proof_of_work<TranscriptHashType>, std::size_t MerkleTreeArity = 2,
+                         bool UseMerkleMultiproofs = false, std::size_t MerkleCapHeight = 0>
                 struct fri : public detail::basic_batched_fri<FieldType, MerkleTreeHashType, TranscriptHashType, M,
-                                                              GrindingType> {
-                    using basic_fri =
-                        detail::basic_batched_fri<FieldType, MerkleTreeHashType, TranscriptHashType, M, GrindingType>;
+                                                              GrindingType, MerkleTreeArity, UseMerkleMultiproofs,
+                                                              MerkleCapHeight> {
+                    using basic_fri = detail::basic_batched_fri<FieldType, MerkleTreeHashType, TranscriptHashType, M,
+                                                                GrindingType, MerkleTreeArity, UseMerkleMultiproofs,
+                                                                MerkleCapHeight>;
                     constexpr static const std::size_t m = basic_fri::m;
+                    constexpr static const std::size_t merkle_tree_arity = basic_fri::merkle_tree_arity;
+                    constexpr static const bool use_merkle_multiproofs = basic_fri::use_merkle_multiproofs;
+                    constexpr static const std::size_t merkle_cap_height = basic_fri::merkle_cap_height;
                     constexpr static const std::size_t batches_num = basic_fri::batches_num;
 
                     using field_type = typename basic_fri::field_type;
@@ -88,7 +94,9 @@ namespace nil {
                     requires(
                         std::is_base_of<
                             commitments::fri<typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                             typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                             typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                             FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                             FRI::merkle_cap_height>,
                             FRI>::value &&
                         math::EvaluationPolynomial<polynomial_dfs_type>)
                 static typename FRI::basic_fri::proof_type
@@ -114,7 +122,9 @@ namespace nil {
                     typename std::enable_if<
                         std::is_base_of<commitments::detail::basic_batched_fri<
                                             typename FRI::field_type, typename FRI::merkle_tree_hash_type,
-                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type>,
+                                            typename FRI::transcript_hash_type, FRI::m, typename FRI::grinding_type,
+                                            FRI::merkle_tree_arity, FRI::use_merkle_multiproofs,
+                                            FRI::merkle_cap_height>,
                                         FRI>::value,
                         bool>::type = true>
                 static bool verify_eval(
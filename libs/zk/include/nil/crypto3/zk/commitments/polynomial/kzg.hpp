@@ -42,6 +42,7 @@
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_normalize.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
@@ -105,6 +106,7 @@ namespace nil {
                                 commitment_key[i] = alpha_com;
                                 alpha_com = alpha * alpha_com;
                             }
+                            algebra::batch_normalize(commitment_key);
                         }
 
                         params_type(std::size_t d, scalar_value_type alpha) {
@@ -115,6 +117,7 @@ namespace nil {
                                 commitment_key[i] = alpha_com;
                                 alpha_com = alpha * alpha_com;
                             }
+                            algebra::batch_normalize(commitment_key);
                         }
 
                         params_type(single_commitment_type ck, verification_key_type vk) :
@@ -285,6 +288,8 @@ namespace nil {
                                 verification_key[i] = alpha_ver;
                                 alpha_ver *= alpha;
                             }
+                            algebra::batch_normalize(commitment_key);
+                            algebra::batch_normalize(verification_key);
                         }
 
                         params_type(std::size_t d, std::size_t t, scalar_value_type alpha) {
@@ -300,6 +305,8 @@ namespace nil {
                                 verification_key[i] = alpha_ver;
                                 alpha_ver = alpha * alpha_ver;
                             }
+                            algebra::batch_normalize(commitment_key);
+                            algebra::batch_normalize(verification_key);
                         }
 
                         params_type(const std::vector<single_commitment_type> &commitment_key,
@@ -32,6 +32,8 @@
 
 #include <queue>
 
+#include <nil/crypto3/algebra/fields/unreduced_accumulator.hpp>
+
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
 
@@ -427,20 +429,37 @@ namespace nil {
                             value_type theta_acc = theta.pow(theta_powers_for_each_batch[point_batch_index]);
                             auto [point_index, batch_id] = point_batch_pairs[point_batch_index];
                             auto const& point = points[point_index];
+                            auto& Q_normal_part = Q_normal_parts[point_index][batch_id];
 
+                            // The polynomials evaluated at the point, with their powers of theta.
+                            std::vector<std::pair<const math::polynomial<value_type>*, value_type>> terms;
                             for (std::size_t poly_idx = 0; poly_idx < this->_z.get_batch_size(batch_id); ++poly_idx) {
                                 if (!is_poly_evaluated_at_point(batch_id, poly_idx, point))
                                     continue;
 
-                                const auto& g_normal = this->_polys_coefficients[batch_id][poly_idx];
-
-                                for (std::size_t i = 0; i < g_normal.size(); ++i) {
-                                    Q_normal_parts[point_index][batch_id][i] += g_normal[i] * theta_acc;
-                                }
+                                terms.emplace_back(&this->_polys_coefficients[batch_id][poly_idx], theta_acc);
                                 const auto& Z = this->get_Z_value(batch_id, poly_idx, point);
-                                Q_normal_parts[point_index][batch_id][0] -= Z * theta_acc;
+                                Q_normal_part[0] -= Z * theta_acc;
                                 theta_acc *= theta;
                             }
+
+                            // Every coefficient is reduced once, after the products of all the polynomials are
+                            // summed. The coefficients go in blocks to bound the memory of the accumulators.
+                            constexpr std::size_t block_size = 1024;
+                            std::vector<algebra::fields::unreduced_accumulator<value_type>> sums;
+                            for (std::size_t begin = 0; begin < Q_normal_part.size(); begin += block_size) {
+                                const std::size_t end = std::min(begin + block_size, Q_normal_part.size());
+                                sums.assign(end - begin, algebra::fields::unreduced_accumulator<value_type>());
+                                for (const auto& [g_normal, power] : terms) {
+                                    const std::size_t g_end = std::min(end, g_normal->size());
+                                    for (std::size_t i = begin; i < g_end; ++i) {
+                                        sums[i - begin].mul_add((*g_normal)[i], power);
+                                    }
+                                }
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    Q_normal_part[i] += sums[i - begin].reduce();
+                                }
+                            }
                         }
 
                         return Q_normal_parts;
@@ -571,12 +590,16 @@ namespace nil {
                 };
 
                 template<typename MerkleTreeHashType, typename TranscriptHashType, std::size_t M,
-                         typename GrindingType = proof_of_work<TranscriptHashType>>
+                         typename GrindingType = proof_of_work<TranscriptHashType>, std::size_t MerkleTreeArity = 2,
+                         bool UseMerkleMultiproofs = false, std::size_t MerkleCapHeight = 0>
                 struct list_polynomial_commitment_params {
                     typedef MerkleTreeHashType merkle_hash_type;
                     typedef TranscriptHashType transcript_hash_type;
 
                     constexpr static const std::size_t m = M;
+                    constexpr static const std::size_t merkle_tree_arity = MerkleTreeArity;
+                    constexpr static const bool use_merkle_multiproofs = UseMerkleMultiproofs;
+                    constexpr static const std::size_t merkle_cap_height = MerkleCapHeight;
                     typedef GrindingType grinding_type;
                 };
 
@@ -600,11 +623,17 @@ namespace nil {
                 struct batched_list_polynomial_commitment
                     : public detail::basic_batched_fri<FieldType, typename LPCParams::merkle_hash_type,
                                                        typename LPCParams::transcript_hash_type, LPCParams::m,
-                                                       typename LPCParams::grinding_type> {
+                                                       typename LPCParams::grinding_type,
+                                                       LPCParams::merkle_tree_arity,
+                                                       LPCParams::use_merkle_multiproofs,
+                                                       LPCParams::merkle_cap_height> {
                     using fri_type =
                         typename detail::basic_batched_fri<FieldType, typename LPCParams::merkle_hash_type,
                                                            typename LPCParams::transcript_hash_type, LPCParams::m,
-                                                           typename LPCParams::grinding_type>;
+                                                           typename LPCParams::grinding_type,
+                                                           LPCParams::merkle_tree_arity,
+                                                           LPCParams::use_merkle_multiproofs,
+                                                           LPCParams::merkle_cap_height>;
                     using merkle_hash_type = typename LPCParams::merkle_hash_type;
 
                     constexpr static const std::size_t m = LPCParams::m;
@@ -613,12 +642,16 @@ namespace nil {
 
                     typedef LPCParams lpc_params;
 
-                    typedef typename containers::merkle_proof<merkle_hash_type, 2> merkle_proof_type;
+                    typedef typename containers::merkle_proof<merkle_hash_type, LPCParams::merkle_tree_arity>
+                        merkle_proof_type;
 
                     // TODO(martun): this duplicates type 'fri_type', please de-duplicate.
                     using basic_fri = detail::basic_batched_fri<FieldType, typename LPCParams::merkle_hash_type,
                                                                 typename LPCParams::transcript_hash_type, LPCParams::m,
-                                                                typename LPCParams::grinding_type>;
+                                                                typename LPCParams::grinding_type,
+                                                                LPCParams::merkle_tree_arity,
+                                                                LPCParams::use_merkle_multiproofs,
+                                                                LPCParams::merkle_cap_height>;
 
                     using precommitment_type = typename basic_fri::precommitment_type;
                     using commitment_type = typename basic_fri::commitment_type;
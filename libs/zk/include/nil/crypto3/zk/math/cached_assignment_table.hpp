@@ -28,7 +28,9 @@
 
 #include <unordered_map>
 #include <memory>
+#include <span>
 #include <utility>
+#include <vector>
 #include <stdexcept>
 #include <boost/functional/hash.hpp>
 
@@ -38,6 +40,7 @@
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/column_arena.hpp>
 #include <nil/crypto3/zk/snark/arithmetization/plonk/constraint_system.hpp>
 
 #include <nil/crypto3/bench/scoped_profiler.hpp>
@@ -58,6 +61,8 @@ namespace nil::crypto3::zk::snark {
         using var_without_rotation_type = zk::snark::plonk_variable_without_rotation<polynomial_dfs_type>;
 
         using var_and_size_pair_type = std::pair<var_without_rotation_type, std::size_t>;
+        using column_arena_type = plonk_column_arena<FieldType>;
+        using const_column_view_type = typename column_arena_type::const_column_view_type;
 
         cached_assignment_table(std::shared_ptr<plonk_polynomial_dfs_table> table,
                                 const polynomial_dfs_type& mask_assignment,
@@ -71,50 +76,77 @@ namespace nil::crypto3::zk::snark {
                                                          const polynomial_dfs_type& mask_assignment,
                                                          const polynomial_dfs_type& lagrange_0) {
 
-            // Copy all column values to a single vector.
-            std::vector<polynomial_dfs_type> all_columns;
-            all_columns.reserve(table->size());
-            all_columns.insert(all_columns.end(), table->witnesses().begin(), table->witnesses().end());
-            all_columns.insert(all_columns.end(), table->public_inputs().begin(), table->public_inputs().end());
-            all_columns.insert(all_columns.end(), table->constants().begin(), table->constants().end());
-            all_columns.insert(all_columns.end(), table->selectors().begin(), table->selectors().end());
-
-            // Convert everything to coefficients form.
-            std::vector<polynomial_type> table_coeffs =
-                math::polynomial_batch_to_coefficients<FieldType>(std::move(all_columns), _domain);
+            // All columns and the two special selectors are stored in a single arena, allocated once. The
+            // inverse FFT reads the table columns and writes their coefficients straight into the arena, so the
+            // table is never copied there in its DFS form.
+            const std::size_t special_selectors_amount = 2;
+            _assignment_table_coefficients_arena =
+                column_arena_type(table->size() + special_selectors_amount, _original_domain_size, true);
+
+            std::vector<std::span<const value_type>> table_columns;
+            table_columns.reserve(table->size() + 1);
+            for (const auto& column : table->witnesses()) {
+                table_columns.emplace_back(column.begin(), column.end());
+            }
+            for (const auto& column : table->public_inputs()) {
+                table_columns.emplace_back(column.begin(), column.end());
+            }
+            for (const auto& column : table->constants()) {
+                table_columns.emplace_back(column.begin(), column.end());
+            }
+            for (const auto& column : table->selectors()) {
+                table_columns.emplace_back(column.begin(), column.end());
+            }
+            table_columns.emplace_back(mask_assignment.begin(), mask_assignment.end());
+
+            const std::size_t all_rows_index = table->size();
+            const std::size_t all_non_first_rows_index = all_rows_index + 1;
+            _domain->batch_inverse_fft_views(table_columns,
+                                             _assignment_table_coefficients_arena.columns(0, all_rows_index + 1));
+
+            // The last selector is derived from the mask, it is computed in the arena and converted in place.
+            if (lagrange_0.size() == mask_assignment.size()) {
+                auto column = _assignment_table_coefficients_arena.column(all_non_first_rows_index);
+                for (std::size_t i = 0; i < column.size(); ++i) {
+                    column[i] = mask_assignment[i] - lagrange_0[i];
+                }
+            } else {
+                _assignment_table_coefficients_arena.assign_column(all_non_first_rows_index,
+                                                                   mask_assignment - lagrange_0);
+            }
+            _domain->batch_inverse_fft_views(_assignment_table_coefficients_arena.columns(all_non_first_rows_index, 1));
 
             size_t idx = 0;
             for (size_t i = 0; i < table->witnesses_amount(); ++i) {
                 var_without_rotation_type v(i, var_without_rotation_type::column_type::witness);
-                _assignment_table_coefficients[v] = std::make_shared<polynomial_type>(std::move(table_coeffs[idx]));
+                _assignment_table_coefficients[v] = _assignment_table_coefficients_arena.column(idx);
                 idx++;
             }
             for (size_t i = 0; i < table->public_inputs_amount(); ++i) {
                 var_without_rotation_type v(i, var_without_rotation_type::column_type::public_input);
-                _assignment_table_coefficients[v] = std::make_shared<polynomial_type>(std::move(table_coeffs[idx]));
+                _assignment_table_coefficients[v] = _assignment_table_coefficients_arena.column(idx);
                 idx++;
             }
             for (size_t i = 0; i < table->constants_amount(); ++i) {
                 var_without_rotation_type v(i, var_without_rotation_type::column_type::constant);
-                _assignment_table_coefficients[v] = std::make_shared<polynomial_type>(std::move(table_coeffs[idx]));
+                _assignment_table_coefficients[v] = _assignment_table_coefficients_arena.column(idx);
                 idx++;
             }
             for (size_t i = 0; i < table->selectors_amount(); ++i) {
                 var_without_rotation_type v(i, var_without_rotation_type::column_type::selector);
-                _assignment_table_coefficients[v] = std::make_shared<polynomial_type>(std::move(table_coeffs[idx]));
+                _assignment_table_coefficients[v] = _assignment_table_coefficients_arena.column(idx);
                 idx++;
             }
 
-            // Now create coefficients forms for special selectors.
+            // Special selectors keep their trailing zero coefficients trimmed, as polynomial_dfs::coefficients
+            // does, so the degree of their cached DFS forms stays the same.
             var_without_rotation_type v_all_rows(PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED,
                                                  var_without_rotation_type::column_type::selector);
-            _assignment_table_coefficients[v_all_rows] =
-                std::make_shared<polynomial_type>(mask_assignment.coefficients(_domain));
+            _assignment_table_coefficients[v_all_rows] = trimmed_coefficients(all_rows_index);
 
             var_without_rotation_type v_all_non_first_rows(PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED,
                                                            var_without_rotation_type::column_type::selector);
-            _assignment_table_coefficients[v_all_non_first_rows] =
-                std::make_shared<polynomial_type>((mask_assignment - lagrange_0).coefficients(_domain));
+            _assignment_table_coefficients[v_all_non_first_rows] = trimmed_coefficients(all_non_first_rows_index);
         }
 
         cached_assignment_table(const cached_assignment_table&) = default;
@@ -179,7 +211,7 @@ namespace nil::crypto3::zk::snark {
                 // Here we take from _assignment_table_coefficients the variable value
                 // without rotation.
                 auto value_dfs = std::make_shared<polynomial_dfs_type>();
-                value_dfs->from_coefficients(*_assignment_table_coefficients[new_vars[i]], get_domain(size));
+                value_dfs->from_coefficients(_assignment_table_coefficients.at(new_vars[i]), get_domain(size));
                 _cache[std::make_pair(new_vars[i], size)][0] = value_dfs;
             }
 
@@ -210,6 +242,15 @@ namespace nil::crypto3::zk::snark {
         }
 
     private:
+        const_column_view_type trimmed_coefficients(std::size_t column_index) const {
+            const_column_view_type column = _assignment_table_coefficients_arena.column(column_index);
+            std::size_t size = column.size();
+            while (size > 1 && column[size - 1] == value_type::zero()) {
+                --size;
+            }
+            return column.first(size);
+        }
+
         struct var_and_size_pair_hash {
             std::size_t operator()(const var_and_size_pair_type& v) const {
                 auto v_hash = boost::hash_value(v.first.index);
@@ -226,8 +267,10 @@ namespace nil::crypto3::zk::snark {
                            var_and_size_pair_hash>
             _cache;
 
-        // The whole assignment table and special selectors in the coefficients form.
-        std::unordered_map<var_without_rotation_type, std::shared_ptr<polynomial_type>> _assignment_table_coefficients;
+        // The whole assignment table and special selectors in the coefficients form, stored column-major in
+        // a single arena. The map holds views into the arena.
+        column_arena_type _assignment_table_coefficients_arena;
+        std::unordered_map<var_without_rotation_type, const_column_view_type> _assignment_table_coefficients;
 
         std::size_t _original_domain_size;
         std::shared_ptr<domain_type> _domain;
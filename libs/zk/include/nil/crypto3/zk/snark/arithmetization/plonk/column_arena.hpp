@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ZK_PLONK_COLUMN_ARENA_HPP
+#define CRYPTO3_ZK_PLONK_COLUMN_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace zk {
+            namespace snark {
+                namespace detail {
+
+                    // Arenas smaller than a single huge page gain nothing from huge-page backing.
+                    constexpr std::size_t column_arena_huge_page_size = std::size_t(2) << 20;
+                    constexpr std::size_t column_arena_alignment = 64;
+
+                    /*
+                     * Releases arena memory obtained by allocate_column_arena_storage and destroys the
+                     * elements living in it.
+                     */
+                    template<typename ValueType>
+                    struct column_arena_deleter {
+                        std::size_t elements_amount = 0;
+                        std::size_t mapped_bytes = 0;
+
+                        void operator()(ValueType *p) const {
+                            std::destroy_n(p, elements_amount);
+#if defined(__linux__)
+                            if (mapped_bytes != 0) {
+                                ::munmap(p, mapped_bytes);
+                                return;
+                            }
+#endif
+                            ::operator delete(p, std::align_val_t(column_arena_alignment));
+                        }
+                    };
+
+                    /*
+                     * Allocates storage for elements_amount values, zero-initialized to ValueType::zero().
+                     * If use_huge_pages is set and the arena is large enough, on Linux the storage is mapped
+                     * anonymously and advised to be backed by transparent huge pages, which cuts TLB misses when
+                     * FFTs stride across columns of 2^20 and more rows. Falls back to aligned operator new.
+                     */
+                    template<typename ValueType>
+                    std::shared_ptr<ValueType> allocate_column_arena_storage(std::size_t elements_amount,
+                                                                             bool use_huge_pages) {
+                        column_arena_deleter<ValueType> deleter;
+                        deleter.elements_amount = elements_amount;
+
+                        const std::size_t bytes = std::max<std::size_t>(elements_amount * sizeof(ValueType), 1);
+                        void *raw = nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+                        if (use_huge_pages && bytes >= column_arena_huge_page_size) {
+                            const std::size_t mapped_bytes =
+                                (bytes + column_arena_huge_page_size - 1) & ~(column_arena_huge_page_size - 1);
+                            void *mapped = ::mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE,
+                                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                            if (mapped != MAP_FAILED) {
+                                // The advice is best-effort, the mapping is usable whether it is honoured or not.
+                                ::madvise(mapped, mapped_bytes, MADV_HUGEPAGE);
+                                raw = mapped;
+                                deleter.mapped_bytes = mapped_bytes;
+                            }
+                        }
+#else
+                        (void)use_huge_pages;
+#endif
+                        if (raw == nullptr) {
+                            raw = ::operator new(bytes, std::align_val_t(column_arena_alignment));
+                        }
+
+                        ValueType *data = static_cast<ValueType *>(raw);
+                        try {
+                            std::uninitialized_fill_n(data, elements_amount, ValueType::zero());
+                        } catch (...) {
+                            deleter.elements_amount = 0;
+                            deleter(data);
+                            throw;
+                        }
+                        return std::shared_ptr<ValueType>(data, deleter);
+                    }
+                }    // namespace detail
+
+                /**
+                 * @brief Column-major storage for a whole plonk table in one contiguous allocation.
+                 *
+                 * Column i occupies rows [i * rows_amount, (i + 1) * rows_amount) of the arena and is handed out
+                 * as a std::span, so batch FFTs and other column-wise passes work directly on the arena without
+                 * per-column allocations or copies. Copies of an arena are shallow and share the storage, in the
+                 * same way cached polynomials are shared through shared_ptr elsewhere in the prover.
+                 */
+                template<typename FieldType>
+                class plonk_column_arena {
+                public:
+                    using field_type = FieldType;
+                    using value_type = typename FieldType::value_type;
+                    using column_view_type = std::span<value_type>;
+                    using const_column_view_type = std::span<const value_type>;
+
+                    plonk_column_arena() = default;
+
+                    plonk_column_arena(std::size_t columns_amount, std::size_t rows_amount,
+                                       bool use_huge_pages = false) :
+                        _storage(detail::allocate_column_arena_storage<value_type>(columns_amount * rows_amount,
+                                                                                   use_huge_pages)),
+                        _columns_amount(columns_amount), _rows_amount(rows_amount) {
+                    }
+
+                    std::size_t columns_amount() const {
+                        return _columns_amount;
+                    }
+
+                    std::size_t rows_amount() const {
+                        return _rows_amount;
+                    }
+
+                    value_type *data() {
+                        return _storage.get();
+                    }
+
+                    const value_type *data() const {
+                        return _storage.get();
+                    }
+
+                    column_view_type column(std::size_t index) {
+                        BOOST_ASSERT(index < _columns_amount);
+                        return column_view_type(_storage.get() + index * _rows_amount, _rows_amount);
+                    }
+
+                    const_column_view_type column(std::size_t index) const {
+                        BOOST_ASSERT(index < _columns_amount);
+                        return const_column_view_type(_storage.get() + index * _rows_amount, _rows_amount);
+                    }
+
+                    const_column_view_type operator[](std::size_t index) const {
+                        return column(index);
+                    }
+
+                    /**
+                     * Views of columns [first, first + amount), e.g. to feed them to
+                     * evaluation_domain::batch_fft_views.
+                     */
+                    std::vector<column_view_type> columns(std::size_t first, std::size_t amount) {
+                        BOOST_ASSERT(first + amount <= _columns_amount);
+                        std::vector<column_view_type> result;
+                        result.reserve(amount);
+                        for (std::size_t i = first; i < first + amount; ++i) {
+                            result.push_back(column(i));
+                        }
+                        return result;
+                    }
+
+                    std::vector<column_view_type> columns() {
+                        return columns(0, _columns_amount);
+                    }
+
+                    /**
+                     * Copies values into the column, padding the tail with zeros.
+                     */
+                    template<typename Range>
+                    void assign_column(std::size_t index, const Range &values) {
+                        column_view_type target = column(index);
+                        if (std::size_t(std::distance(std::begin(values), std::end(values))) > target.size()) {
+                            throw std::invalid_argument("Column is longer than the arena rows amount");
+                        }
+                        auto it = std::copy(std::begin(values), std::end(values), target.begin());
+                        std::fill(it, target.end(), value_type::zero());
+                    }
+
+                private:
+                    std::shared_ptr<value_type> _storage;
+                    std::size_t _columns_amount = 0;
+                    std::size_t _rows_amount = 0;
+                };
+            }    // namespace snark
+        }    // namespace zk
+    }    // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ZK_PLONK_COLUMN_ARENA_HPP
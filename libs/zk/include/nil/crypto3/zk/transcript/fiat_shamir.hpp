@@ -27,6 +27,13 @@
 #ifndef CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 #define CRYPTO3_ZK_TRANSCRIPT_FIAT_SHAMIR_HEURISTIC_HPP
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include <nil/marshalling/algorithms/pack.hpp>
 #include <nil/crypto3/marshalling/algebra/types/field_element.hpp>
 #include <nil/crypto3/marshalling/algebra/types/curve_element.hpp>
@@ -48,6 +55,56 @@ namespace nil {
     namespace crypto3 {
         namespace zk {
             namespace transcript {
+                namespace detail {
+                    /*!
+                     * @brief Big-endian marshalling of a field or curve element into a fixed-size stack buffer.
+                     * Produces the same bytes as nil::marshalling::pack<big_endian> without the intermediate
+                     * std::vector.
+                     */
+                    template<typename ElementType>
+                    struct transcript_element_bytes {
+                        using marshalling_type = typename nil::marshalling::is_compatible<
+                            ElementType>::template type<nil::marshalling::option::big_endian>;
+
+                        constexpr static const std::size_t max_length = marshalling_type::max_length();
+                        typedef std::array<std::uint8_t, max_length> buffer_type;
+
+                        static std::size_t pack(const ElementType &data, buffer_type &buffer) {
+                            return write(data, buffer.begin());
+                        }
+
+                        /*!
+                         * @brief Writes at most max_length bytes starting at out, returns how many were written.
+                         */
+                        template<typename OutputIterator>
+                        static std::size_t write(const ElementType &data, OutputIterator out) {
+                            marshalling_type marshalled(data);
+                            const std::size_t length = marshalled.length();
+                            nil::marshalling::status_type status = marshalled.write(out, length);
+                            THROW_IF_ERROR_STATUS(status, "transcript_element_bytes::write");
+                            return length;
+                        }
+                    };
+
+                    /*!
+                     * @brief Big-endian marshalling of a range of field or curve elements into one contiguous
+                     * buffer, the elements following each other without separators.
+                     */
+                    template<typename ForwardIterator>
+                    std::vector<std::uint8_t> transcript_elements_bytes(ForwardIterator first, ForwardIterator last) {
+                        using element_bytes =
+                            transcript_element_bytes<typename std::iterator_traits<ForwardIterator>::value_type>;
+
+                        std::vector<std::uint8_t> result(std::distance(first, last) * element_bytes::max_length);
+                        std::size_t length = 0;
+                        for (; first != last; ++first) {
+                            length += element_bytes::write(*first, result.begin() + length);
+                        }
+                        result.resize(length);
+                        return result;
+                    }
+                }    // namespace detail
+
                 /*!
                  * @brief Fiat–Shamir heuristic.
                  * @tparam Hash Hash function, which serves as a non-interactive random oracle.
@@ -168,13 +225,31 @@ namespace nil {
                     typename std::enable_if_t<algebra::is_curve_element<element>::value ||
                                               algebra::is_field_element<element>::value>
                         operator()(element const &data) {
-                        nil::marshalling::status_type status;
-                        std::vector<std::uint8_t> byte_data =
-                            nil::marshalling::pack<nil::marshalling::option::big_endian>(data, status);
-                        THROW_IF_ERROR_STATUS(status, "fiat_shamir_heuristic_sequential::operator()");
+                        using element_bytes = detail::transcript_element_bytes<element>;
+
+                        typename element_bytes::buffer_type byte_data;
+                        const std::size_t length = element_bytes::pack(data, byte_data);
                         auto acc_convertible = hash<hash_type>(state);
                         state = accumulators::extract::hash<hash_type>(
-                            hash<hash_type>(byte_data, static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                            hash<hash_type>(byte_data.cbegin(), byte_data.cbegin() + length,
+                                            static_cast<accumulator_set<hash_type> &>(acc_convertible)));
+                    }
+
+                    /*!
+                     * @brief Absorbs a whole range of field or curve elements, e.g. an evaluation vector, with
+                     * one hash over the state and the marshalled elements. This equals absorbing the concatenated
+                     * marshalled bytes as a byte range. Calling operator() on every element instead rehashes the
+                     * state per element, which is what existing proofs were built with.
+                     */
+                    template<typename ForwardIterator>
+                    void absorb_elements(ForwardIterator first, ForwardIterator last) {
+                        const std::vector<std::uint8_t> byte_data = detail::transcript_elements_bytes(first, last);
+                        (*this)(byte_data.cbegin(), byte_data.cend());
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::cbegin(r), std::cend(r));
                     }
 
                     template<typename FieldType>
@@ -260,6 +335,7 @@ namespace nil {
                     typename std::enable_if<nil::crypto3::hashes::is_poseidon<HashType>::value>::type> {
                     typedef HashType hash_type;
                     using field_type = typename HashType::policy_type::field_type;
+                    using word_type = typename hash_type::word_type;
                     using sponge_type = typename HashType::construction::type;
                     using block_type = typename sponge_type::block_type;
 
@@ -301,6 +377,44 @@ namespace nil {
                         absorb(hash<hash_type>(first, last));
                     }
 
+                    /*!
+                     * @brief Absorbs a whole range of field or curve elements, curve elements as their affine
+                     * coordinates, packed into full rate blocks behind the number of words. operator() takes one
+                     * block, and so one permutation, per element and is what existing proofs were built with.
+                     */
+                    template<typename ForwardIterator>
+                    void absorb_elements(ForwardIterator first, ForwardIterator last) {
+                        using element_type = typename std::iterator_traits<ForwardIterator>::value_type;
+                        constexpr std::size_t words_per_element =
+                            algebra::is_curve_element<element_type>::value ? 2 : 1;
+                        constexpr std::size_t rate = sponge_type::block_words;
+
+                        std::vector<word_type> words;
+                        words.reserve(1 + words_per_element * std::distance(first, last));
+                        words.emplace_back(std::distance(first, last) * words_per_element);
+                        for (; first != last; ++first) {
+                            if constexpr (algebra::is_curve_element<element_type>::value) {
+                                auto affine = first->to_affine();
+                                words.push_back(affine.X);
+                                words.push_back(affine.Y);
+                            } else {
+                                words.push_back(*first);
+                            }
+                        }
+
+                        for (std::size_t i = 0; i < words.size(); i += rate) {
+                            block_type block {};
+                            std::copy(words.begin() + i, words.begin() + std::min(i + rate, words.size()),
+                                      block.begin());
+                            absorb_block(block);
+                        }
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::cbegin(r), std::cend(r));
+                    }
+
                     template<typename FieldType>
                     typename FieldType::value_type challenge() {
                         static_assert(std::is_same<FieldType, field_type>::value,
@@ -357,19 +471,21 @@ namespace nil {
                 private:
                     template<typename InputType>
                     void absorb(const InputType &input) {
-                        if (has_squeezed) {
-                            sponge.reset();
-                            sponge.absorb(last_squeezed_block);
-                            has_squeezed = false;
-                        }
-
                         block_type block {};
-                        if constexpr (std::is_same<typename std::decay<InputType>::type,
-                                                   typename hash_type::word_type>::value) {
+                        if constexpr (std::is_same<typename std::decay<InputType>::type, word_type>::value) {
                             block[0] = input;
                         } else {
                             std::copy(input.begin(), input.end(), block.begin());
                         }
+                        absorb_block(block);
+                    }
+
+                    void absorb_block(const block_type &block) {
+                        if (has_squeezed) {
+                            sponge.reset();
+                            sponge.absorb(last_squeezed_block);
+                            has_squeezed = false;
+                        }
                         sponge.absorb(block);
                     }
 
@@ -380,6 +496,380 @@ namespace nil {
                     block_type last_squeezed_block {};
                     bool has_squeezed = false;
                 };
+
+                /*!
+                 * @brief Duplex-sponge Fiat–Shamir transcript.
+                 *
+                 * Unlike fiat_shamir_heuristic_sequential, which rehashes the previous digest together with
+                 * every absorbed value and runs one more full hash per challenge, this transcript keeps the
+                 * sponge state between calls. Absorbing only costs a permutation per filled rate block and
+                 * one squeeze permutation serves as many challenges as fit into the rate.
+                 *
+                 * The challenges differ from fiat_shamir_heuristic_sequential. Provers and verifiers that
+                 * must reproduce existing proofs keep using the sequential transcript, which exposes the same
+                 * interface including absorb_elements().
+                 *
+                 * @tparam HashType keccak_1600 or one of the Poseidon hashes, which provides the permutation.
+                 */
+                template<typename HashType, typename Enable = void>
+                struct fiat_shamir_heuristic_duplex;
+
+                /*!
+                 * Keccak-f[1600] duplex over bytes. Field and curve elements are absorbed in their big-endian
+                 * marshalled form, byte ranges are prefixed with their 64-bit length. The first squeeze after
+                 * absorbing uses Keccak padding, so its first digest_bits equal keccak_1600 of the absorbed
+                 * bytes.
+                 */
+                template<typename HashType>
+                struct fiat_shamir_heuristic_duplex<
+                    HashType,
+                    typename std::enable_if<
+                        std::is_same<HashType, hashes::keccak_1600<HashType::digest_bits>>::value>::type> {
+                    typedef HashType hash_type;
+                    typedef typename hash_type::policy_type policy_type;
+                    typedef typename policy_type::state_type state_type;
+                    typedef typename policy_type::word_type word_type;
+                    typedef hashes::detail::keccak_1600_impl<policy_type> permutation_type;
+
+                    constexpr static const std::size_t rate_bytes = policy_type::block_bits / 8;
+
+                    fiat_shamir_heuristic_duplex() : state(), position(0), squeezing(false) {
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_duplex(const InputRange &r) : fiat_shamir_heuristic_duplex() {
+                        (*this)(r);
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_duplex(InputIterator first, InputIterator last) :
+                        fiat_shamir_heuristic_duplex() {
+                        (*this)(first, last);
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<!algebra::is_curve_element<InputRange>::value &&
+                                              !algebra::is_field_element<InputRange>::value>
+                        operator()(const InputRange &r) {
+                        (*this)(std::cbegin(r), std::cend(r));
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        std::uint64_t length = static_cast<std::uint64_t>(std::distance(first, last));
+                        for (std::size_t i = 0; i < sizeof(length); ++i) {
+                            absorb_byte(static_cast<std::uint8_t>(length >> (8 * (sizeof(length) - 1 - i))));
+                        }
+                        for (; first != last; ++first) {
+                            absorb_byte(static_cast<std::uint8_t>(*first));
+                        }
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<algebra::is_curve_element<element>::value ||
+                                              algebra::is_field_element<element>::value>
+                        operator()(element const &data) {
+                        using element_bytes = detail::transcript_element_bytes<element>;
+
+                        typename element_bytes::buffer_type byte_data;
+                        const std::size_t length = element_bytes::pack(data, byte_data);
+                        absorb_bytes(byte_data.data(), length);
+                    }
+
+                    /*!
+                     * @brief Absorbs a whole range of field or curve elements, e.g. an evaluation vector, by
+                     * marshalling it into one buffer and absorbing that in one pass over the sponge. Elements are
+                     * not prefixed, so this equals calling operator() on every element.
+                     */
+                    template<typename ForwardIterator>
+                    void absorb_elements(ForwardIterator first, ForwardIterator last) {
+                        const std::vector<std::uint8_t> byte_data = detail::transcript_elements_bytes(first, last);
+                        absorb_bytes(byte_data.data(), byte_data.size());
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::cbegin(r), std::cend(r));
+                    }
+
+                    /*!
+                     * Squeezes 128 bits more than the modulus size and reduces, which keeps the challenge
+                     * statistically close to uniform.
+                     */
+                    template<typename FieldType>
+                    typename FieldType::value_type challenge() {
+                        constexpr static const std::size_t challenge_bytes = (FieldType::modulus_bits + 7) / 8 + 16;
+
+                        std::array<std::uint8_t, challenge_bytes> byte_data;
+                        for (auto &b : byte_data) {
+                            b = squeeze_byte();
+                        }
+                        nil::marshalling::status_type status;
+                        boost::multiprecision::number<
+                            boost::multiprecision::cpp_int_modular_backend<challenge_bytes * 8>>
+                            raw_result =
+                                nil::marshalling::pack<nil::marshalling::option::big_endian>(byte_data, status);
+                        BOOST_ASSERT(status == nil::marshalling::status_type::success);
+                        return typename FieldType::value_type(raw_result);
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        typename std::make_unsigned<Integral>::type result = 0;
+                        for (std::size_t i = 0; i < sizeof(Integral); ++i) {
+                            result = (result << 8) | squeeze_byte();
+                        }
+                        return static_cast<Integral>(result);
+                    }
+
+                    template<typename FieldType, std::size_t N>
+                    std::array<typename FieldType::value_type, N> challenges() {
+                        std::array<typename FieldType::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<FieldType>();
+                        }
+
+                        return result;
+                    }
+
+                    template<typename FieldType>
+                    std::vector<typename FieldType::value_type> challenges(std::size_t N) {
+                        std::vector<typename FieldType::value_type> result;
+                        result.reserve(N);
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result.push_back(challenge<FieldType>());
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    void xor_byte(std::size_t index, std::uint8_t value) {
+                        state[index / sizeof(word_type)] ^= static_cast<word_type>(value)
+                                                            << (8 * (index % sizeof(word_type)));
+                    }
+
+                    void absorb_byte(std::uint8_t value) {
+                        if (squeezing) {
+                            // Unread output stays in the rate; new input is mixed in on top of it.
+                            squeezing = false;
+                            position = 0;
+                        }
+                        xor_byte(position++, value);
+                        if (position == rate_bytes) {
+                            permutation_type::permute(state);
+                            position = 0;
+                        }
+                    }
+
+                    void absorb_bytes(const std::uint8_t *data, std::size_t size) {
+                        if (size != 0 && squeezing) {
+                            squeezing = false;
+                            position = 0;
+                        }
+                        while (size != 0) {
+                            const std::size_t chunk = std::min(size, rate_bytes - position);
+                            for (std::size_t i = 0; i < chunk; ++i) {
+                                xor_byte(position + i, data[i]);
+                            }
+                            position += chunk;
+                            data += chunk;
+                            size -= chunk;
+                            if (position == rate_bytes) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                        }
+                    }
+
+                    std::uint8_t squeeze_byte() {
+                        if (!squeezing) {
+                            xor_byte(position, 0x01);
+                            xor_byte(rate_bytes - 1, 0x80);
+                            permutation_type::permute(state);
+                            squeezing = true;
+                            position = 0;
+                        } else if (position == rate_bytes) {
+                            permutation_type::permute(state);
+                            position = 0;
+                        }
+                        std::uint8_t result = static_cast<std::uint8_t>(state[position / sizeof(word_type)] >>
+                                                                        (8 * (position % sizeof(word_type))));
+                        ++position;
+                        return result;
+                    }
+
+                    state_type state;
+                    std::size_t position;
+                    bool squeezing;
+                };
+
+                /*!
+                 * Poseidon duplex over field elements. Each element goes into its own rate cell, so a
+                 * permutation absorbs a full rate block instead of one element. Byte ranges are hashed first and
+                 * curve elements are absorbed as affine coordinates, as in the sequential Poseidon transcript.
+                 * Every permutation in the squeeze phase yields a rate block of challenges.
+                 *
+                 * Elements are added into the rate, so a trailing zero element alone would not change the state.
+                 * The first squeeze therefore adds the number of elements absorbed since the previous squeeze,
+                 * plus one, to the capacity cell.
+                 */
+                template<typename HashType>
+                struct fiat_shamir_heuristic_duplex<
+                    HashType,
+                    typename std::enable_if<nil::crypto3::hashes::is_poseidon<HashType>::value>::type> {
+                    typedef HashType hash_type;
+                    using policy_type = typename hash_type::policy_type;
+                    using field_type = typename policy_type::field_type;
+                    using word_type = typename policy_type::word_type;
+                    using state_type = typename policy_type::state_type;
+                    using permutation_type = typename hash_type::permutation_type;
+
+                    constexpr static const std::size_t rate = policy_type::block_words;
+
+                    fiat_shamir_heuristic_duplex() :
+                        state(policy_type::iv_generator::generate()), position(0), absorbed(0), squeezing(false) {
+                    }
+
+                    template<typename InputRange>
+                    fiat_shamir_heuristic_duplex(const InputRange &r) : fiat_shamir_heuristic_duplex() {
+                        if (r.size() != 0) {
+                            (*this)(r);
+                        }
+                    }
+
+                    template<typename InputIterator>
+                    fiat_shamir_heuristic_duplex(InputIterator first, InputIterator last) :
+                        fiat_shamir_heuristic_duplex() {
+                        (*this)(first, last);
+                    }
+
+                    void operator()(const word_type &input) {
+                        absorb_word(input);
+                    }
+
+                    template<typename InputRange>
+                    typename std::enable_if_t<!algebra::is_curve_element<InputRange>::value>
+                        operator()(const InputRange &r) {
+                        absorb_word(static_cast<typename hash_type::digest_type>(hash<hash_type>(r)));
+                    }
+
+                    template<typename element>
+                    typename std::enable_if_t<algebra::is_curve_element<element>::value>
+                        operator()(element const &data) {
+                        auto affine = data.to_affine();
+                        absorb_word(affine.X);
+                        absorb_word(affine.Y);
+                    }
+
+                    template<typename InputIterator>
+                    void operator()(InputIterator first, InputIterator last) {
+                        absorb_word(static_cast<typename hash_type::digest_type>(hash<hash_type>(first, last)));
+                    }
+
+                    /*!
+                     * @brief Absorbs a whole range of field or curve elements, curve elements as their affine
+                     * coordinates, in one pass over the rate. This equals calling operator() on every element.
+                     */
+                    template<typename ForwardIterator>
+                    void absorb_elements(ForwardIterator first, ForwardIterator last) {
+                        using element_type = typename std::iterator_traits<ForwardIterator>::value_type;
+
+                        if constexpr (algebra::is_curve_element<element_type>::value) {
+                            std::vector<word_type> words;
+                            words.reserve(2 * std::distance(first, last));
+                            for (; first != last; ++first) {
+                                auto affine = first->to_affine();
+                                words.push_back(affine.X);
+                                words.push_back(affine.Y);
+                            }
+                            absorb_words(words.cbegin(), words.cend());
+                        } else {
+                            absorb_words(first, last);
+                        }
+                    }
+
+                    template<typename InputRange>
+                    void absorb_elements(const InputRange &r) {
+                        absorb_elements(std::cbegin(r), std::cend(r));
+                    }
+
+                    template<typename FieldType>
+                    typename FieldType::value_type challenge() {
+                        static_assert(std::is_same<FieldType, field_type>::value,
+                                      "Poseidon transcript challenges must use the Poseidon field");
+                        return squeeze_word();
+                    }
+
+                    template<typename Integral>
+                    Integral int_challenge() {
+                        typename field_type::integral_type raw_result = squeeze_word().to_integral();
+                        raw_result &= std::numeric_limits<typename std::make_unsigned<Integral>::type>::max();
+                        return static_cast<Integral>(raw_result);
+                    }
+
+                    template<typename FieldType, std::size_t N>
+                    std::array<typename FieldType::value_type, N> challenges() {
+                        std::array<typename FieldType::value_type, N> result;
+                        for (auto &ch : result) {
+                            ch = challenge<FieldType>();
+                        }
+
+                        return result;
+                    }
+
+                    template<typename FieldType>
+                    std::vector<typename FieldType::value_type> challenges(std::size_t N) {
+                        std::vector<typename FieldType::value_type> result;
+                        result.reserve(N);
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result.push_back(challenge<FieldType>());
+                        }
+
+                        return result;
+                    }
+
+                private:
+                    void absorb_word(const word_type &input) {
+                        absorb_words(&input, &input + 1);
+                    }
+
+                    template<typename ForwardIterator>
+                    void absorb_words(ForwardIterator first, ForwardIterator last) {
+                        if (first != last && squeezing) {
+                            squeezing = false;
+                            position = 0;
+                        }
+                        for (; first != last; ++first) {
+                            ++absorbed;
+                            state[position++] += *first;
+                            if (position == rate) {
+                                permutation_type::permute(state);
+                                position = 0;
+                            }
+                        }
+                    }
+
+                    word_type squeeze_word() {
+                        if (!squeezing) {
+                            // Length-separates the absorbed input, and the squeeze from absorbing a full block.
+                            state[rate] += word_type(absorbed + 1);
+                            absorbed = 0;
+                            permutation_type::permute(state);
+                            squeezing = true;
+                            position = 0;
+                        } else if (position == rate) {
+                            permutation_type::permute(state);
+                            position = 0;
+                        }
+                        return state[position++];
+                    }
+
+                    state_type state;
+                    std::size_t position;
+                    std::size_t absorbed;
+                    bool squeezing;
+                };
             }    // namespace transcript
         }    // namespace zk
     }    // namespace crypto3
@@ -26,6 +26,8 @@
 
 #define BOOST_TEST_MODULE fold_polynomial_test
 
+#include <array>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
@@ -132,6 +134,44 @@ void test_fold_polynomial_dfs() {
     BOOST_CHECK(x1 == x2);
 }
 
+template<typename CurveType>
+void test_fold_polynomial_into_reused_buffers() {
+    using FieldType = typename CurveType::base_field_type;
+    using value_type = typename FieldType::value_type;
+
+    constexpr static const std::size_t d_log = 8;
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(d_log, 4);
+
+    math::polynomial<value_type> f(D[0]->size());
+    for (std::size_t i = 0; i < f.size(); i++) {
+        f[i] = algebra::random_element<FieldType>();
+    }
+    math::polynomial_dfs<value_type> f_dfs;
+    f_dfs.from_coefficients(f, D[0]);
+
+    // Fold three times, ping-ponging between two buffers as the FRI commit phase does, and compare with the folding
+    // of the coefficients.
+    std::array<math::polynomial_dfs<value_type>, 2> buffers;
+    std::size_t current = 0;
+    for (std::size_t t = 0; t < 3; ++t) {
+        value_type alpha = algebra::random_element<FieldType>();
+        if (t == 0) {
+            zk::commitments::detail::fold_polynomial_into<FieldType>(f_dfs, alpha, D[t], buffers[current]);
+        } else {
+            zk::commitments::detail::fold_polynomial_into<FieldType>(buffers[current ^ 1], alpha, D[t],
+                                                                     buffers[current]);
+        }
+        f = zk::commitments::detail::fold_polynomial<FieldType>(f, alpha);
+
+        math::polynomial_dfs<value_type> expected;
+        expected.from_coefficients(f, D[t + 1]);
+        BOOST_CHECK_EQUAL(buffers[current].size(), D[t]->size() / 2);
+        BOOST_CHECK(std::equal(buffers[current].begin(), buffers[current].end(), expected.begin()));
+        current ^= 1;
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(parallel_fold_polynomial_test_suite)
 
 BOOST_AUTO_TEST_CASE(parallel_fold_polynomial_test) {
@@ -151,4 +191,8 @@ BOOST_AUTO_TEST_CASE(fold_polynomial_dfs_test) {
     test_fold_polynomial_dfs<algebra::curves::vesta>();
 }
 
+BOOST_AUTO_TEST_CASE(fold_polynomial_into_reused_buffers_test) {
+    test_fold_polynomial_into_reused_buffers<algebra::curves::pallas>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
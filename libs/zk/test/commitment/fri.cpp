@@ -56,7 +56,8 @@ using namespace nil::crypto3;
 
 BOOST_AUTO_TEST_SUITE(parallel_fri_test_suite)
 
-template<typename FieldType, typename PolynomialType>
+template<typename FieldType, typename PolynomialType, bool UseMerkleMultiproofs = false,
+         std::size_t MerkleTreeArity = 2, std::size_t MerkleCapHeight = 0, std::size_t MerklePrunedRows = 0>
 void fri_basic_test() {
     // setup
     typedef hashes::sha2<256> merkle_hash_type;
@@ -68,7 +69,10 @@ void fri_basic_test() {
     constexpr static const std::size_t m = 2;
     constexpr static const std::size_t lambda = 40;
 
-    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m> fri_type;
+    typedef zk::commitments::fri<FieldType, merkle_hash_type, transcript_hash_type, m,
+                                 zk::commitments::proof_of_work<transcript_hash_type>, MerkleTreeArity,
+                                 UseMerkleMultiproofs, MerkleCapHeight>
+        fri_type;
 
     static_assert(zk::is_commitment<fri_type>::value);
     static_assert(!zk::is_commitment<merkle_hash_type>::value);
@@ -87,7 +91,8 @@ void fri_basic_test() {
                        lambda,
                        2,       // expand_factor
                        true,    // use_grinding
-                       16       // grinding_parameter
+                       16,      // grinding_parameter
+                       MerklePrunedRows
     );
 
     BOOST_CHECK(D[1]->m == D[0]->m / 2);
@@ -116,6 +121,15 @@ void fri_basic_test() {
     zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(init_blob);
 
     proof_type proof = zk::algorithms::proof_eval<fri_type>(f, tree, params, transcript);
+    BOOST_CHECK_EQUAL(proof.round_multiproofs.size(), UseMerkleMultiproofs ? params.step_list.size() : 0);
+    BOOST_CHECK_EQUAL(proof.round_caps.size(), MerkleCapHeight != 0 ? params.step_list.size() : 0);
+
+    if constexpr (MerklePrunedRows != 0) {
+        // Pruning the round trees only changes how the prover gets the nodes of the proofs.
+        params_type unpruned_params(params.step_list, degree_log, lambda, 2, true, 16);
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> unpruned_transcript(init_blob);
+        BOOST_CHECK(proof == zk::algorithms::proof_eval<fri_type>(f, tree, unpruned_params, unpruned_transcript));
+    }
 
     // verify
     zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(init_blob);
@@ -125,6 +139,33 @@ void fri_basic_test() {
     typename FieldType::value_type verifier_next_challenge = transcript_verifier.template challenge<FieldType>();
     typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
+
+    // Malformed proofs are rejected without throwing, also when the queries are verified in parallel.
+    auto is_rejected = [&](const proof_type &malformed) {
+        zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> malformed_transcript(init_blob);
+        bool verified = true;
+        BOOST_CHECK_NO_THROW(
+            verified = zk::algorithms::verify_eval<fri_type>(malformed, root, params, malformed_transcript));
+        return !verified;
+    };
+    proof_type malformed = proof;
+    malformed.query_proofs.pop_back();
+    BOOST_CHECK(is_rejected(malformed));
+    malformed = proof;
+    malformed.query_proofs[1].round_proofs.pop_back();
+    BOOST_CHECK(is_rejected(malformed));
+    malformed = proof;
+    malformed.query_proofs[1].round_proofs.back().y.clear();
+    BOOST_CHECK(is_rejected(malformed));
+    malformed = proof;
+    malformed.query_proofs[1].initial_proof.begin()->second.values[0].pop_back();
+    BOOST_CHECK(is_rejected(malformed));
+    malformed = proof;
+    malformed.query_proofs[1].initial_proof.clear();
+    BOOST_CHECK(is_rejected(malformed));
+    malformed = proof;
+    malformed.query_proofs[1].initial_proof[1] = malformed.query_proofs[1].initial_proof.begin()->second;
+    BOOST_CHECK(is_rejected(malformed));
 }
 
 BOOST_AUTO_TEST_CASE(fri_basic_test_polynomial_dfs) {
@@ -136,4 +177,71 @@ BOOST_AUTO_TEST_CASE(fri_basic_test_polynomial_dfs) {
     fri_basic_test<FieldType, PolynomialType>();
 }
 
+BOOST_AUTO_TEST_CASE(fri_merkle_multiproofs_test_polynomial_dfs) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using PolynomialType = math::polynomial_dfs<FieldType::value_type>;
+
+    fri_basic_test<FieldType, PolynomialType, true>();
+}
+
+BOOST_AUTO_TEST_CASE(fri_merkle_tree_arity_4_test_polynomial_dfs) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using PolynomialType = math::polynomial_dfs<FieldType::value_type>;
+
+    // The rounds commit to 32, 16 and 8 leaves, so two of the three 4-ary trees are not complete.
+    fri_basic_test<FieldType, PolynomialType, false, 4>();
+    fri_basic_test<FieldType, PolynomialType, true, 4>();
+}
+
+BOOST_AUTO_TEST_CASE(fri_merkle_caps_and_pruned_rows_test_polynomial_dfs) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using PolynomialType = math::polynomial_dfs<FieldType::value_type>;
+
+    // Two pruned rows are kept under the cap of height 2, so the tree of the 8 leaves of the last round only
+    // gets one pruned.
+    fri_basic_test<FieldType, PolynomialType, false, 2, 2, 2>();
+    fri_basic_test<FieldType, PolynomialType, false, 4, 1, 1>();
+}
+
+BOOST_AUTO_TEST_CASE(fri_batch_precommit_resize_test_polynomial_dfs) {
+
+    using curve_type = algebra::curves::pallas;
+    using FieldType = typename curve_type::base_field_type;
+    using value_type = typename FieldType::value_type;
+    using PolynomialType = math::polynomial_dfs<value_type>;
+
+    typedef hashes::sha2<256> hash_type;
+    typedef zk::commitments::fri<FieldType, hash_type, hash_type, 2, zk::commitments::proof_of_work<hash_type>>
+        fri_type;
+
+    std::vector<std::shared_ptr<math::evaluation_domain<FieldType>>> D =
+        math::calculate_domain_set<FieldType>(5, 1);
+    const std::size_t fri_step = 1;
+
+    // Polynomials smaller than the domain are extended in one arena, mixed sizes share it with the ones already
+    // over the domain. The tree must be the same as over polynomials resized one by one.
+    std::vector<PolynomialType> batch(4);
+    batch[0].from_coefficients(std::vector<value_type> {1u, 3u, 4u, 1u, 5u, 6u, 7u, 2u});
+    batch[1].from_coefficients(std::vector<value_type> {8u, 7u, 5u, 6u});
+    batch[1].resize(D[0]->size());
+    batch[2] = PolynomialType(0, 16, value_type(9u));
+    batch[3].from_coefficients(std::vector<value_type> {2u, 1u, 0u, 3u, 1u, 1u, 4u, 5u, 9u, 2u, 6u, 5u, 3u});
+
+    std::vector<PolynomialType> resized = batch;
+    for (auto &poly : resized) {
+        poly.resize(D[0]->size());
+    }
+
+    auto tree = zk::algorithms::precommit<fri_type>(batch, D[0], fri_step);
+    auto expected = zk::algorithms::precommit<fri_type>(resized, D[0], fri_step);
+    BOOST_CHECK(tree.root() == expected.root());
+    BOOST_CHECK_EQUAL(batch[0].size(), std::size_t(8));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
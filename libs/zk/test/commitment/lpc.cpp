@@ -613,4 +613,85 @@ BOOST_FIXTURE_TEST_CASE(lpc_different_hash_types_test, test_fixture) {
     BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
 }
 
+BOOST_FIXTURE_TEST_CASE(lpc_merkle_tree_arity_4_test, test_fixture) {
+    // Setup types.
+    typedef algebra::curves::bls12<381> curve_type;
+    typedef typename curve_type::scalar_field_type FieldType;
+    typedef typename FieldType::value_type value_type;
+    typedef hashes::sha2<256> merkle_hash_type;
+    typedef hashes::sha2<256> transcript_hash_type;
+    typedef typename math::polynomial_dfs<value_type> poly_type;
+
+    constexpr static const std::size_t lambda = 10;
+
+    constexpr static const std::size_t d = 15;
+
+    constexpr static const std::size_t m = 2;
+
+    typedef zk::commitments::list_polynomial_commitment_params<
+        merkle_hash_type, transcript_hash_type, m, zk::commitments::proof_of_work<transcript_hash_type>, 4>
+        lpc_params_type;
+    typedef zk::commitments::list_polynomial_commitment<FieldType, lpc_params_type> lpc_type;
+
+    static_assert(zk::is_commitment<lpc_type>::value);
+    static_assert(lpc_type::fri_type::merkle_tree_arity == 4);
+
+    // Setup params. The two FRI rounds commit to 2^(degree_log + expand_factor - 2) = 32 and 16 leaves, the
+    // first 4-ary tree is not complete.
+    std::size_t degree_log = std::ceil(std::log2(d - 1));
+    typename lpc_type::fri_type::params_type fri_params(std::vector<std::size_t> {2, 1}, /*step_list*/
+                                                        degree_log,
+                                                        lambda,
+                                                        3,       // expand_factor
+                                                        true,    // use_grinding
+                                                        12       // grinding_parameter
+    );
+
+    using lpc_scheme_type = nil::crypto3::zk::commitments::lpc_commitment_scheme<lpc_type, poly_type>;
+    lpc_scheme_type lpc_scheme_prover(fri_params);
+    lpc_scheme_type lpc_scheme_verifier(fri_params);
+
+    // Generate polynomials
+    lpc_scheme_prover.append_to_batch(0,
+                                      poly_type(15, {1u, 13u, 4u, 1u, 5u, 6u, 7u, 2u, 8u, 7u, 5u, 6u, 1u, 2u, 1u, 1u}));
+    lpc_scheme_prover.append_to_batch(1, poly_type(1, {0u, 1u}));
+    lpc_scheme_prover.append_to_batch(1, poly_type(2, {0u, 1u, 2u, 3u}));
+    lpc_scheme_prover.append_to_batch(2, generate_random_polynomial_dfs(3, test_global_alg_rnd_engine<FieldType>));
+    lpc_scheme_prover.append_to_batch(2, generate_random_polynomial_dfs(7, test_global_alg_rnd_engine<FieldType>));
+
+    // Commit
+    std::map<std::size_t, typename lpc_type::commitment_type> commitments;
+    commitments[0] = lpc_scheme_prover.commit(0);
+    commitments[1] = lpc_scheme_prover.commit(1);
+    commitments[2] = lpc_scheme_prover.commit(2);
+
+    // Generate evaluation points. Choose points outside the domain
+    auto point = algebra::fields::arithmetic_params<FieldType>::multiplicative_generator;
+    lpc_scheme_prover.append_eval_point(0, point);
+    lpc_scheme_prover.append_eval_point(1, point);
+    lpc_scheme_prover.append_eval_point(2, point);
+
+    std::array<std::uint8_t, 96> x_data {};
+
+    // Prove
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript(x_data);
+    auto proof = lpc_scheme_prover.proof_eval(transcript);
+
+    // Verify
+    zk::transcript::fiat_shamir_heuristic_sequential<transcript_hash_type> transcript_verifier(x_data);
+    lpc_scheme_verifier.set_batch_size(0, proof.z.get_batch_size(0));
+    lpc_scheme_verifier.set_batch_size(1, proof.z.get_batch_size(1));
+    lpc_scheme_verifier.set_batch_size(2, proof.z.get_batch_size(2));
+
+    lpc_scheme_verifier.append_eval_point(0, point);
+    lpc_scheme_verifier.append_eval_point(1, point);
+    lpc_scheme_verifier.append_eval_point(2, point);
+    BOOST_CHECK(lpc_scheme_verifier.verify_eval(proof, commitments, transcript_verifier));
+
+    // Check transcript state
+    typename FieldType::value_type verifier_next_challenge = transcript_verifier.template challenge<FieldType>();
+    typename FieldType::value_type prover_next_challenge = transcript.template challenge<FieldType>();
+    BOOST_CHECK(verifier_next_challenge == prover_next_challenge);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
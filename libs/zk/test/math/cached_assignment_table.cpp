@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2026 Alloc Init Labs Inc.
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE cached_assignment_table_test
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/assignment.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/column_arena.hpp>
+#include <nil/crypto3/zk/snark/arithmetization/plonk/variable.hpp>
+#include <nil/crypto3/zk/math/cached_assignment_table.hpp>
+
+#include <nil/crypto3/zk/test_tools/random_test_initializer.hpp>
+
+using namespace nil::crypto3;
+using namespace nil::crypto3::zk::snark;
+
+using curve_type = algebra::curves::pallas;
+using field_type = typename curve_type::base_field_type;
+using value_type = typename field_type::value_type;
+using polynomial_dfs_type = math::polynomial_dfs<value_type>;
+using var = plonk_variable<polynomial_dfs_type>;
+
+BOOST_FIXTURE_TEST_SUITE(cached_assignment_table_test_suite, zk::test_tools::random_test_initializer<field_type>)
+
+BOOST_AUTO_TEST_CASE(column_arena_layout_test) {
+    auto &rnd = alg_random_engines.template get_alg_engine<field_type>();
+
+    const std::size_t rows_amount = 16;
+    plonk_column_arena<field_type> arena(3, rows_amount);
+    BOOST_CHECK_EQUAL(arena.columns_amount(), 3);
+    BOOST_CHECK_EQUAL(arena.rows_amount(), rows_amount);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(arena.data()) % zk::snark::detail::column_arena_alignment, 0);
+
+    // Columns are consecutive and start zeroed.
+    for (std::size_t i = 0; i < arena.columns_amount(); ++i) {
+        BOOST_CHECK(arena.column(i).data() == arena.data() + i * rows_amount);
+        for (const auto &value : arena[i]) {
+            BOOST_CHECK(value == value_type::zero());
+        }
+    }
+
+    // Short columns are padded with zeros, overlong ones are rejected.
+    std::vector<value_type> values(rows_amount - 3);
+    for (auto &value : values) {
+        value = rnd();
+    }
+    arena.column(1)[rows_amount - 1] = value_type::one();
+    arena.assign_column(1, values);
+    for (std::size_t i = 0; i < rows_amount; ++i) {
+        BOOST_CHECK(arena[1][i] == (i < values.size() ? values[i] : value_type::zero()));
+    }
+    BOOST_CHECK_THROW(arena.assign_column(0, std::vector<value_type>(rows_amount + 1)), std::invalid_argument);
+
+    // Copies share the storage.
+    plonk_column_arena<field_type> copy = arena;
+    copy.column(2)[0] = value_type::one();
+    BOOST_CHECK(arena[2][0] == value_type::one());
+    BOOST_CHECK(arena.columns(1, 2).size() == 2);
+    BOOST_CHECK(arena.columns(1, 2)[1].data() == arena.column(2).data());
+}
+
+BOOST_AUTO_TEST_CASE(column_arena_huge_pages_test) {
+    // Large enough for the huge-page mapping, which must behave as the aligned allocation.
+    const std::size_t rows_amount = 1 << 16;
+    const std::size_t columns_amount =
+        zk::snark::detail::column_arena_huge_page_size / (rows_amount * sizeof(value_type)) + 1;
+    plonk_column_arena<field_type> arena(columns_amount, rows_amount, true);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(arena.data()) % zk::snark::detail::column_arena_alignment, 0);
+
+    auto last = arena.column(columns_amount - 1);
+    BOOST_CHECK(last.back() == value_type::zero());
+    last.back() = value_type::one();
+    BOOST_CHECK(arena[columns_amount - 1][rows_amount - 1] == value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(cached_assignment_table_matches_per_column_conversion_test) {
+    auto &rnd = alg_random_engines.template get_alg_engine<field_type>();
+
+    const std::size_t rows_amount = 8;
+    const std::size_t usable_rows_amount = 6;
+    auto random_column = [&rnd, rows_amount]() {
+        std::vector<value_type> values(rows_amount);
+        for (auto &value : values) {
+            value = rnd();
+        }
+        return polynomial_dfs_type(rows_amount - 1, values);
+    };
+
+    using private_table_type = plonk_polynomial_dfs_table<field_type>::private_table_type;
+    using public_table_type = plonk_polynomial_dfs_table<field_type>::public_table_type;
+
+    auto private_table =
+        std::make_shared<private_table_type>(std::vector<polynomial_dfs_type> {random_column(), random_column()});
+    auto public_table = std::make_shared<public_table_type>(std::vector<polynomial_dfs_type> {random_column()},
+                                                            std::vector<polynomial_dfs_type> {random_column()},
+                                                            std::vector<polynomial_dfs_type> {random_column(),
+                                                                                              random_column()});
+    auto polynomial_table = std::make_shared<plonk_polynomial_dfs_table<field_type>>(private_table, public_table);
+
+    polynomial_dfs_type mask_assignment(0, rows_amount, value_type::zero());
+    for (std::size_t i = 0; i < usable_rows_amount; ++i) {
+        mask_assignment[i] = value_type::one();
+    }
+    polynomial_dfs_type lagrange_0(0, rows_amount, value_type::zero());
+    lagrange_0[0] = value_type::one();
+
+    cached_assignment_table<field_type> table(polynomial_table, mask_assignment, lagrange_0);
+
+    auto domain = math::make_evaluation_domain<field_type>(rows_amount);
+
+    // The per-column path the arena replaced: each column converted on its own, then evaluated on the extended
+    // domain.
+    auto expected_value = [&domain](const polynomial_dfs_type &column, std::size_t size, bool trimmed) {
+        polynomial_dfs_type result;
+        if (trimmed) {
+            result.from_coefficients(column.coefficients(domain), math::make_evaluation_domain<field_type>(size));
+        } else {
+            result.from_coefficients(math::polynomial_batch_to_coefficients<field_type>({column}, domain)[0],
+                                     math::make_evaluation_domain<field_type>(size));
+        }
+        return result;
+    };
+
+    std::vector<std::pair<var, polynomial_dfs_type>> columns = {
+        {var(0, 0, var::column_type::witness), private_table->witness(0)},
+        {var(1, 0, var::column_type::witness), private_table->witness(1)},
+        {var(0, 0, var::column_type::public_input), public_table->public_input(0)},
+        {var(0, 0, var::column_type::constant), public_table->constant(0)},
+        {var(0, 0, var::column_type::selector), public_table->selector(0)},
+        {var(1, 0, var::column_type::selector), public_table->selector(1)},
+    };
+
+    for (std::size_t size : {rows_amount, 4 * rows_amount}) {
+        std::set<var> variables;
+        for (const auto &[v, column] : columns) {
+            variables.insert(v);
+            variables.insert(var(v.index, 1, v.type));
+        }
+        var all_rows(PLONK_SPECIAL_SELECTOR_ALL_USABLE_ROWS_SELECTED, 0, var::column_type::selector);
+        var all_non_first_rows(PLONK_SPECIAL_SELECTOR_ALL_NON_FIRST_USABLE_ROWS_SELECTED, 0,
+                               var::column_type::selector);
+        variables.insert(all_rows);
+        variables.insert(all_non_first_rows);
+        table.ensure_cache(variables, size);
+
+        for (const auto &[v, column] : columns) {
+            auto expected = expected_value(column, size, false);
+            BOOST_CHECK(*table.get(v, size) == expected);
+            BOOST_CHECK(*table.get(var(v.index, 1, v.type), size) ==
+                        math::polynomial_shift(expected, 1, rows_amount));
+        }
+
+        // Special selectors keep the trimmed coefficients of polynomial_dfs::coefficients.
+        BOOST_CHECK(*table.get(all_rows, size) == expected_value(mask_assignment, size, true));
+        BOOST_CHECK(*table.get(all_non_first_rows, size) ==
+                    expected_value(mask_assignment - lagrange_0, size, true));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,7 @@
 
 #define BOOST_TEST_MODULE zk_transcript_test
 
+#include <limits>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
@@ -138,6 +139,290 @@ BOOST_AUTO_TEST_CASE(zk_poseidon_transcript_no_init_test) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(zk_sequential_transcript_compatibility_test_suite)
+
+// Elements used to be absorbed by hashing the std::vector returned by nil::marshalling::pack as a byte range.
+// Absorbing them one by one through the stack-buffer marshalling must keep every challenge of that baseline
+// transcript, absorb_elements hashes the concatenated bytes once.
+template<typename hash_type, typename field_type, typename ElementRange>
+void check_sequential_element_absorb(const ElementRange &elements) {
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript::fiat_shamir_heuristic_sequential<hash_type> bulk(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> single(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> baseline(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> bulk_baseline(init_blob);
+
+    bulk.absorb_elements(elements);
+    std::vector<std::uint8_t> element_bytes;
+    for (const auto &e : elements) {
+        single(e);
+
+        nil::marshalling::status_type status;
+        std::vector<std::uint8_t> byte_data = nil::marshalling::pack<nil::marshalling::option::big_endian>(e, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        baseline(byte_data);
+        element_bytes.insert(element_bytes.end(), byte_data.begin(), byte_data.end());
+    }
+    bulk_baseline(element_bytes);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        BOOST_CHECK_EQUAL(single.template challenge<field_type>(), baseline.template challenge<field_type>());
+        BOOST_CHECK_EQUAL(bulk.template challenge<field_type>(), bulk_baseline.template challenge<field_type>());
+    }
+    BOOST_CHECK_EQUAL(single.template int_challenge<std::uint64_t>(),
+                      baseline.template int_challenge<std::uint64_t>());
+    BOOST_CHECK_EQUAL(bulk.template int_challenge<std::uint64_t>(),
+                      bulk_baseline.template int_challenge<std::uint64_t>());
+}
+
+// Known answers of the keccak and sha2 transcripts over an evaluation vector, absorbed element by element as
+// existing proofs do, and in bulk.
+template<typename hash_type, typename field_type>
+void check_sequential_known_answers(const std::vector<typename field_type::value_type> &evaluations,
+                                    const std::array<typename field_type::value_type, 3> &single_challenges,
+                                    std::uint64_t single_int_challenge,
+                                    const std::array<typename field_type::value_type, 3> &bulk_challenges,
+                                    std::uint64_t bulk_int_challenge) {
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    transcript::fiat_shamir_heuristic_sequential<hash_type> single(init_blob);
+    transcript::fiat_shamir_heuristic_sequential<hash_type> bulk(init_blob);
+
+    for (const auto &e : evaluations) {
+        single(e);
+    }
+    bulk.absorb_elements(evaluations);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        BOOST_CHECK_EQUAL(single.template challenge<field_type>(), single_challenges[i]);
+        BOOST_CHECK_EQUAL(bulk.template challenge<field_type>(), bulk_challenges[i]);
+    }
+    BOOST_CHECK_EQUAL(single.template int_challenge<std::uint64_t>(), single_int_challenge);
+    BOOST_CHECK_EQUAL(bulk.template int_challenge<std::uint64_t>(), bulk_int_challenge);
+}
+
+BOOST_AUTO_TEST_CASE(zk_sequential_transcript_field_elements_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+
+    std::vector<field_type::value_type> evaluations(100);
+    for (std::size_t i = 0; i < evaluations.size(); ++i) {
+        evaluations[i] = field_type::value_type(i) * field_type::value_type(0xdeadbeefu);
+    }
+    evaluations.back() = -field_type::value_type::one();
+
+    check_sequential_element_absorb<hashes::keccak_1600<256>, field_type>(evaluations);
+    check_sequential_element_absorb<hashes::sha2<256>, field_type>(evaluations);
+
+    check_sequential_known_answers<hashes::keccak_1600<256>, field_type>(
+        evaluations,
+        {field_type::value_type(0x2459d99fcf370eeec90f9ad5a9b358f0967175d44a6dc839cf30c15f21554f52_cppui_modular254),
+         field_type::value_type(0x2c9ffecfbbc28b7f2495d413b967a69e02f80ca803ab14b933486ce6bd08b1fc_cppui_modular254),
+         field_type::value_type(0x23a50dd89d53da0d814ad848a3066d8c289435721ef127ce9d92a9d42172b7cb_cppui_modular254)},
+        0xb58cffb195fbdf38,
+        {field_type::value_type(0x3022e5552ee0476ee854363498935a7bc54705ca1147cb7a90082f84363c1e27_cppui_modular254),
+         field_type::value_type(0x2383d90692e887a928a7328a7d8c47503f02c72315e645ca6da8228373827389_cppui_modular254),
+         field_type::value_type(0x65fdaec7dd63250b320c3db77f814dd11fac2eb18d0d6e76b7785c347022c06_cppui_modular254)},
+        0x7b56b54a75fc6ba3);
+    check_sequential_known_answers<hashes::sha2<256>, field_type>(
+        evaluations,
+        {field_type::value_type(0x2fb8a5ffca5bd793f5c563b693cb614c52ce9101ca1b9c272d37f6f6b607fa57_cppui_modular254),
+         field_type::value_type(0x1a4cb599164da7c9ca2f33414c5c2de3355a2416c6c3593a243d17d4e2a3c36b_cppui_modular254),
+         field_type::value_type(0xf444de4b8161a4566866d60dc99185e746bf2887846f3bb5e506688ec4e67c3_cppui_modular254)},
+        0x3607397a7567324d,
+        {field_type::value_type(0x222f7a7fffb5fb31d0e322307332376c2b3c33b941182c82545b208aa6b55d39_cppui_modular254),
+         field_type::value_type(0xebd4ddd816ee08e769d176fc0e1e66b8485bab85cd86a74100fb844aea5a61b_cppui_modular254),
+         field_type::value_type(0x305551aa65b218109f680eadecf19d66949ae3f83981f84bc2a4cd0d067fb90_cppui_modular254)},
+        0x208a7e233917838c);
+}
+
+BOOST_AUTO_TEST_CASE(zk_sequential_transcript_curve_elements_test) {
+    using curve_type = algebra::curves::alt_bn128_254;
+    using field_type = curve_type::scalar_field_type;
+    using g1_value_type = curve_type::g1_type<>::value_type;
+
+    std::vector<g1_value_type> points = {g1_value_type::one(), g1_value_type::one() + g1_value_type::one()};
+    points.push_back(points[0] + points[1]);
+
+    check_sequential_element_absorb<hashes::keccak_1600<256>, field_type>(points);
+    check_sequential_element_absorb<hashes::sha2<256>, field_type>(points);
+}
+
+BOOST_AUTO_TEST_CASE(zk_poseidon_sequential_transcript_elements_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::poseidon1_policy<field_type, 128, 2>>;
+    using sponge_type = typename poseidon_type::construction::type;
+    using block_type = typename sponge_type::block_type;
+
+    std::vector<field_type::value_type> evaluations(5);
+    for (std::size_t i = 0; i < evaluations.size(); ++i) {
+        evaluations[i] = field_type::value_type(i + 1);
+    }
+
+    // The elements are packed into rate blocks behind their count, three blocks instead of five.
+    sponge_type sponge;
+    sponge.absorb(block_type {field_type::value_type(5u), evaluations[0]});
+    sponge.absorb(block_type {evaluations[1], evaluations[2]});
+    sponge.absorb(block_type {evaluations[3], evaluations[4]});
+    auto expected = sponge.squeeze();
+
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> bulk;
+    bulk.absorb_elements(evaluations);
+    BOOST_CHECK_EQUAL(bulk.challenge<field_type>(), expected[0]);
+
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> single;
+    for (const auto &e : evaluations) {
+        single(e);
+    }
+    transcript::fiat_shamir_heuristic_sequential<poseidon_type> bulk_again;
+    bulk_again.absorb_elements(evaluations);
+    BOOST_CHECK_NE(single.challenge<field_type>(), bulk_again.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(zk_duplex_transcript_test_suite)
+
+// Reads the squeezed keccak duplex output, which starts with the digest, 8 bytes at a time.
+template<typename Digest>
+std::uint64_t digest_word(const Digest &digest, std::size_t word) {
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < sizeof(result); ++i) {
+        result = (result << 8) | digest[word * sizeof(result) + i];
+    }
+    return result;
+}
+
+// Challenges of a fresh Poseidon duplex transcript after absorbing input, spelled out on the Poseidon permutation.
+template<typename poseidon_type>
+std::vector<typename poseidon_type::policy_type::word_type>
+    poseidon_duplex_challenges(const std::vector<typename poseidon_type::policy_type::word_type> &input,
+                               std::size_t count) {
+    using policy_type = typename poseidon_type::policy_type;
+    using word_type = typename policy_type::word_type;
+    constexpr std::size_t rate = policy_type::block_words;
+
+    typename policy_type::state_type state = policy_type::iv_generator::generate();
+    std::size_t position = 0;
+    for (const auto &w : input) {
+        state[position++] += w;
+        if (position == rate) {
+            poseidon_type::permutation_type::permute(state);
+            position = 0;
+        }
+    }
+
+    state[rate] += word_type(input.size() + 1);
+    poseidon_type::permutation_type::permute(state);
+    std::vector<word_type> result;
+    for (position = 0; result.size() < count; ++position) {
+        if (position == rate) {
+            poseidon_type::permutation_type::permute(state);
+            position = 0;
+        }
+        result.push_back(state[position]);
+    }
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(zk_keccak_duplex_transcript_test) {
+    using curve_type = algebra::curves::alt_bn128_254;
+    using field_type = curve_type::scalar_field_type;
+    using g1_value_type = curve_type::g1_type<>::value_type;
+    using hash_type = hashes::keccak_1600<256>;
+
+    // The first squeeze uses keccak padding, so it starts with keccak_1600 of the 64-bit big-endian length
+    // prefix and the bytes.
+    std::vector<std::uint8_t> init_blob {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<std::uint8_t> framed_blob {0, 0, 0, 0, 0, 0, 0, 10};
+    framed_blob.insert(framed_blob.end(), init_blob.begin(), init_blob.end());
+    typename hash_type::digest_type expected = hash<hash_type>(framed_blob);
+
+    transcript::fiat_shamir_heuristic_duplex<hash_type> tr(init_blob);
+    for (std::size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL(tr.int_challenge<std::uint64_t>(), digest_word(expected, i));
+    }
+
+    // Elements are absorbed as their marshalled bytes without a prefix, here across several rate blocks.
+    std::vector<field_type::value_type> evaluations(100);
+    for (std::size_t i = 0; i < evaluations.size(); ++i) {
+        evaluations[i] = field_type::value_type(i) * field_type::value_type(0xdeadbeefu);
+    }
+    const g1_value_type point = g1_value_type::one() + g1_value_type::one();
+
+    std::vector<std::uint8_t> element_bytes;
+    nil::marshalling::status_type status;
+    for (const auto &e : evaluations) {
+        std::vector<std::uint8_t> byte_data = nil::marshalling::pack<nil::marshalling::option::big_endian>(e, status);
+        BOOST_CHECK(status == nil::marshalling::status_type::success);
+        element_bytes.insert(element_bytes.end(), byte_data.begin(), byte_data.end());
+    }
+    std::vector<std::uint8_t> point_bytes = nil::marshalling::pack<nil::marshalling::option::big_endian>(point, status);
+    BOOST_CHECK(status == nil::marshalling::status_type::success);
+    element_bytes.insert(element_bytes.end(), point_bytes.begin(), point_bytes.end());
+    expected = hash<hash_type>(element_bytes);
+
+    transcript::fiat_shamir_heuristic_duplex<hash_type> elements;
+    elements.absorb_elements(evaluations);
+    elements(point);
+    for (std::size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL(elements.int_challenge<std::uint64_t>(), digest_word(expected, i));
+    }
+
+    // Absorbing after squeezing changes every following challenge.
+    transcript::fiat_shamir_heuristic_duplex<hash_type> other(init_blob);
+    other.int_challenge<std::uint64_t>();
+    tr(evaluations[0]);
+    other(evaluations[1]);
+    BOOST_CHECK_NE(tr.challenge<field_type>(), other.challenge<field_type>());
+}
+
+BOOST_AUTO_TEST_CASE(zk_poseidon_duplex_transcript_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::poseidon1_policy<field_type, 128, 2>>;
+
+    transcript::fiat_shamir_heuristic_duplex<poseidon_type> empty;
+    BOOST_CHECK_EQUAL(empty.challenge<field_type>(), poseidon_duplex_challenges<poseidon_type>({}, 1)[0]);
+
+    // Seven elements fill three rate blocks and leave one in the rate; five challenges need a second squeeze
+    // permutation.
+    std::vector<field_type::value_type> evaluations(7);
+    for (std::size_t i = 0; i < evaluations.size(); ++i) {
+        evaluations[i] = field_type::value_type(i + 1);
+    }
+    auto expected = poseidon_duplex_challenges<poseidon_type>(evaluations, 5);
+
+    transcript::fiat_shamir_heuristic_duplex<poseidon_type> tr;
+    tr.absorb_elements(evaluations);
+    auto ch_n = tr.challenges<field_type, 4>();
+    for (std::size_t i = 0; i < ch_n.size(); ++i) {
+        BOOST_CHECK_EQUAL(ch_n[i], expected[i]);
+    }
+    field_type::integral_type expected_int = expected[4].to_integral();
+    expected_int &= std::numeric_limits<std::uint64_t>::max();
+    BOOST_CHECK_EQUAL(tr.int_challenge<std::uint64_t>(), static_cast<std::uint64_t>(expected_int));
+}
+
+BOOST_AUTO_TEST_CASE(zk_poseidon_duplex_transcript_length_separation_test) {
+    using field_type = algebra::curves::alt_bn128_254::scalar_field_type;
+    using poseidon_type = hashes::poseidon<nil::crypto3::hashes::detail::poseidon1_policy<field_type, 128, 2>>;
+
+    // Elements are added into the rate, so [a] and [a, 0] only differ by the absorbed length.
+    transcript::fiat_shamir_heuristic_duplex<poseidon_type> single;
+    single(field_type::value_type(5u));
+    transcript::fiat_shamir_heuristic_duplex<poseidon_type> padded;
+    padded(field_type::value_type(5u));
+    padded(field_type::value_type::zero());
+
+    auto single_challenge = single.challenge<field_type>();
+    auto padded_challenge = padded.challenge<field_type>();
+    std::vector<field_type::value_type> input = {field_type::value_type(5u)};
+    BOOST_CHECK_EQUAL(single_challenge, poseidon_duplex_challenges<poseidon_type>(input, 1)[0]);
+    input.push_back(field_type::value_type::zero());
+    BOOST_CHECK_EQUAL(padded_challenge, poseidon_duplex_challenges<poseidon_type>(input, 1)[0]);
+    BOOST_CHECK_NE(single_challenge, padded_challenge);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 /* TODO: Write more elaborate tests for transcript of curve elements */
 BOOST_AUTO_TEST_SUITE(transcript_test_curves)
 